@@ -1,4 +1,5 @@
 #pragma once
 
 #include "base/status.hpp"
+#include "base/result.hpp"
 #include "base/cpp.hpp"
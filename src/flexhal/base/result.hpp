@@ -0,0 +1,65 @@
+#pragma once
+
+#include <type_traits>
+
+#include "status.hpp"
+
+namespace flexhal {
+namespace base {
+
+// 値とステータスの組（std::expected 風）
+//
+// 読み取り系 API の戻り値用。エラーを負の値や番兵値に埋め込まず、1 回の呼び出しで
+// 値と status の両方を返す。T が trivially copyable なら result<T> もそうなので、
+// 小さい T（bool, int, uint32_t など）ではレジスタで返される。
+//
+//   base::result<bool> level = pin.tryDigitalRead();
+//   if (!level) return level.error();
+//   use(level.value());
+template <class T>
+class result {
+  static_assert(std::is_trivially_copyable<T>::value, "result<T> requires a trivially copyable T");
+
+public:
+  // 成功（status::ok）
+  constexpr result(T value) : _value(value), _status(status::ok) {}
+
+  // 値なしのステータス（通常はエラー）
+  constexpr result(status s) : _value(), _status(s) {}
+
+  // 値と任意のステータス（pending / done など、正常系の付加情報つき）
+  constexpr result(status s, T value) : _value(value), _status(s) {}
+
+  // status が正常系（0 以上）か
+  FLEXHAL_INTERNAL_NODISCARD constexpr bool ok() const {
+    return is_ok(to_error(_status));
+  }
+
+  constexpr explicit operator bool() const {
+    return ok();
+  }
+
+  constexpr status error() const {
+    return _status;
+  }
+
+  // ok() でないときの値は T{}
+  constexpr T value() const {
+    return _value;
+  }
+
+  constexpr T value_or(T fallback) const {
+    return ok() ? _value : fallback;
+  }
+
+private:
+  T _value;
+  status _status;
+};
+
+// 型チェック（小さな値ならレジスタ 1 本分に収まる）
+static_assert(std::is_trivially_copyable<result<uint32_t>>::value, "result must be trivially copyable");
+static_assert(sizeof(result<uint32_t>) <= 2 * sizeof(uint32_t), "result<uint32_t> must stay compact");
+
+} // namespace base
+} // namespace flexhal
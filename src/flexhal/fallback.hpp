@@ -1,4 +1,4 @@
 #pragma once
 
-#include "fallback/logger.hpp"
 #include "fallback/utils.hpp"
+#include "fallback/logger.hpp"
@@ -16,6 +16,8 @@ public:
     // Provide a convenience overload using variadic arguments (not virtual in base)
     void log(flexhal::utils::logger::LogLevel level, const char* tag, const char* format, ...);
 
+    void flush() override;
+
 };
 
 // Function to print a simple string (platform-agnostic fallback)
@@ -52,6 +54,9 @@ void PrintfLogger::log(flexhal::utils::logger::LogLevel level, const char* tag,
     va_end(args);
 }
 
+void PrintfLogger::flush() {
+    fflush(stdout);
+}
 
 void print_string(const char* str) {
     printf("%s", str);
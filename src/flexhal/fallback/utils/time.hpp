@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <thread>
 #include "flexhal/base/status.hpp"
 
@@ -24,20 +25,55 @@ namespace time {
     return base::status::ok;
   }
 
+  /**
+   * @brief Monotonic time in nanoseconds (does not wrap).
+   */
+  inline uint64_t nanos64() {
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch() / std::chrono::nanoseconds(1));
+  }
+
+  /**
+   * @brief Monotonic time in microseconds (does not wrap).
+   */
+  inline uint64_t micros64() {
+    return nanos64() / 1000u;
+  }
+
   inline uint32_t millis() {
-    return static_cast<uint32_t>(
-      std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()
-      ).count()
-    );
+    return static_cast<uint32_t>(nanos64() / 1000000u);
   }
 
   inline uint32_t micros() {
-    return static_cast<uint32_t>(
-      std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()
-      ).count()
-    );
+    return static_cast<uint32_t>(micros64());
+  }
+
+  /**
+   * @brief Raw timestamp in steady_clock ticks. Convert differences with ticks_to_ns().
+   */
+  inline uint64_t ticks() {
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+
+  inline uint64_t ticks_to_ns(uint64_t ticks) {
+    using period = std::chrono::steady_clock::period;
+    return (period::den >= 1000000000ull * period::num)
+             ? ticks / (period::den / (1000000000ull * period::num))
+             : ticks * (1000000000ull * period::num / period::den);
+  }
+
+  /**
+   * @brief Fine-grained counter for timing short intervals: the low 32 bits of
+   *        ticks(). Subtract two readings as uint32_t and convert with cycles_to_ns().
+   */
+  inline uint32_t cycles() {
+    return static_cast<uint32_t>(ticks());
+  }
+
+  /**
+   * @brief Converts a cycles() difference (or a sum of them) to nanoseconds.
+   */
+  inline uint64_t cycles_to_ns(uint64_t cycles) {
+    return ticks_to_ns(cycles);
   }
 } // namespace time
 } // namespace utils
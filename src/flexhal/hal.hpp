@@ -3,8 +3,13 @@
 
 // Include headers for HAL modules
 #include "hal/gpio.hpp"
+#include "hal/pwm.hpp"
+#include "hal/adc.hpp"
+#include "hal/spi.hpp"
+#include "hal/i2c.hpp"
+#include "hal/uart.hpp"
 
-// Potentially other HAL modules like uart, spi, i2c, etc. will be included here in the future.
+// Potentially other HAL modules will be included here in the future.
 
 namespace flexhal {
 /**
@@ -0,0 +1,8 @@
+#pragma once
+
+// Analog-to-digital converter interfaces.
+// IAdc converts scan groups (an ordered list of channels, optionally
+// oversampled) either once or continuously into a double-buffered,
+// caller-provided array, with half- and full-complete callbacks.
+#include "adc/IAdc.hpp"
+#include "adc/ScanBuffer.hpp"
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+
+namespace flexhal { namespace hal { namespace adc {
+
+/**
+ * @brief One conversion result, right-aligned at the converter resolution.
+ */
+using sample_t = uint16_t;
+
+/**
+ * @brief An ordered list of channels converted back to back as one scan.
+ */
+struct ScanGroup {
+    const uint32_t* channels; ///< Channel numbers, converted in this order.
+    uint32_t channel_count;   ///< Number of entries in channels.
+    uint32_t oversampling;    ///< Conversions averaged into each result (0 or 1 = none, at most 65536).
+};
+
+/**
+ * @brief Called when one half of a continuous buffer has been filled.
+ *
+ * @param context The context from ContinuousConfig.
+ * @param samples The half that was just filled (interleaved scans).
+ * @param count Number of samples in that half.
+ */
+using BufferCallback = void (*)(void* context, const sample_t* samples, size_t count);
+
+/**
+ * @brief Destination and timing of a continuous acquisition.
+ *
+ * The buffer holds interleaved scans (buffer[scan * channel_count + i] is
+ * channel i of the group) and is used as a circular double buffer: while the
+ * converter fills one half, the application owns the other. on_half is
+ * called when the first half is complete and on_full when the second half
+ * is, after which filling restarts at the beginning.
+ */
+struct ContinuousConfig {
+    sample_t* buffer;       ///< Caller-owned storage.
+    size_t length;          ///< Samples in buffer; a non-zero multiple of 2 * channel_count.
+    uint32_t scan_rate_hz;  ///< Scans per second.
+    BufferCallback on_half; ///< First half filled (may be nullptr).
+    BufferCallback on_full; ///< Second half filled (may be nullptr).
+    void* context;          ///< Passed to both callbacks.
+};
+
+/**
+ * @brief Interface of an analog-to-digital converter.
+ *
+ * Unlike IPin::analogRead(), which costs one virtual call per conversion,
+ * a scan converts every channel of a group in one call, and continuous
+ * acquisition converts at a fixed rate without any call per sample.
+ * Callbacks run in the backend's acquisition context (interrupt, thread
+ * or poll(), depending on the backend) and should only hand the half over.
+ */
+class IAdc {
+public:
+    virtual ~IAdc() = default;
+
+    /**
+     * @brief Gets the number of channels; valid channel numbers are below it.
+     */
+    virtual uint32_t getNumberOfChannels() const = 0;
+
+    /**
+     * @brief Gets the resolution of a sample in bits.
+     */
+    virtual uint8_t getResolutionBits() const = 0;
+
+    /**
+     * @brief Converts every channel of the group once (blocking).
+     *
+     * @param group The channels to convert.
+     * @param out Receives group.channel_count samples, in group order.
+     * @return status::ok, status::param for an invalid group, or
+     *         status::busy while a continuous acquisition is running.
+     */
+    virtual base::status readScan(const ScanGroup& group, sample_t* out) = 0;
+
+    /**
+     * @brief Starts converting the group continuously into config.buffer.
+     *
+     * The group's channel list must stay valid until stopContinuous().
+     * @return status::ok, status::param for an invalid group or config, or
+     *         status::busy if an acquisition is already running.
+     */
+    virtual base::status startContinuous(const ScanGroup& group, const ContinuousConfig& config) = 0;
+
+    /**
+     * @brief Stops the continuous acquisition; no callback runs after it returns.
+     */
+    virtual void stopContinuous() = 0;
+
+    virtual bool isContinuousRunning() const = 0;
+
+    /**
+     * @brief Performs the acquisition work that is due, for backends that have
+     *        neither DMA nor a thread of their own (no-op otherwise). Call it
+     *        from the loop, a TimerThread or a task while acquiring.
+     */
+    virtual void poll() {
+    }
+
+    /**
+     * @brief Scans dropped because the acquisition fell behind its rate.
+     */
+    virtual uint32_t getOverrunCount() const {
+        return 0;
+    }
+
+    /**
+     * @brief Converts a single channel, averaging oversampling conversions.
+     * @return The sample, or a negative base::status value on error.
+     */
+    int read(uint32_t channel, uint32_t oversampling = 1);
+};
+
+/**
+ * @brief Checks a scan group against a converter's channel count.
+ * @return status::ok or status::param.
+ */
+base::status check_scan_group(const ScanGroup& group, uint32_t channel_limit);
+
+}}} // namespace flexhal::hal::adc
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_ADC_IADC_IPP
+#define FLEXHAL_INTERNAL_HAL_ADC_IADC_IPP
+
+namespace flexhal { namespace hal { namespace adc {
+
+int IAdc::read(uint32_t channel, uint32_t oversampling) {
+    const ScanGroup group{&channel, 1, oversampling};
+    sample_t value      = 0;
+    base::status result = readScan(group, &value);
+    if (result != base::status::ok) {
+        return static_cast<int>(result);
+    }
+    return value;
+}
+
+base::status check_scan_group(const ScanGroup& group, uint32_t channel_limit) {
+    if (group.channels == nullptr || group.channel_count == 0 || group.oversampling > 65536u) {
+        return base::status::param;
+    }
+    for (uint32_t i = 0; i < group.channel_count; ++i) {
+        if (group.channels[i] >= channel_limit) {
+            return base::status::param;
+        }
+    }
+    return base::status::ok;
+}
+
+}}} // namespace flexhal::hal::adc
+
+#endif // FLEXHAL_INTERNAL_HAL_ADC_IADC_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "IAdc.hpp"
+
+namespace flexhal { namespace hal { namespace adc {
+
+/**
+ * @brief Double-buffer bookkeeping for backends that acquire in software.
+ *
+ * The backend converts each scan straight into next() and then calls
+ * commit(), which advances the write position, fires the half/full
+ * callbacks of the ContinuousConfig at the half and end of the buffer and
+ * wraps around. Nothing is copied or allocated.
+ */
+class ScanBuffer {
+public:
+    ScanBuffer();
+
+    /**
+     * @brief Validates config for scans of channel_count samples and starts at the buffer start.
+     * @return status::ok, or status::param for an invalid config.
+     */
+    base::status reset(const ContinuousConfig& config, uint32_t channel_count);
+
+    /**
+     * @brief Where the next scan is to be written (channel_count samples).
+     */
+    sample_t* next() const {
+        return _config.buffer + _position;
+    }
+
+    /**
+     * @brief Completes the scan written at next().
+     */
+    void commit();
+
+    /**
+     * @brief Scans committed since reset().
+     */
+    uint64_t getScanCount() const {
+        return _scans;
+    }
+
+    const ContinuousConfig& getConfig() const {
+        return _config;
+    }
+
+private:
+    ContinuousConfig _config;
+    uint32_t _channel_count;
+    size_t _half;
+    size_t _position;
+    uint64_t _scans;
+};
+
+/**
+ * @brief Rounded mean of count conversions summing to sum.
+ */
+inline sample_t average_samples(uint32_t sum, uint32_t count) {
+    return static_cast<sample_t>((sum + count / 2) / count);
+}
+
+}}} // namespace flexhal::hal::adc
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_ADC_SCANBUFFER_IPP
+#define FLEXHAL_INTERNAL_HAL_ADC_SCANBUFFER_IPP
+
+namespace flexhal { namespace hal { namespace adc {
+
+ScanBuffer::ScanBuffer() : _config(), _channel_count(0), _half(0), _position(0), _scans(0)
+{
+}
+
+base::status ScanBuffer::reset(const ContinuousConfig& config, uint32_t channel_count) {
+    if (config.buffer == nullptr || config.scan_rate_hz == 0 || channel_count == 0 || config.length == 0 ||
+        config.length % (2u * channel_count) != 0) {
+        return base::status::param;
+    }
+    _config        = config;
+    _channel_count = channel_count;
+    _half          = config.length / 2;
+    _position      = 0;
+    _scans         = 0;
+    return base::status::ok;
+}
+
+void ScanBuffer::commit() {
+    _position += _channel_count;
+    ++_scans;
+    if (_position == _half) {
+        if (_config.on_half) _config.on_half(_config.context, _config.buffer, _half);
+    } else if (_position == _config.length) {
+        _position = 0;
+        if (_config.on_full) _config.on_full(_config.context, _config.buffer + _half, _half);
+    }
+}
+
+}}} // namespace flexhal::hal::adc
+
+#endif // FLEXHAL_INTERNAL_HAL_ADC_SCANBUFFER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
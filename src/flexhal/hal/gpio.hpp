@@ -104,16 +104,60 @@ struct PinConfig {
     }
 };
 
+// Signal edge
+enum class PinEdge : uint8_t {
+    Rising = 0,
+    Falling = 1,
+    Both = 2
+};
+
+/**
+ * @brief One pin interrupt, as passed to an InterruptCallback or queued in a PinEventQueue.
+ */
+struct PinEvent {
+    uint64_t timestamp_ns; ///< utils::time::nanos64() when the edge was observed.
+    uint16_t port;         ///< Port index of the pin.
+    uint16_t pin;          ///< Pin index within the port.
+    uint8_t level;         ///< Pin level right after the edge (0 or 1).
+};
+
+/**
+ * @brief Interrupt handler. Runs in interrupt context on hardware backends,
+ *        so it must be short and must not block.
+ */
+using InterruptCallback = void (*)(void* context, const PinEvent& event);
+
 // Forward declare interfaces defined in sub-directory headers
 class IPin;
 class IGpio;
 
+/**
+ * @brief Request to wait for an edge on a pin, as returned by IPin::edge().
+ *
+ * It does nothing by itself; it is awaitable from a utils::task coroutine
+ * (`co_await pin.edge(PinEdge::Rising)`).
+ */
+struct PinEdgeWait {
+    IPin* pin;
+    PinEdge edge;
+};
+
 } // namespace gpio
 } // namespace hal
 } // namespace flexhal
 
 
 // Child interface headers (will be created next)
+#include "gpio/PinEventQueue.hpp"
 #include "gpio/IPin.hpp" 
 #include "gpio/IPort.hpp"
 #include "gpio/IGpio.hpp"
+#include "gpio/PinLike.hpp"
+#include "gpio/PortCapture.hpp"
+#include "gpio/WaveformPlayer.hpp"
+
+// StaticPin binds to the functional API of the selected backend, so it is only
+// available once a backend has declared it (backends include it themselves).
+#ifdef FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO
+#include "gpio/StaticPin.hpp"
+#endif
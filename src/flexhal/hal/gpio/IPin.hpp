@@ -1,7 +1,9 @@
 #pragma once
 
 #include "flexhal/base/status.hpp"      // For base::status
+#include "flexhal/base/result.hpp"
 #include "../gpio.hpp" // Correct include path for types like PinMode, PinConfig
+#include "PinEventQueue.hpp"
 #include <cstdint>
 
 // Forward declarations
@@ -76,6 +78,20 @@ public:
      */
     virtual int digitalRead() const = 0; // Changed return type to int
 
+    /**
+     * @brief Read the digital value of the pin together with a status.
+     * The default decodes digitalRead(); backends override it so that no
+     * sentinel check is needed.
+     * @return The level (true for HIGH), or the error status.
+     */
+    virtual base::result<bool> tryDigitalRead() const {
+        const int level = digitalRead();
+        if (level < 0) {
+            return static_cast<base::status>(level);
+        }
+        return level != 0;
+    }
+
     // --- Analog I/O (Optional) ---
 
     /**
@@ -102,9 +118,56 @@ public:
         return static_cast<int>(base::status::unsupported); // Return an error code
     }
 
-    // --- Interrupts (Optional - Future) ---
-    // virtual base::error_t attachInterrupt(...) = 0;
-    // virtual base::error_t detachInterrupt() = 0;
+    /**
+     * @brief Read an analog value from the pin together with a status.
+     * The default decodes analogRead().
+     * @return The analog value, or the error status (unsupported if the pin has no ADC).
+     */
+    virtual base::result<uint32_t> tryAnalogRead() const {
+        const int value = analogRead();
+        if (value < 0) {
+            return static_cast<base::status>(value);
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    /**
+     * @brief Describes a wait for the given edge on this pin.
+     * Use as `co_await pin.edge(PinEdge::Rising)` inside a utils::task::Task.
+     */
+    PinEdgeWait edge(PinEdge edge) {
+        return PinEdgeWait{this, edge};
+    }
+
+    // --- Interrupts (Optional) ---
+
+    /**
+     * @brief Calls callback(context, event) on every matching edge of the pin.
+     * Replaces any handler already attached to the pin. The callback runs in
+     * interrupt context on hardware backends.
+     * @return flexhal::base::status indicating success, or unsupported if the
+     *         pin or backend has no edge interrupts.
+     */
+    virtual base::status attachInterrupt(PinEdge edge, InterruptCallback callback, void* context = nullptr) {
+        return base::status::unsupported;
+    }
+
+    /**
+     * @brief Removes the handler attached by attachInterrupt().
+     * @return flexhal::base::status indicating success, or unsupported.
+     */
+    virtual base::status detachInterrupt() {
+        return base::status::unsupported;
+    }
+
+    /**
+     * @brief Queued mode: every matching edge is pushed into queue, to be
+     * popped from the application loop or a task. The queue must outlive the
+     * attachment.
+     */
+    base::status attachInterrupt(PinEdge edge, PinEventQueue& queue) {
+        return attachInterrupt(edge, &PinEventQueue::pushCallback, &queue);
+    }
 
 }; // class IPin
 
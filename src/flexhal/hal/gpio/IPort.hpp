@@ -1,6 +1,7 @@
 #pragma once
 
 #include "flexhal/base/status.hpp"
+#include "flexhal/base/result.hpp"
 #include "../gpio.hpp" // Include main gpio header for types
 #include <cstdint>
 
@@ -63,6 +64,63 @@ public:
      */
     virtual uint32_t read() const = 0; // Need to define error handling.
 
+    /**
+     * @brief Reads the entire port together with a status.
+     *
+     * Unlike read(), a failed read is reported instead of returning an
+     * arbitrary value. The default wraps read() and always succeeds;
+     * backends that can fail, or that want to save the extra virtual call,
+     * override it.
+     *
+     * @return The port value, or the error status.
+     */
+    virtual base::result<uint32_t> tryRead() const {
+        return read();
+    }
+
+    // --- Multi-pin operations ---
+    // The default implementations below perform a read-modify-write through
+    // read()/write(). Implementations should override them with a single
+    // set/clear (BSRR-style) register access, or at least a single pass over
+    // the mask, where the hardware allows it.
+
+    /**
+     * @brief Drives all pins in the mask HIGH, leaving the others unchanged.
+     * @param mask Bit n selects pin n of this port.
+     * @return flexhal::base::status::ok on success, or an error code.
+     */
+    virtual base::status setBits(uint32_t mask) {
+        return write(read() | mask);
+    }
+
+    /**
+     * @brief Drives all pins in the mask LOW, leaving the others unchanged.
+     * @param mask Bit n selects pin n of this port.
+     * @return flexhal::base::status::ok on success, or an error code.
+     */
+    virtual base::status clearBits(uint32_t mask) {
+        return write(read() & ~mask);
+    }
+
+    /**
+     * @brief Inverts the output level of all pins in the mask.
+     * @param mask Bit n selects pin n of this port.
+     * @return flexhal::base::status::ok on success, or an error code.
+     */
+    virtual base::status toggleBits(uint32_t mask) {
+        return write(read() ^ mask);
+    }
+
+    /**
+     * @brief Writes the masked bits of value, leaving the other pins unchanged.
+     * @param mask Bit n selects pin n of this port.
+     * @param value New levels; only bits set in mask are used.
+     * @return flexhal::base::status::ok on success, or an error code.
+     */
+    virtual base::status writeMasked(uint32_t mask, uint32_t value) {
+        return write((read() & ~mask) | (value & mask));
+    }
+
     /**
      * @brief Gets a specific pin within this port by its index.
      * @param pin_index_in_port The index of the pin within this port (0 to getNumberOfPins()-1).
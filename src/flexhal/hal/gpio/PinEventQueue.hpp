@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "../gpio.hpp" // For PinEvent
+
+namespace flexhal { namespace hal { namespace gpio {
+
+/**
+ * @brief Lock-free single-producer / single-consumer ring of PinEvents.
+ *
+ * The queued interrupt mode (`IPin::attachInterrupt(edge, queue)`) pushes
+ * from the interrupt handler and the application loop or a task pops, so
+ * the handler does no work beyond copying 16 bytes. When the ring is full
+ * new events are dropped and counted.
+ *
+ * Exactly one context may push: pins whose handlers can preempt each other
+ * (different priorities, or different cores) need separate queues.
+ * The storage is allocated once by the constructor.
+ */
+class PinEventQueue {
+public:
+    /**
+     * @param capacity Number of events, rounded up to a power of two.
+     */
+    explicit PinEventQueue(size_t capacity);
+
+    PinEventQueue(const PinEventQueue&)            = delete;
+    PinEventQueue& operator=(const PinEventQueue&) = delete;
+
+    /**
+     * @brief Appends an event (producer side; safe from an interrupt handler).
+     * @return false if the queue was full and the event was dropped.
+     */
+    bool push(const PinEvent& event) {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) > _mask) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _events[head & _mask] = event;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest event (consumer side).
+     * @return false if the queue is empty.
+     */
+    bool pop(PinEvent& event) {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        event = _events[tail & _mask];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes up to max events with a single index update (consumer side).
+     * @return The number of events copied to out.
+     */
+    size_t pop(PinEvent* out, size_t max);
+
+    size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t getCapacity() const {
+        return _mask + 1;
+    }
+
+    uint32_t getDroppedCount() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief InterruptCallback that pushes into the PinEventQueue passed as context.
+     */
+    static void pushCallback(void* context, const PinEvent& event) {
+        static_cast<PinEventQueue*>(context)->push(event);
+    }
+
+private:
+    std::unique_ptr<PinEvent[]> _events;
+    size_t _mask;
+    std::atomic<size_t> _head; // written by the producer
+    std::atomic<size_t> _tail; // written by the consumer
+    std::atomic<uint32_t> _dropped;
+};
+
+}}} // namespace flexhal::hal::gpio
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_GPIO_PINEVENTQUEUE_IPP
+#define FLEXHAL_INTERNAL_HAL_GPIO_PINEVENTQUEUE_IPP
+
+namespace flexhal { namespace hal { namespace gpio {
+
+namespace {
+size_t round_up_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+} // namespace
+
+PinEventQueue::PinEventQueue(size_t capacity)
+    : _events(new PinEvent[round_up_pow2(capacity ? capacity : 1)]),
+      _mask(round_up_pow2(capacity ? capacity : 1) - 1),
+      _head(0),
+      _tail(0),
+      _dropped(0)
+{
+}
+
+size_t PinEventQueue::pop(PinEvent* out, size_t max) {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    size_t count      = _head.load(std::memory_order_acquire) - tail;
+    if (count > max) count = max;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = _events[(tail + i) & _mask];
+    }
+    _tail.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+}}} // namespace flexhal::hal::gpio
+
+#endif // FLEXHAL_INTERNAL_HAL_GPIO_PINEVENTQUEUE_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
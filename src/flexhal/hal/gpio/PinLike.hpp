@@ -0,0 +1,52 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "flexhal/base/status.hpp"
+#include "../gpio.hpp" // For PinMode
+
+#ifdef FLEXHAL_INTERNAL_CPP20
+#include <concepts>
+#endif
+
+namespace flexhal { namespace hal { namespace gpio {
+
+namespace detail {
+template <typename...>
+using void_t = void;
+} // namespace detail
+
+/**
+ * @brief Trait satisfied by any type usable as a digital pin by generic drivers.
+ *
+ * Requires `setMode(PinMode) -> base::status`, `digitalWrite(bool) -> base::status`
+ * and `digitalRead() const -> int`. Both `IPin` (virtual dispatch) and
+ * `StaticPin<N>` (compile-time pin) satisfy it, so a driver written as
+ * `template <typename Pin> void f(Pin& pin)` accepts either.
+ */
+template <typename T, typename = void>
+struct is_pin_like : std::false_type {};
+
+template <typename T>
+struct is_pin_like<T, detail::void_t<decltype(std::declval<T&>().setMode(PinMode::Output)),
+                                     decltype(std::declval<T&>().digitalWrite(true)),
+                                     decltype(std::declval<const T&>().digitalRead())>>
+    : std::integral_constant<bool,
+          std::is_same<decltype(std::declval<T&>().setMode(PinMode::Output)), base::status>::value &&
+          std::is_same<decltype(std::declval<T&>().digitalWrite(true)), base::status>::value &&
+          std::is_convertible<decltype(std::declval<const T&>().digitalRead()), int>::value> {};
+
+#ifdef FLEXHAL_INTERNAL_CPP20
+/**
+ * @brief C++20 concept equivalent of is_pin_like.
+ */
+template <typename T>
+concept PinLike = requires(T& pin, const T& const_pin, bool level, PinMode mode) {
+    { pin.setMode(mode) } -> std::same_as<base::status>;
+    { pin.digitalWrite(level) } -> std::same_as<base::status>;
+    { const_pin.digitalRead() } -> std::convertible_to<int>;
+};
+#endif
+
+}}} // namespace flexhal::hal::gpio
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "../gpio.hpp" // For PinEvent
+#include "IPort.hpp"
+
+namespace flexhal { namespace hal { namespace gpio {
+
+/**
+ * @brief One run of a capture: the masked port value from time_us until the next record.
+ */
+struct CaptureRecord {
+    uint32_t time_us; ///< Microseconds since the capture started.
+    uint32_t value;   ///< Port value (only the captured pins are kept).
+};
+
+/**
+ * @brief Logic-analyzer style capture of an IPort into a caller-provided buffer.
+ *
+ * Samples are run-length compressed: a record is stored only when the
+ * captured pins change, so an idle bus costs nothing however long the
+ * capture runs. Acquisition never allocates; when the buffer is full the
+ * capture stops and overflowed() is set.
+ *
+ * Three ways to acquire:
+ * - captureFixedRate(): samples every period_us on a fixed grid (timestamps
+ *   are multiples of the period, like a logic analyzer).
+ * - captureOnChange(): polls the port as fast as possible and timestamps
+ *   each change with utils::time::micros64().
+ * - sample() / interruptCallback(): driven by the caller, e.g. from the
+ *   application loop or attached to pin edge interrupts.
+ *
+ * The blocking capture functions busy-wait for their whole duration.
+ */
+class PortCapture {
+public:
+    /**
+     * @param port Port to capture.
+     * @param buffer Storage for the records, owned by the caller.
+     * @param capacity Number of records in buffer.
+     * @param mask Pins to capture (bit n = pin n); other pins are ignored.
+     */
+    PortCapture(IPort& port, CaptureRecord* buffer, size_t capacity, uint32_t mask = 0xFFFFFFFFu);
+
+    /**
+     * @brief Clears the buffer, sets time 0 and records the current port value.
+     */
+    void start();
+
+    /**
+     * @brief Reads the port now and records it if the captured pins changed.
+     * @return false once the buffer is full.
+     */
+    bool sample();
+
+    /**
+     * @brief Records a value observed at an absolute utils::time::micros64() time.
+     * @return false once the buffer is full.
+     */
+    bool record(uint64_t now_us, uint32_t value);
+
+    /**
+     * @brief Ends the capture; getDuration_us() is measured up to this point.
+     */
+    void stop();
+
+    /**
+     * @brief start(), then samples every period_us for duration_us, then stop().
+     * @return status::ok, status::no_memory if the buffer filled up, or
+     *         status::param for a zero period.
+     */
+    base::status captureFixedRate(uint32_t period_us, uint32_t duration_us);
+
+    /**
+     * @brief start(), then polls the port continuously for duration_us, then stop().
+     * @return status::ok, or status::no_memory if the buffer filled up.
+     */
+    base::status captureOnChange(uint32_t duration_us);
+
+    /**
+     * @brief InterruptCallback recording into the PortCapture passed as context.
+     *
+     * Attach it with PinEdge::Both to every captured pin; the whole port is
+     * read at each edge and the edge timestamp is used.
+     */
+    static void interruptCallback(void* context, const PinEvent& event);
+
+    const CaptureRecord* getRecords() const {
+        return _buffer;
+    }
+
+    size_t getRecordCount() const {
+        return _count;
+    }
+
+    size_t getCapacity() const {
+        return _capacity;
+    }
+
+    uint32_t getMask() const {
+        return _mask;
+    }
+
+    uint32_t getPortIndex() const {
+        return _port.getPortIndex();
+    }
+
+    /**
+     * @brief Length of the capture in microseconds (up to now while it is running).
+     */
+    uint32_t getDuration_us() const;
+
+    /**
+     * @brief Number of port reads since start(), including unchanged ones.
+     */
+    uint32_t getSampleCount() const {
+        return _samples;
+    }
+
+    /**
+     * @brief Fixed-rate samples skipped because the loop fell behind the grid.
+     */
+    uint32_t getMissedSamples() const {
+        return _missed;
+    }
+
+    bool overflowed() const {
+        return _overflow;
+    }
+
+    bool isRunning() const {
+        return _running;
+    }
+
+private:
+    bool append(uint32_t time_us, uint32_t value);
+
+    IPort& _port;
+    CaptureRecord* _buffer;
+    size_t _capacity;
+    uint32_t _mask;
+    size_t _count;
+    uint64_t _start_us;
+    uint32_t _end_us;
+    uint32_t _samples;
+    uint32_t _missed;
+    bool _overflow;
+    bool _running;
+};
+
+}}} // namespace flexhal::hal::gpio
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_GPIO_PORTCAPTURE_IPP
+#define FLEXHAL_INTERNAL_HAL_GPIO_PORTCAPTURE_IPP
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal { namespace hal { namespace gpio {
+
+PortCapture::PortCapture(IPort& port, CaptureRecord* buffer, size_t capacity, uint32_t mask)
+    : _port(port),
+      _buffer(buffer),
+      _capacity(buffer ? capacity : 0),
+      _mask(mask),
+      _count(0),
+      _start_us(0),
+      _end_us(0),
+      _samples(0),
+      _missed(0),
+      _overflow(false),
+      _running(false)
+{
+}
+
+void PortCapture::start() {
+    _count    = 0;
+    _samples  = 1;
+    _missed   = 0;
+    _overflow = false;
+    _end_us   = 0;
+    _start_us = flexhal::utils::time::micros64();
+    _running  = true;
+    append(0, _port.read() & _mask);
+}
+
+bool PortCapture::append(uint32_t time_us, uint32_t value) {
+    if (_count > 0 && _buffer[_count - 1].value == value) {
+        return true;
+    }
+    if (_count >= _capacity) {
+        _overflow = true;
+        _running  = false;
+        _end_us   = time_us;
+        return false;
+    }
+    _buffer[_count++] = CaptureRecord{time_us, value};
+    return true;
+}
+
+bool PortCapture::record(uint64_t now_us, uint32_t value) {
+    if (!_running) return false;
+    ++_samples;
+    const uint32_t time_us = (now_us > _start_us) ? static_cast<uint32_t>(now_us - _start_us) : 0;
+    return append(time_us, value & _mask);
+}
+
+bool PortCapture::sample() {
+    return record(flexhal::utils::time::micros64(), _port.read());
+}
+
+void PortCapture::stop() {
+    if (!_running) return;
+    _end_us  = static_cast<uint32_t>(flexhal::utils::time::micros64() - _start_us);
+    _running = false;
+}
+
+uint32_t PortCapture::getDuration_us() const {
+    if (_running) {
+        return static_cast<uint32_t>(flexhal::utils::time::micros64() - _start_us);
+    }
+    return _end_us;
+}
+
+base::status PortCapture::captureFixedRate(uint32_t period_us, uint32_t duration_us) {
+    if (period_us == 0) {
+        return base::status::param;
+    }
+    start();
+    const uint64_t origin = _start_us;
+    const uint32_t total  = duration_us / period_us;
+    uint32_t index        = 1;
+    while (index <= total && _running) {
+        const uint64_t deadline = origin + static_cast<uint64_t>(index) * period_us;
+        uint64_t now;
+        while ((now = flexhal::utils::time::micros64()) < deadline) {
+        }
+        // Fell behind: skip the grid points that have already passed.
+        const uint32_t late = static_cast<uint32_t>((now - deadline) / period_us);
+        _missed += late;
+        index += late;
+        if (index > total) break;
+        const uint32_t value = _port.read() & _mask;
+        ++_samples;
+        append(index * period_us, value);
+        ++index;
+    }
+    if (_running) {
+        _end_us  = total * period_us;
+        _running = false;
+    }
+    return _overflow ? base::status::no_memory : base::status::ok;
+}
+
+base::status PortCapture::captureOnChange(uint32_t duration_us) {
+    start();
+    const uint64_t end = _start_us + duration_us;
+    uint64_t now;
+    while (_running && (now = flexhal::utils::time::micros64()) < end) {
+        record(now, _port.read());
+    }
+    if (_running) {
+        _end_us  = duration_us;
+        _running = false;
+    }
+    return _overflow ? base::status::no_memory : base::status::ok;
+}
+
+void PortCapture::interruptCallback(void* context, const PinEvent& event) {
+    PortCapture* capture = static_cast<PortCapture*>(context);
+    capture->record(event.timestamp_ns / 1000u, capture->_port.read());
+}
+
+}}} // namespace flexhal::hal::gpio
+
+#endif // FLEXHAL_INTERNAL_HAL_GPIO_PORTCAPTURE_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <type_traits>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/base/result.hpp"
+#include "../gpio.hpp"
+#include "PinLike.hpp"
+
+// The functional API of the selected backend must be declared before this header.
+// Backend gpio headers define FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO and then include it.
+#ifndef FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO
+  #error "StaticPin requires a GPIO functional backend (FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO)"
+#endif
+
+namespace flexhal { namespace hal { namespace gpio {
+
+/**
+ * @brief A pin fixed at compile time.
+ *
+ * All members are static and forward directly to the functional API of the
+ * selected backend (e.g. `flexhal::internal::framework::arduino::hal::gpio::digital_write`),
+ * so there is no vtable, no stored port reference and nothing to construct.
+ * The type is empty; use it by value or as a template argument.
+ *
+ * @tparam N Platform-specific pin number, as accepted by the functional API.
+ */
+template <pin_id_t N>
+class StaticPin {
+public:
+    static constexpr pin_id_t pin_number = N;
+
+    static base::status setMode(PinMode mode) {
+        return FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO::pin_mode(N, mode);
+    }
+
+    static base::status digitalWrite(bool level) {
+        return FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO::digital_write(N, level);
+    }
+
+    static int digitalRead() {
+        return FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO::digital_read(N);
+    }
+
+    static base::result<bool> tryDigitalRead() {
+        const int level = FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO::digital_read(N);
+        if (level < 0) {
+            return static_cast<base::status>(level);
+        }
+        return level != 0;
+    }
+};
+
+static_assert(std::is_empty<StaticPin<0>>::value, "StaticPin must not carry state");
+static_assert(is_pin_like<StaticPin<0>>::value, "StaticPin must satisfy is_pin_like");
+static_assert(is_pin_like<IPin>::value, "IPin must satisfy is_pin_like");
+#ifdef FLEXHAL_INTERNAL_CPP20
+static_assert(PinLike<StaticPin<0>> && PinLike<IPin>, "StaticPin and IPin must satisfy PinLike");
+#endif
+
+}}} // namespace flexhal::hal::gpio
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "IPort.hpp"
+
+namespace flexhal { namespace hal { namespace gpio {
+
+/**
+ * @brief One step of a waveform: after delta_ns, drive the masked pins to value.
+ */
+struct WaveStep {
+    uint32_t mask;     ///< Pins written by this step (bit n = pin n).
+    uint32_t value;    ///< New levels of the masked pins.
+    uint32_t delta_ns; ///< Time since the previous step (the first step: since play() started).
+};
+
+/**
+ * @brief Timing error of the last play(), measured when each write returned.
+ *
+ * Errors are signed: positive means the write completed after its deadline.
+ */
+struct WaveformStats {
+    uint32_t steps;             ///< Steps written.
+    uint64_t duration_ns;       ///< From the start of play() to the last write.
+    int32_t min_error_ns;       ///< Earliest step relative to its deadline.
+    int32_t max_error_ns;       ///< Latest step relative to its deadline.
+    uint32_t mean_abs_error_ns; ///< Mean of |error| over all steps.
+};
+
+/**
+ * @brief Emits a precomputed sequence of masked port writes at precise times.
+ *
+ * Deadlines are absolute (start + sum of deltas), so per-step overhead and
+ * jitter never accumulate over a long sequence. Each step is one
+ * IPort::writeMasked() issued from a tight loop on utils::time::cycles()
+ * (the CPU cycle counter on ESP32), started early by the calibrated cost of
+ * a write so that the pins change close to the deadline. Waits longer than a
+ * few milliseconds sleep through utils::time::delay_us() first. The calling
+ * thread is busy for the whole sequence and should stay on one core.
+ *
+ * The steps buffer is only read; nothing is allocated while playing.
+ */
+class WaveformPlayer {
+public:
+    explicit WaveformPlayer(IPort& port);
+
+    /**
+     * @brief Measures the average cost of a writeMasked() that changes the
+     *        pins in mask and uses it as the write lead.
+     *
+     * The masked pins toggle samples times and are then restored, so pass
+     * pins the waveform drives anyway.
+     * @return The new lead in nanoseconds.
+     */
+    uint32_t calibrate(uint32_t samples = 64, uint32_t mask = 1u);
+
+    /**
+     * @brief Plays count steps, repeat times back to back.
+     * @return status::ok, or status::param if steps is null, count is 0 or repeat is 0.
+     */
+    base::status play(const WaveStep* steps, size_t count, uint32_t repeat = 1);
+
+    const WaveformStats& getStats() const {
+        return _stats;
+    }
+
+    void setWriteLead_ns(uint32_t ns) {
+        _lead_ns = ns;
+    }
+
+    uint32_t getWriteLead_ns() const {
+        return _lead_ns;
+    }
+
+private:
+    IPort& _port;
+    uint32_t _lead_ns;
+    WaveformStats _stats;
+};
+
+}}} // namespace flexhal::hal::gpio
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_GPIO_WAVEFORMPLAYER_IPP
+#define FLEXHAL_INTERNAL_HAL_GPIO_WAVEFORMPLAYER_IPP
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal { namespace hal { namespace gpio {
+
+WaveformPlayer::WaveformPlayer(IPort& port) : _port(port), _lead_ns(0), _stats()
+{
+}
+
+uint32_t WaveformPlayer::calibrate(uint32_t samples, uint32_t mask) {
+    if (samples == 0) samples = 1;
+    if (mask == 0) mask = 1u;
+    // A write that leaves the pins unchanged can return early (the native
+    // backend does), so every sample flips the masked pins.
+    const uint32_t original = _port.read() & mask;
+    uint32_t value          = original;
+    const uint32_t start    = flexhal::utils::time::cycles();
+    for (uint32_t i = 0; i < samples; ++i) {
+        value ^= mask;
+        _port.writeMasked(mask, value);
+    }
+    const uint32_t elapsed = flexhal::utils::time::cycles() - start;
+    _port.writeMasked(mask, original);
+    _lead_ns = static_cast<uint32_t>(flexhal::utils::time::cycles_to_ns(elapsed) / samples);
+    return _lead_ns;
+}
+
+base::status WaveformPlayer::play(const WaveStep* steps, size_t count, uint32_t repeat) {
+    if (steps == nullptr || count == 0 || repeat == 0) {
+        return base::status::param;
+    }
+    // Sleep through waits longer than this, leaving sleep_margin_ns to spin.
+    constexpr uint64_t sleep_above_ns  = 3000000;
+    constexpr uint64_t sleep_margin_ns = 1000000;
+    // Sleeps are split so that cycles() is read well within one wrap of the counter.
+    constexpr uint32_t sleep_chunk_us = 100000;
+
+    // Elapsed time is kept in cycles() units: each read folds the 32-bit
+    // difference into a 64-bit count. Deadlines are converted once per step,
+    // so the spin loop only compares integers.
+    uint32_t last_cycles    = flexhal::utils::time::cycles();
+    uint64_t elapsed_cycles = 0;
+    auto now_cycles = [&]() {
+        const uint32_t c = flexhal::utils::time::cycles();
+        elapsed_cycles += static_cast<uint32_t>(c - last_cycles);
+        last_cycles = c;
+        return elapsed_cycles;
+    };
+    const uint64_t ns_per_mcycle = flexhal::utils::time::cycles_to_ns(1000000u);
+    auto to_cycles = [ns_per_mcycle](uint64_t ns) { return ns * 1000000u / ns_per_mcycle; };
+
+    int64_t min_error  = INT64_MAX;
+    int64_t max_error  = INT64_MIN;
+    uint64_t abs_sum   = 0;
+    uint64_t deadline  = 0;
+    uint64_t last_done = 0;
+
+    for (uint32_t r = 0; r < repeat; ++r) {
+        for (size_t i = 0; i < count; ++i) {
+            const WaveStep& step = steps[i];
+            deadline += step.delta_ns;
+            const uint64_t issue_at     = (deadline > _lead_ns) ? deadline - _lead_ns : 0;
+            const uint64_t issue_cycles = to_cycles(issue_at);
+
+            uint64_t now = flexhal::utils::time::cycles_to_ns(now_cycles());
+            if (issue_at > now + sleep_above_ns) {
+                uint64_t sleep_us = (issue_at - now - sleep_margin_ns) / 1000u;
+                while (sleep_us > 0) {
+                    const uint32_t chunk = static_cast<uint32_t>(sleep_us < sleep_chunk_us ? sleep_us : sleep_chunk_us);
+                    flexhal::utils::time::delay_us(chunk);
+                    now_cycles();
+                    sleep_us -= chunk;
+                }
+            }
+            while (now_cycles() < issue_cycles) {
+            }
+            _port.writeMasked(step.mask, step.value);
+
+            last_done           = flexhal::utils::time::cycles_to_ns(now_cycles());
+            const int64_t error = static_cast<int64_t>(last_done) - static_cast<int64_t>(deadline);
+            if (error < min_error) min_error = error;
+            if (error > max_error) max_error = error;
+            abs_sum += static_cast<uint64_t>(error < 0 ? -error : error);
+        }
+    }
+
+    auto clamp32 = [](int64_t v) -> int32_t {
+        return static_cast<int32_t>(v > INT32_MAX ? INT32_MAX : (v < INT32_MIN ? INT32_MIN : v));
+    };
+    const uint64_t total   = static_cast<uint64_t>(count) * repeat;
+    _stats.steps             = static_cast<uint32_t>(total);
+    _stats.duration_ns       = last_done;
+    _stats.min_error_ns      = clamp32(min_error);
+    _stats.max_error_ns      = clamp32(max_error);
+    _stats.mean_abs_error_ns = static_cast<uint32_t>(abs_sum / total);
+    return base::status::ok;
+}
+
+}}} // namespace flexhal::hal::gpio
+
+#endif // FLEXHAL_INTERNAL_HAL_GPIO_WAVEFORMPLAYER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,9 @@
+#pragma once
+
+// I2C bus interfaces.
+// II2c accepts write-then-read register transactions that point to the
+// callers' own buffers; I2cBus schedules everything queued at poll() time
+// as one batch (grouped per device, adjacent register reads merged, joined
+// by repeated starts) and keeps per-device latency statistics.
+#include "i2c/II2c.hpp"
+#include "i2c/I2cBus.hpp"
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "II2c.hpp"
+
+/**
+ * @brief Transactions scheduled together by one pass of I2cBus::poll()
+ *        (more are left for the next pass).
+ */
+#ifndef FLEXHAL_I2C_BATCH_SIZE
+#define FLEXHAL_I2C_BATCH_SIZE 32
+#endif
+
+/**
+ * @brief Largest merged register read, in bytes (the size of the merge buffer).
+ */
+#ifndef FLEXHAL_I2C_MERGE_SIZE
+#define FLEXHAL_I2C_MERGE_SIZE 32
+#endif
+
+/**
+ * @brief Device addresses with their own I2cDeviceStats.
+ */
+#ifndef FLEXHAL_I2C_STATS_DEVICES
+#define FLEXHAL_I2C_STATS_DEVICES 16
+#endif
+
+namespace flexhal { namespace hal { namespace i2c {
+
+/**
+ * @brief II2c implementation shared by the backends: queue, batch scheduler
+ *        and statistics. A backend only implements transferMessage().
+ *
+ * poll() takes everything queued as one batch and:
+ * - groups it by device address (stable: transactions for one device keep
+ *   their submission order, but devices may be reordered),
+ * - merges reads of adjacent registers of one device into a single message
+ *   when every read involved has I2cTransaction::auto_increment (the data
+ *   goes through an internal buffer and is scattered back),
+ * - chains the messages with repeated starts and sends a single STOP at
+ *   the end of the batch (or after a failed message).
+ *
+ * Nothing is allocated. submit() and poll() must be called from the same
+ * context; completion callbacks run from poll().
+ */
+class I2cBus : public II2c {
+public:
+    // --- II2c Interface Implementation ---
+    base::status submit(I2cTransaction& transaction) override;
+    void poll() override;
+    bool isIdle() const override;
+    bool isPolling() const override;
+    const I2cDeviceStats* getDeviceStats(uint16_t address) const override;
+    const I2cBusStats& getBusStats() const override;
+    void resetStats() override;
+    // --- End II2c Interface ---
+
+    /**
+     * @brief Chains the messages of a batch with repeated starts (default).
+     *        Disable for devices or cores that require a STOP after each message.
+     */
+    void setRepeatedStart(bool enable) {
+        _repeated_start = enable;
+    }
+
+    /**
+     * @brief Allows merging adjacent register reads (default).
+     */
+    void setMergeReads(bool enable) {
+        _merge_reads = enable;
+    }
+
+protected:
+    I2cBus();
+
+    /**
+     * @brief Puts one message on the bus: START (or a repeated START if the
+     *        previous message ended without STOP), the address and the write
+     *        phase if write_length > 0, then a repeated START and the read
+     *        phase if read_length > 0, then STOP if stop is set.
+     *
+     * On failure the backend leaves the bus released (STOP sent).
+     * @return status::ok, status::not_found (address NACK), status::io
+     *         (data NACK or short read), or another error.
+     */
+    virtual base::status transferMessage(uint16_t address, const uint8_t* write, size_t write_length, uint8_t* read,
+                                         size_t read_length, bool stop) = 0;
+
+private:
+    bool canMerge(const I2cTransaction& first, const I2cTransaction& last, const I2cTransaction& candidate,
+                  size_t merged_length) const;
+    void runBatch(size_t count);
+    void complete(I2cTransaction& transaction, base::status result, uint64_t now_ns);
+    I2cDeviceStats* findStats(uint16_t address);
+
+    I2cTransaction* _head;
+    I2cTransaction* _tail;
+    I2cTransaction* _batch[FLEXHAL_I2C_BATCH_SIZE];
+    uint8_t _merge[FLEXHAL_I2C_MERGE_SIZE];
+    I2cDeviceStats _stats[FLEXHAL_I2C_STATS_DEVICES];
+    size_t _stats_count;
+    I2cBusStats _bus_stats;
+    bool _repeated_start;
+    bool _merge_reads;
+    bool _polling;
+};
+
+}}} // namespace flexhal::hal::i2c
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_I2C_I2CBUS_IPP
+#define FLEXHAL_INTERNAL_HAL_I2C_I2CBUS_IPP
+
+#include <cstring>
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal { namespace hal { namespace i2c {
+
+I2cBus::I2cBus()
+    : _head(nullptr),
+      _tail(nullptr),
+      _batch(),
+      _merge(),
+      _stats(),
+      _stats_count(0),
+      _bus_stats(),
+      _repeated_start(true),
+      _merge_reads(true),
+      _polling(false)
+{
+}
+
+base::status I2cBus::submit(I2cTransaction& transaction) {
+    if (transaction.address > 0x7F || (transaction.write_length == 0 && transaction.read_length == 0) ||
+        (transaction.write_length > 0 && transaction.write == nullptr) ||
+        (transaction.read_length > 0 && transaction.read == nullptr)) {
+        return base::status::param;
+    }
+    if (transaction.result.load(std::memory_order_relaxed) == base::status::pending) {
+        return base::status::busy;
+    }
+    transaction.result.store(base::status::pending, std::memory_order_relaxed);
+    transaction.submit_ns = flexhal::utils::time::nanos64();
+    transaction.next      = nullptr;
+    if (_tail != nullptr) {
+        _tail->next = &transaction;
+    } else {
+        _head = &transaction;
+    }
+    _tail = &transaction;
+    return base::status::ok;
+}
+
+bool I2cBus::isIdle() const {
+    return _head == nullptr && !_polling;
+}
+
+bool I2cBus::isPolling() const {
+    return _polling;
+}
+
+void I2cBus::poll() {
+    if (_polling) return; // Called again from a callback
+    _polling = true;
+    while (_head != nullptr) {
+        size_t count = 0;
+        while (_head != nullptr && count < FLEXHAL_I2C_BATCH_SIZE) {
+            _batch[count++] = _head;
+            _head           = _head->next;
+        }
+        if (_head == nullptr) _tail = nullptr;
+
+        // Stable insertion sort by address: batches are small and mostly grouped already.
+        for (size_t i = 1; i < count; ++i) {
+            I2cTransaction* item = _batch[i];
+            size_t j             = i;
+            while (j > 0 && _batch[j - 1]->address > item->address) {
+                _batch[j] = _batch[j - 1];
+                --j;
+            }
+            _batch[j] = item;
+        }
+        runBatch(count);
+    }
+    _polling = false;
+}
+
+// candidate continues the register run first..last if it reads the register right after it.
+bool I2cBus::canMerge(const I2cTransaction& first, const I2cTransaction& last, const I2cTransaction& candidate,
+                      size_t merged_length) const {
+    auto is_register_read = [](const I2cTransaction& t) {
+        return (t.flags & I2cTransaction::auto_increment) && t.write_length == 1 && t.read_length > 0;
+    };
+    return _merge_reads && is_register_read(candidate) && is_register_read(first) &&
+           candidate.address == first.address &&
+           static_cast<size_t>(candidate.write[0]) == static_cast<size_t>(last.write[0]) + last.read_length &&
+           merged_length + candidate.read_length <= FLEXHAL_I2C_MERGE_SIZE;
+}
+
+void I2cBus::runBatch(size_t count) {
+    ++_bus_stats.batches;
+    bool bus_open = false; // The previous message ended without STOP
+    size_t i      = 0;
+    while (i < count) {
+        I2cTransaction& first = *_batch[i];
+        size_t end            = i + 1;
+        size_t merged_length  = first.read_length;
+        while (end < count && canMerge(first, *_batch[end - 1], *_batch[end], merged_length)) {
+            merged_length += _batch[end]->read_length;
+            ++end;
+        }
+        const bool stop = (end == count) || !_repeated_start;
+
+        if (bus_open) ++_bus_stats.repeated_starts;
+        ++_bus_stats.messages;
+        base::status result;
+        if (end - i > 1) {
+            result = transferMessage(first.address, first.write, 1, _merge, merged_length, stop);
+            size_t offset = 0;
+            for (size_t k = i; k < end; ++k) {
+                if (result == base::status::ok) {
+                    memcpy(_batch[k]->read, _merge + offset, _batch[k]->read_length);
+                }
+                offset += _batch[k]->read_length;
+            }
+            _bus_stats.merged += static_cast<uint32_t>(end - i - 1);
+        } else {
+            result = transferMessage(first.address, first.write, first.write_length, first.read, first.read_length,
+                                     stop);
+        }
+        // A failed message leaves the bus released, like a STOP.
+        bus_open = !stop && result == base::status::ok;
+        if (!bus_open) ++_bus_stats.stops;
+
+        const uint64_t now = flexhal::utils::time::nanos64();
+        for (size_t k = i; k < end; ++k) {
+            complete(*_batch[k], result, now);
+        }
+        i = end;
+    }
+}
+
+void I2cBus::complete(I2cTransaction& transaction, base::status result, uint64_t now_ns) {
+    if (I2cDeviceStats* stats = findStats(transaction.address)) {
+        const uint64_t latency = now_ns - transaction.submit_ns;
+        const uint32_t clamped = latency > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(latency);
+        if (stats->transactions == 0 || clamped < stats->min_latency_ns) stats->min_latency_ns = clamped;
+        if (clamped > stats->max_latency_ns) stats->max_latency_ns = clamped;
+        ++stats->transactions;
+        if (result != base::status::ok) ++stats->errors;
+        stats->bytes += transaction.write_length + transaction.read_length;
+        stats->total_latency_ns += latency;
+    }
+    if (transaction.callback != nullptr) {
+        transaction.callback(transaction.context, transaction, result);
+    }
+    transaction.result.store(result, std::memory_order_release);
+}
+
+I2cDeviceStats* I2cBus::findStats(uint16_t address) {
+    for (size_t i = 0; i < _stats_count; ++i) {
+        if (_stats[i].address == address) return &_stats[i];
+    }
+    if (_stats_count == FLEXHAL_I2C_STATS_DEVICES) {
+        return nullptr;
+    }
+    I2cDeviceStats& stats = _stats[_stats_count++];
+    stats                 = I2cDeviceStats{address, 0, 0, 0, 0, 0, 0};
+    return &stats;
+}
+
+const I2cDeviceStats* I2cBus::getDeviceStats(uint16_t address) const {
+    for (size_t i = 0; i < _stats_count; ++i) {
+        if (_stats[i].address == address) return &_stats[i];
+    }
+    return nullptr;
+}
+
+const I2cBusStats& I2cBus::getBusStats() const {
+    return _bus_stats;
+}
+
+void I2cBus::resetStats() {
+    _stats_count = 0;
+    _bus_stats   = I2cBusStats();
+}
+
+}}} // namespace flexhal::hal::i2c
+
+#endif // FLEXHAL_INTERNAL_HAL_I2C_I2CBUS_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
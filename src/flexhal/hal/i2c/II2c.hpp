@@ -0,0 +1,204 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+
+namespace flexhal { namespace hal { namespace i2c {
+
+struct I2cTransaction;
+
+/**
+ * @brief Completion callback, run from the driver's poll().
+ *
+ * The descriptor must not be resubmitted or freed from here; it belongs to
+ * the caller again once its result leaves status::pending, right after the
+ * callback returns. Other transactions may be submit()ted from here (they run
+ * in the same poll()); the blocking helpers return status::busy.
+ * @param result status::ok, status::not_found (address not acknowledged),
+ *               status::io (data not acknowledged or short read) or another error.
+ */
+using I2cCallback = void (*)(void* context, I2cTransaction& transaction, base::status result);
+
+/**
+ * @brief One write-then-read message, owned by the caller and queued in place.
+ *
+ * The write phase (typically a register address) is followed, after a
+ * repeated start, by the read phase; either may be empty. Buffers are used
+ * directly and must stay valid until the result is no longer status::pending.
+ */
+struct I2cTransaction {
+    /**
+     * @brief Flag: the device auto-increments its register pointer, so this
+     *        register read (1-byte write + read) may be merged with reads of
+     *        the adjacent registers queued in the same batch.
+     */
+    static constexpr uint32_t auto_increment = 1u << 0;
+
+    uint16_t address      = 0; ///< 7-bit device address.
+    const uint8_t* write  = nullptr;
+    size_t write_length   = 0;
+    uint8_t* read         = nullptr;
+    size_t read_length    = 0;
+    uint32_t flags        = 0;
+    I2cCallback callback  = nullptr;
+    void* context         = nullptr;
+
+    /// status::pending from submit() until completion, then the outcome.
+    std::atomic<base::status> result{base::status::ok};
+
+    uint64_t submit_ns    = 0;       ///< Set by submit(), for the latency statistics.
+    I2cTransaction* next  = nullptr; ///< Queue link, used by the driver.
+
+    bool isDone() const {
+        return result.load(std::memory_order_acquire) != base::status::pending;
+    }
+};
+
+/**
+ * @brief Statistics of one device address, from submit() to completion.
+ */
+struct I2cDeviceStats {
+    uint16_t address;
+    uint32_t transactions;
+    uint32_t errors;
+    uint64_t bytes;            ///< Bytes written and read.
+    uint64_t total_latency_ns; ///< Sum over all transactions (mean = total / transactions).
+    uint32_t min_latency_ns;
+    uint32_t max_latency_ns;
+};
+
+/**
+ * @brief What the scheduler put on the bus.
+ */
+struct I2cBusStats {
+    uint32_t batches;         ///< poll() calls that found work.
+    uint32_t messages;        ///< Address phases started with START or repeated START.
+    uint32_t stops;           ///< STOP conditions (each one costs a bus turnaround).
+    uint32_t repeated_starts; ///< Messages chained to the previous one without a STOP.
+    uint32_t merged;          ///< Transactions folded into a preceding register read.
+};
+
+/**
+ * @brief Interface of an I2C bus master.
+ */
+class II2c {
+public:
+    virtual ~II2c() = default;
+
+    /**
+     * @brief Queues a transaction; it runs at the next poll().
+     * @return status::ok, status::param for an invalid address or an empty
+     *         transaction, or status::busy if the descriptor is still pending.
+     */
+    virtual base::status submit(I2cTransaction& transaction) = 0;
+
+    /**
+     * @brief Executes the queued transactions as one batch. The blocking
+     *        helpers call it while they wait.
+     */
+    virtual void poll() = 0;
+
+    /**
+     * @brief True when no transaction is queued or in progress.
+     */
+    virtual bool isIdle() const = 0;
+
+    /**
+     * @brief True while poll() is running, i.e. inside a completion callback.
+     */
+    virtual bool isPolling() const {
+        return false;
+    }
+
+    /**
+     * @return The statistics of address, or nullptr if it has not been used
+     *         (or the statistics table is full).
+     */
+    virtual const I2cDeviceStats* getDeviceStats(uint16_t address) const = 0;
+
+    virtual const I2cBusStats& getBusStats() const = 0;
+
+    virtual void resetStats() = 0;
+
+    /**
+     * @brief Submits count transactions, which then run in the same batch.
+     * @return status::ok, or the first submit() error (earlier ones stay queued).
+     */
+    base::status submitBatch(I2cTransaction* transactions, size_t count);
+
+    /**
+     * @brief Submits the transaction and polls until it completes.
+     * @return The transaction's result, or status::busy without submitting
+     *         when called from a completion callback (poll() would not run it).
+     */
+    base::status transfer(I2cTransaction& transaction);
+
+    /**
+     * @brief Reads length registers starting at reg (one write-then-read message).
+     *        Like transfer(), returns status::busy from a completion callback.
+     */
+    base::status readRegisters(uint16_t address, uint8_t reg, uint8_t* data, size_t length);
+
+    base::status writeRegister(uint16_t address, uint8_t reg, uint8_t value);
+};
+
+}}} // namespace flexhal::hal::i2c
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_I2C_II2C_IPP
+#define FLEXHAL_INTERNAL_HAL_I2C_II2C_IPP
+
+namespace flexhal { namespace hal { namespace i2c {
+
+base::status II2c::submitBatch(I2cTransaction* transactions, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const base::status result = submit(transactions[i]);
+        if (result != base::status::ok) {
+            return result;
+        }
+    }
+    return base::status::ok;
+}
+
+base::status II2c::transfer(I2cTransaction& transaction) {
+    if (isPolling()) {
+        return base::status::busy;
+    }
+    const base::status submitted = submit(transaction);
+    if (submitted != base::status::ok) {
+        return submitted;
+    }
+    while (!transaction.isDone()) {
+        poll();
+    }
+    return transaction.result.load(std::memory_order_acquire);
+}
+
+base::status II2c::readRegisters(uint16_t address, uint8_t reg, uint8_t* data, size_t length) {
+    I2cTransaction transaction;
+    transaction.address      = address;
+    transaction.write        = &reg;
+    transaction.write_length = 1;
+    transaction.read         = data;
+    transaction.read_length  = length;
+    return transfer(transaction);
+}
+
+base::status II2c::writeRegister(uint16_t address, uint8_t reg, uint8_t value) {
+    const uint8_t bytes[2] = {reg, value};
+    I2cTransaction transaction;
+    transaction.address      = address;
+    transaction.write        = bytes;
+    transaction.write_length = 2;
+    return transfer(transaction);
+}
+
+}}} // namespace flexhal::hal::i2c
+
+#endif // FLEXHAL_INTERNAL_HAL_I2C_II2C_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,6 @@
+#pragma once
+
+// PWM drivers built on the GPIO interfaces.
+// SoftPwm generates PWM on any number of output pins from a single time base,
+// for boards with fewer hardware PWM channels than needed.
+#include "pwm/SoftPwm.hpp"
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/gpio.hpp"
+
+namespace flexhal { namespace hal { namespace pwm {
+
+/**
+ * @brief Software PWM on any number of GPIO pins from a single time base.
+ *
+ * Each period starts with one writeMasked() per port that turns on every
+ * channel with a non-zero duty (and off every channel at 0). The off edges
+ * are precomputed into a schedule sorted by time, in which channels of the
+ * same port ending at the same time share one clearBits(). A period
+ * therefore costs one write per port plus one write per distinct
+ * (duty, port) pair, however many channels there are.
+ *
+ * setDuty() only stores the new value; the schedule is re-sorted once, at
+ * the start of the next period, and only when a duty changed. All arrays
+ * are allocated by the constructor.
+ *
+ * Drive it by calling poll() at least as often as the duty resolution
+ * (from the loop, a TimerThread or a task); poll() returns the time until
+ * the next edge so the caller can sleep in between. Edges are late by the
+ * poll latency, so the effective resolution is bounded by how promptly
+ * poll() is called.
+ */
+class SoftPwm {
+public:
+    /**
+     * @param max_channels Maximum number of channels (pins).
+     * @param period_us PWM period in microseconds.
+     * @param resolution Duty value meaning 100% (duty ranges 0..resolution).
+     */
+    SoftPwm(uint32_t max_channels, uint32_t period_us = 1000, uint32_t resolution = 256);
+
+    SoftPwm(const SoftPwm&)            = delete;
+    SoftPwm& operator=(const SoftPwm&) = delete;
+
+    /**
+     * @brief Adds a pin as a new channel with duty 0. The pin should be an output.
+     * @return The channel index, or a negative base::status value
+     *         (no_memory when all channels are used, param for an invalid pin).
+     */
+    int addChannel(gpio::IPort& port, uint32_t pin_index);
+
+    /**
+     * @brief Sets a channel's duty (clamped to the resolution); applied from the next period.
+     * @return status::ok, or status::param for an invalid channel.
+     */
+    base::status setDuty(uint32_t channel, uint32_t duty);
+
+    uint32_t getDuty(uint32_t channel) const;
+
+    /**
+     * @brief Emits the edges that are due and starts new periods as needed.
+     * @return Microseconds until the next edge.
+     */
+    uint32_t poll();
+
+    /**
+     * @brief Drives all channels low and restarts the period on the next poll().
+     */
+    void stop();
+
+    uint32_t getChannelCount() const {
+        return _channel_count;
+    }
+
+    uint32_t getPeriod_us() const {
+        return _period_us;
+    }
+
+    uint32_t getResolution() const {
+        return _resolution;
+    }
+
+    /**
+     * @brief Port writes issued per period with the current schedule.
+     */
+    uint32_t getWritesPerPeriod() const {
+        return _port_count + _edge_count;
+    }
+
+    /**
+     * @brief Periods started since construction (skipped periods are not counted).
+     */
+    uint32_t getPeriodCount() const {
+        return _periods;
+    }
+
+    /**
+     * @brief Total time spent in poll() calls that wrote to a port (calls
+     *        that found nothing due are not counted), for CPU-share measurements.
+     */
+    uint64_t getBusyTime_ns() const {
+        return _busy_ns;
+    }
+
+private:
+    struct Channel {
+        uint16_t port; // index into _ports
+        uint32_t mask;
+        uint32_t duty;
+    };
+
+    struct Edge {
+        uint64_t offset_ns;
+        uint16_t port;
+        uint32_t mask;
+    };
+
+    void rebuild();
+    void startPeriod();
+
+    std::unique_ptr<Channel[]> _channels;
+    std::unique_ptr<uint32_t[]> _order;  // channel indices sorted by duty
+    std::unique_ptr<Edge[]> _edges;
+    std::unique_ptr<gpio::IPort*[]> _ports;
+    std::unique_ptr<uint32_t[]> _port_masks;    // all channels of each port
+    std::unique_ptr<uint32_t[]> _port_on_masks; // channels driven high at period start
+
+    uint32_t _max_channels;
+    uint32_t _channel_count;
+    uint32_t _port_count;
+    uint32_t _edge_count;
+    uint32_t _next_edge;
+    uint32_t _period_us;
+    uint32_t _resolution;
+    uint64_t _period_start_ns;
+    uint32_t _periods;
+    uint64_t _busy_ns;
+    bool _dirty;
+    bool _running;
+};
+
+}}} // namespace flexhal::hal::pwm
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_PWM_SOFTPWM_IPP
+#define FLEXHAL_INTERNAL_HAL_PWM_SOFTPWM_IPP
+
+#include <algorithm>
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal { namespace hal { namespace pwm {
+
+SoftPwm::SoftPwm(uint32_t max_channels, uint32_t period_us, uint32_t resolution)
+    : _channels(new Channel[max_channels ? max_channels : 1]),
+      _order(new uint32_t[max_channels ? max_channels : 1]),
+      _edges(new Edge[max_channels ? max_channels : 1]),
+      _ports(new gpio::IPort*[max_channels ? max_channels : 1]),
+      _port_masks(new uint32_t[max_channels ? max_channels : 1]),
+      _port_on_masks(new uint32_t[max_channels ? max_channels : 1]),
+      _max_channels(max_channels ? max_channels : 1),
+      _channel_count(0),
+      _port_count(0),
+      _edge_count(0),
+      _next_edge(0),
+      _period_us(period_us ? period_us : 1),
+      _resolution(resolution ? resolution : 1),
+      _period_start_ns(0),
+      _periods(0),
+      _busy_ns(0),
+      _dirty(true),
+      _running(false)
+{
+}
+
+int SoftPwm::addChannel(gpio::IPort& port, uint32_t pin_index) {
+    if (pin_index >= 32 || pin_index >= port.getNumberOfPins()) {
+        return static_cast<int>(base::status::param);
+    }
+    if (_channel_count >= _max_channels) {
+        return static_cast<int>(base::status::no_memory);
+    }
+    uint32_t p = 0;
+    while (p < _port_count && _ports[p] != &port) {
+        ++p;
+    }
+    if (p == _port_count) {
+        _ports[p]      = &port;
+        _port_masks[p] = 0;
+        ++_port_count;
+    }
+    const uint32_t mask = 1u << pin_index;
+    if (_port_masks[p] & mask) {
+        return static_cast<int>(base::status::param); // Pin already used by another channel
+    }
+    _port_masks[p] |= mask;
+    _channels[_channel_count] = Channel{static_cast<uint16_t>(p), mask, 0};
+    _dirty                    = true;
+    return static_cast<int>(_channel_count++);
+}
+
+base::status SoftPwm::setDuty(uint32_t channel, uint32_t duty) {
+    if (channel >= _channel_count) {
+        return base::status::param;
+    }
+    if (duty > _resolution) duty = _resolution;
+    if (_channels[channel].duty != duty) {
+        _channels[channel].duty = duty;
+        _dirty                  = true;
+    }
+    return base::status::ok;
+}
+
+uint32_t SoftPwm::getDuty(uint32_t channel) const {
+    return (channel < _channel_count) ? _channels[channel].duty : 0;
+}
+
+// Sorts the channels by (duty, port) and merges equal neighbours into one edge.
+void SoftPwm::rebuild() {
+    for (uint32_t i = 0; i < _channel_count; ++i) {
+        _order[i] = i;
+    }
+    const Channel* channels = _channels.get();
+    std::sort(_order.get(), _order.get() + _channel_count, [channels](uint32_t a, uint32_t b) {
+        return channels[a].duty != channels[b].duty ? channels[a].duty < channels[b].duty
+                                                    : channels[a].port < channels[b].port;
+    });
+
+    for (uint32_t p = 0; p < _port_count; ++p) {
+        _port_on_masks[p] = 0;
+    }
+    const uint64_t period_ns = static_cast<uint64_t>(_period_us) * 1000u;
+    _edge_count              = 0;
+    for (uint32_t i = 0; i < _channel_count; ++i) {
+        const Channel& ch = channels[_order[i]];
+        if (ch.duty == 0) continue; // stays low
+        _port_on_masks[ch.port] |= ch.mask;
+        if (ch.duty >= _resolution) continue; // stays high
+        const uint64_t offset = period_ns * ch.duty / _resolution;
+        if (_edge_count > 0 && _edges[_edge_count - 1].offset_ns == offset && _edges[_edge_count - 1].port == ch.port) {
+            _edges[_edge_count - 1].mask |= ch.mask;
+        } else {
+            _edges[_edge_count++] = Edge{offset, ch.port, ch.mask};
+        }
+    }
+    _dirty = false;
+}
+
+void SoftPwm::startPeriod() {
+    if (_dirty) {
+        rebuild();
+    }
+    for (uint32_t p = 0; p < _port_count; ++p) {
+        _ports[p]->writeMasked(_port_masks[p], _port_on_masks[p]);
+    }
+    _next_edge = 0;
+    ++_periods;
+}
+
+uint32_t SoftPwm::poll() {
+    const uint64_t entry = flexhal::utils::time::nanos64();
+    const uint64_t period_ns = static_cast<uint64_t>(_period_us) * 1000u;
+    const uint32_t periods   = _periods;
+    const uint32_t next_edge = _next_edge;
+    uint64_t now             = entry;
+
+    if (!_running) {
+        _running         = true;
+        _period_start_ns = now;
+        startPeriod();
+    } else if (now - _period_start_ns >= period_ns) {
+        // Finish the edges of the period that just ended, then align to the period grid.
+        while (_next_edge < _edge_count) {
+            const Edge& edge = _edges[_next_edge++];
+            _ports[edge.port]->clearBits(edge.mask);
+        }
+        _period_start_ns += ((now - _period_start_ns) / period_ns) * period_ns;
+        startPeriod();
+        now = flexhal::utils::time::nanos64();
+    }
+
+    const uint64_t elapsed = now - _period_start_ns;
+    while (_next_edge < _edge_count && _edges[_next_edge].offset_ns <= elapsed) {
+        const Edge& edge = _edges[_next_edge++];
+        _ports[edge.port]->clearBits(edge.mask);
+    }
+
+    const uint64_t next = (_next_edge < _edge_count) ? _edges[_next_edge].offset_ns : period_ns;
+    if (_periods != periods || _next_edge != next_edge) {
+        _busy_ns += flexhal::utils::time::nanos64() - entry;
+    }
+    return static_cast<uint32_t>((next > elapsed ? next - elapsed : 0) / 1000u);
+}
+
+void SoftPwm::stop() {
+    for (uint32_t p = 0; p < _port_count; ++p) {
+        _ports[p]->clearBits(_port_masks[p]);
+    }
+    _running   = false;
+    _next_edge = 0;
+}
+
+}}} // namespace flexhal::hal::pwm
+
+#endif // FLEXHAL_INTERNAL_HAL_PWM_SOFTPWM_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,8 @@
+#pragma once
+
+// SPI bus interfaces.
+// ISpi executes queued transactions that point to the callers' own buffers,
+// back to back with chip-select handling, and signals completion through a
+// callback, a status poll or (with C++20) `co_await spi.transferAsync(t)`.
+#include "spi/ISpi.hpp"
+#include "spi/SpiQueue.hpp"
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/gpio/IPin.hpp"
+#include "flexhal/utils/task.hpp" // For the awaitable (C++20 only)
+
+namespace flexhal { namespace hal { namespace spi {
+
+/**
+ * @brief Clock polarity / phase (CPOL, CPHA) as numbered by most datasheets.
+ */
+enum class SpiMode : uint8_t { Mode0, Mode1, Mode2, Mode3 };
+
+enum class SpiBitOrder : uint8_t { MsbFirst, LsbFirst };
+
+/**
+ * @brief Bus settings and chip select of one device on the bus.
+ *
+ * Transactions refer to their device by pointer, so one SpiDevice is
+ * shared by all transactions for that device.
+ */
+struct SpiDevice {
+    uint32_t clock_hz     = 1000000;
+    SpiMode mode          = SpiMode::Mode0;
+    SpiBitOrder bit_order = SpiBitOrder::MsbFirst;
+    gpio::IPin* cs        = nullptr; ///< Chip select driven by the driver (nullptr: none, or managed by the caller).
+    bool cs_active_high   = false;
+    uint8_t fill          = 0xFF;    ///< Byte sent by transactions without a tx buffer.
+};
+
+struct SpiTransaction;
+
+/**
+ * @brief Completion callback, run in the driver's context (thread, interrupt or poll()).
+ *
+ * The descriptor still belongs to the driver while the callback runs: it
+ * must not be resubmitted or freed from here. Ownership returns to the
+ * caller when the transaction's result leaves status::pending, right after
+ * the callback returns.
+ */
+using SpiCallback = void (*)(void* context, SpiTransaction& transaction, base::status result);
+
+/**
+ * @brief Descriptor of one transfer, owned by the caller and queued in place.
+ *
+ * Nothing is copied: the driver reads tx and writes rx directly, so both
+ * buffers, like the descriptor itself, must stay valid until the result is
+ * no longer status::pending.
+ */
+struct SpiTransaction {
+    /**
+     * @brief Flag: leave CS asserted after this transaction, so that the next
+     *        one (for the same device) continues the same frame, e.g. a
+     *        command followed by its data.
+     */
+    static constexpr uint32_t keep_cs = 1u << 0;
+
+    const SpiDevice* device = nullptr;
+    const uint8_t* tx       = nullptr; ///< Bytes to send, or nullptr to send device->fill.
+    uint8_t* rx             = nullptr; ///< Received bytes, or nullptr to discard them.
+    size_t length           = 0;
+    uint32_t flags          = 0;
+    SpiCallback callback    = nullptr;
+    void* context           = nullptr;
+
+    /// status::pending from submit() until completion, then the outcome.
+    std::atomic<base::status> result{base::status::ok};
+
+    SpiTransaction* next = nullptr; ///< Queue link, used by the driver.
+
+    bool isDone() const {
+        return result.load(std::memory_order_acquire) != base::status::pending;
+    }
+};
+
+class ISpi;
+
+/**
+ * @brief Returned by ISpi::transferAsync(); `co_await` it inside a Task.
+ */
+struct SpiTransferWait {
+    ISpi* spi;
+    SpiTransaction* transaction;
+};
+
+/**
+ * @brief Interface of an SPI bus master.
+ *
+ * Transactions are executed in submission order, back to back. CS is
+ * asserted before a transaction and released after it unless it has
+ * SpiTransaction::keep_cs (it is also released before switching to
+ * another device).
+ */
+class ISpi {
+public:
+    virtual ~ISpi() = default;
+
+    /**
+     * @brief Queues a transaction and returns immediately.
+     * @return status::ok, status::param if the device is null or the length
+     *         is 0, or status::busy if the descriptor is still pending.
+     */
+    virtual base::status submit(SpiTransaction& transaction) = 0;
+
+    /**
+     * @brief Executes queued transactions, for drivers that have no thread or
+     *        DMA of their own (otherwise it only lets them make progress).
+     *        The blocking and awaitable transfers call it while they wait.
+     */
+    virtual void poll() {
+    }
+
+    /**
+     * @brief True when no transaction is queued or in progress.
+     */
+    virtual bool isIdle() const = 0;
+
+    /**
+     * @brief Submits the transaction and waits for it to complete.
+     * @return The transaction's result, or the error from submit().
+     */
+    base::status transfer(SpiTransaction& transaction);
+
+    /**
+     * @brief Blocking full-duplex transfer on a temporary descriptor.
+     */
+    base::status transfer(const SpiDevice& device, const uint8_t* tx, uint8_t* rx, size_t length);
+
+    /**
+     * @brief `co_await spi.transferAsync(t)` submits t and resumes the task
+     *        with its result once it completes.
+     */
+    SpiTransferWait transferAsync(SpiTransaction& transaction) {
+        return SpiTransferWait{this, &transaction};
+    }
+};
+
+#if FLEXHAL_INTERNAL_TASK
+
+/**
+ * @brief Awaitable for `co_await spi.transferAsync(t)`.
+ *
+ * The executor polls the transaction (and the driver) while the task is
+ * suspended, like it polls pins for edges.
+ */
+struct SpiTransferAwaiter {
+    ISpi* spi;
+    SpiTransaction* transaction;
+    base::status submitted;
+    utils::task::PollAwaiter waiter;
+
+    bool await_ready() {
+        submitted = spi->submit(*transaction);
+        return submitted != base::status::ok || transaction->isDone();
+    }
+    void await_suspend(std::coroutine_handle<> awaiting) {
+        waiter = utils::task::poll_until(&SpiTransferAwaiter::ready, this);
+        waiter.await_suspend(awaiting);
+    }
+    base::status await_resume() const {
+        return submitted != base::status::ok ? submitted : transaction->result.load(std::memory_order_acquire);
+    }
+
+    static bool ready(void* context) {
+        SpiTransferAwaiter* self = static_cast<SpiTransferAwaiter*>(context);
+        self->spi->poll();
+        return self->transaction->isDone();
+    }
+};
+
+// Found by argument-dependent lookup, which makes `co_await spi.transferAsync(t)` work.
+inline SpiTransferAwaiter operator co_await(SpiTransferWait wait) noexcept {
+    return SpiTransferAwaiter{wait.spi, wait.transaction, base::status::ok, {}};
+}
+
+#endif // FLEXHAL_INTERNAL_TASK
+
+}}} // namespace flexhal::hal::spi
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_SPI_ISPI_IPP
+#define FLEXHAL_INTERNAL_HAL_SPI_ISPI_IPP
+
+namespace flexhal { namespace hal { namespace spi {
+
+base::status ISpi::transfer(SpiTransaction& transaction) {
+    const base::status submitted = submit(transaction);
+    if (submitted != base::status::ok) {
+        return submitted;
+    }
+    while (!transaction.isDone()) {
+        poll();
+    }
+    return transaction.result.load(std::memory_order_acquire);
+}
+
+base::status ISpi::transfer(const SpiDevice& device, const uint8_t* tx, uint8_t* rx, size_t length) {
+    SpiTransaction transaction;
+    transaction.device = &device;
+    transaction.tx     = tx;
+    transaction.rx     = rx;
+    transaction.length = length;
+    return transfer(transaction);
+}
+
+}}} // namespace flexhal::hal::spi
+
+#endif // FLEXHAL_INTERNAL_HAL_SPI_ISPI_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ISpi.hpp"
+
+namespace flexhal { namespace hal { namespace spi {
+
+/**
+ * @brief Intrusive FIFO of SpiTransactions, linked through SpiTransaction::next.
+ *
+ * Queuing never allocates: the descriptors are the nodes. Not thread safe;
+ * drivers that submit and execute from different contexts lock around it.
+ */
+class SpiQueue {
+public:
+    void push(SpiTransaction& transaction) {
+        transaction.next = nullptr;
+        if (_tail != nullptr) {
+            _tail->next = &transaction;
+        } else {
+            _head = &transaction;
+        }
+        _tail = &transaction;
+        ++_size;
+    }
+
+    /**
+     * @return The oldest transaction, or nullptr if the queue is empty.
+     */
+    SpiTransaction* pop() {
+        SpiTransaction* transaction = _head;
+        if (transaction != nullptr) {
+            _head = transaction->next;
+            if (_head == nullptr) _tail = nullptr;
+            transaction->next = nullptr;
+            --_size;
+        }
+        return transaction;
+    }
+
+    SpiTransaction* front() const {
+        return _head;
+    }
+
+    bool empty() const {
+        return _head == nullptr;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+private:
+    SpiTransaction* _head = nullptr;
+    SpiTransaction* _tail = nullptr;
+    size_t _size          = 0;
+};
+
+}}} // namespace flexhal::hal::spi
@@ -0,0 +1,10 @@
+#pragma once
+
+// UART (serial stream) interfaces.
+// IUart receives into a lock-free ring that is read in place through
+// contiguous views, and queues scatter-gather writes into a transmit ring
+// without blocking. UartLogger is a non-blocking logger sink on top of it.
+#include "uart/ByteRing.hpp"
+#include "uart/IUart.hpp"
+#include "uart/BufferedUart.hpp"
+#include "uart/UartLogger.hpp"
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "ByteRing.hpp"
+#include "IUart.hpp"
+
+namespace flexhal { namespace hal { namespace uart {
+
+/**
+ * @brief IUart implementation shared by the backends: a receive and a
+ *        transmit ByteRing, filled and drained by pump(). A backend only
+ *        implements the non-blocking receive() and transmit().
+ *
+ * pump() is the producer of the receive ring and the consumer of the
+ * transmit ring, so it may run on another thread (or an interrupt) than the
+ * application without locks. By default poll() calls it.
+ */
+class BufferedUart : public IUart {
+public:
+    // --- IUart Interface Implementation ---
+    void poll() override;
+    size_t available() const override;
+    ByteView peek() const override;
+    size_t peek(ByteView views[2]) const override;
+    void consume(size_t length) override;
+    size_t getWriteSpace() const override;
+    base::status writev(const ByteView* parts, size_t count) override;
+    bool isWriteIdle() const override;
+    // --- End IUart Interface ---
+
+protected:
+    BufferedUart(size_t rx_capacity, size_t tx_capacity);
+
+    /**
+     * @brief Moves bytes between the hardware and the rings until neither side makes progress.
+     * @return true if any byte moved.
+     */
+    bool pump();
+
+    /**
+     * @brief Reads up to length received bytes without blocking.
+     * @return Bytes read (0 if none are pending).
+     */
+    virtual size_t receive(uint8_t* data, size_t length) = 0;
+
+    /**
+     * @brief Hands up to length bytes to the hardware without blocking.
+     * @return Bytes accepted (0 if it cannot take more right now).
+     */
+    virtual size_t transmit(const uint8_t* data, size_t length) = 0;
+
+private:
+    ByteRing _rx;
+    ByteRing _tx;
+};
+
+}}} // namespace flexhal::hal::uart
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_UART_BUFFEREDUART_IPP
+#define FLEXHAL_INTERNAL_HAL_UART_BUFFEREDUART_IPP
+
+#include "flexhal/utils/trace.hpp"
+
+namespace flexhal { namespace hal { namespace uart {
+
+BufferedUart::BufferedUart(size_t rx_capacity, size_t tx_capacity) : _rx(rx_capacity), _tx(tx_capacity)
+{
+}
+
+void BufferedUart::poll() {
+    pump();
+}
+
+bool BufferedUart::pump() {
+    FLEXHAL_TRACE_SCOPE("uart.pump");
+    bool moved = false;
+    for (;;) {
+        const MutableByteView free = _rx.writeView();
+        if (free.size == 0) break; // Full: the rest waits in the hardware / OS buffer
+        const size_t count = receive(free.data, free.size);
+        if (count == 0) break;
+        _rx.commit(count);
+        moved = true;
+    }
+    for (;;) {
+        const ByteView queued = _tx.readView();
+        if (queued.size == 0) break;
+        const size_t count = transmit(queued.data, queued.size);
+        if (count == 0) break;
+        _tx.consume(count);
+        moved = true;
+    }
+    return moved;
+}
+
+size_t BufferedUart::available() const {
+    return _rx.size();
+}
+
+ByteView BufferedUart::peek() const {
+    return _rx.readView();
+}
+
+size_t BufferedUart::peek(ByteView views[2]) const {
+    return _rx.readViews(views);
+}
+
+void BufferedUart::consume(size_t length) {
+    const size_t filled = _rx.size();
+    _rx.consume(length < filled ? length : filled);
+}
+
+size_t BufferedUart::getWriteSpace() const {
+    return _tx.space();
+}
+
+base::status BufferedUart::writev(const ByteView* parts, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += parts[i].size;
+    }
+    if (total > _tx.capacity()) {
+        return base::status::param;
+    }
+    if (total > _tx.space()) {
+        return base::status::busy;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        _tx.write(parts[i].data, parts[i].size);
+    }
+    return base::status::ok;
+}
+
+bool BufferedUart::isWriteIdle() const {
+    return _tx.empty();
+}
+
+}}} // namespace flexhal::hal::uart
+
+#endif // FLEXHAL_INTERNAL_HAL_UART_BUFFEREDUART_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace flexhal { namespace hal { namespace uart {
+
+/**
+ * @brief Read-only view of contiguous bytes (a minimal span).
+ */
+struct ByteView {
+    const uint8_t* data = nullptr;
+    size_t size         = 0;
+};
+
+/**
+ * @brief Writable view of contiguous bytes.
+ */
+struct MutableByteView {
+    uint8_t* data = nullptr;
+    size_t size   = 0;
+};
+
+/**
+ * @brief Lock-free single-producer / single-consumer byte ring.
+ *
+ * The producer (e.g. a receive interrupt or thread) and the consumer may run
+ * concurrently without locks; each side only writes its own index. Besides
+ * copying read() / write(), both sides can work in place: readView() returns
+ * the filled bytes up to the wrap point and consume() releases them, while
+ * writeView() / commit() let a driver receive straight into the ring.
+ *
+ * The capacity is rounded up to a power of two and allocated once by the
+ * constructor.
+ */
+class ByteRing {
+public:
+    explicit ByteRing(size_t capacity);
+
+    ByteRing(const ByteRing&)            = delete;
+    ByteRing& operator=(const ByteRing&) = delete;
+
+    size_t capacity() const {
+        return _mask + 1;
+    }
+
+    /**
+     * @brief Bytes ready to be read (exact for the consumer, a lower bound for the producer).
+     */
+    size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Bytes that can be written (exact for the producer, a lower bound for the consumer).
+     */
+    size_t space() const {
+        return capacity() - size();
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // --- Producer side ---
+
+    /**
+     * @brief Free space contiguous from the write position (may be shorter
+     *        than space() when it wraps).
+     */
+    MutableByteView writeView();
+
+    /**
+     * @brief Publishes length bytes written into writeView().
+     */
+    void commit(size_t length);
+
+    /**
+     * @brief Copies as much of data as fits.
+     * @return Bytes written.
+     */
+    size_t write(const uint8_t* data, size_t length);
+
+    // --- Consumer side ---
+
+    /**
+     * @brief Filled bytes contiguous from the read position (may be shorter
+     *        than size() when they wrap; read the rest after consume()).
+     */
+    ByteView readView() const;
+
+    /**
+     * @brief Both filled regions: views[0] from the read position, views[1]
+     *        the wrapped part (empty if none).
+     * @return The number of non-empty views (0 to 2).
+     */
+    size_t readViews(ByteView views[2]) const;
+
+    /**
+     * @brief Releases length bytes from the read position.
+     */
+    void consume(size_t length);
+
+    /**
+     * @brief Copies up to length bytes out and consumes them.
+     * @return Bytes read.
+     */
+    size_t read(uint8_t* data, size_t length);
+
+private:
+    std::unique_ptr<uint8_t[]> _storage;
+    size_t _mask;
+    alignas(64) std::atomic<size_t> _head; // Total bytes written (producer)
+    alignas(64) std::atomic<size_t> _tail; // Total bytes read (consumer)
+};
+
+}}} // namespace flexhal::hal::uart
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_UART_BYTERING_IPP
+#define FLEXHAL_INTERNAL_HAL_UART_BYTERING_IPP
+
+#include <cstring>
+
+#include "flexhal/utils/heap.hpp"
+
+namespace flexhal { namespace hal { namespace uart {
+
+ByteRing::ByteRing(size_t capacity) : _mask(0), _head(0), _tail(0)
+{
+    size_t rounded = 2;
+    while (rounded < capacity) rounded <<= 1;
+    _mask = rounded - 1;
+    FLEXHAL_HEAP_SCOPE("uart");
+    _storage.reset(new uint8_t[rounded]);
+}
+
+MutableByteView ByteRing::writeView() {
+    const size_t head   = _head.load(std::memory_order_relaxed);
+    const size_t tail   = _tail.load(std::memory_order_acquire);
+    const size_t offset = head & _mask;
+    const size_t free   = capacity() - (head - tail);
+    const size_t run    = capacity() - offset;
+    return MutableByteView{_storage.get() + offset, free < run ? free : run};
+}
+
+void ByteRing::commit(size_t length) {
+    _head.store(_head.load(std::memory_order_relaxed) + length, std::memory_order_release);
+}
+
+size_t ByteRing::write(const uint8_t* data, size_t length) {
+    size_t written = 0;
+    while (written < length) {
+        const MutableByteView view = writeView();
+        if (view.size == 0) break;
+        const size_t chunk = (length - written) < view.size ? (length - written) : view.size;
+        memcpy(view.data, data + written, chunk);
+        commit(chunk);
+        written += chunk;
+    }
+    return written;
+}
+
+ByteView ByteRing::readView() const {
+    const size_t tail   = _tail.load(std::memory_order_relaxed);
+    const size_t head   = _head.load(std::memory_order_acquire);
+    const size_t offset = tail & _mask;
+    const size_t filled = head - tail;
+    const size_t run    = capacity() - offset;
+    return ByteView{_storage.get() + offset, filled < run ? filled : run};
+}
+
+size_t ByteRing::readViews(ByteView views[2]) const {
+    const size_t tail   = _tail.load(std::memory_order_relaxed);
+    const size_t head   = _head.load(std::memory_order_acquire);
+    const size_t offset = tail & _mask;
+    const size_t filled = head - tail;
+    const size_t run    = capacity() - offset;
+    views[0] = ByteView{_storage.get() + offset, filled < run ? filled : run};
+    views[1] = ByteView{_storage.get(), filled > run ? filled - run : 0};
+    return (views[0].size != 0) + (views[1].size != 0);
+}
+
+void ByteRing::consume(size_t length) {
+    _tail.store(_tail.load(std::memory_order_relaxed) + length, std::memory_order_release);
+}
+
+size_t ByteRing::read(uint8_t* data, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        const ByteView view = readView();
+        if (view.size == 0) break;
+        const size_t chunk = (length - count) < view.size ? (length - count) : view.size;
+        memcpy(data + count, view.data, chunk);
+        consume(chunk);
+        count += chunk;
+    }
+    return count;
+}
+
+}}} // namespace flexhal::hal::uart
+
+#endif // FLEXHAL_INTERNAL_HAL_UART_BYTERING_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "ByteRing.hpp"
+
+namespace flexhal { namespace hal { namespace uart {
+
+/**
+ * @brief Interface of a buffered serial port.
+ *
+ * Received bytes collect in a receive buffer that is read in place:
+ * peek() returns the contiguous bytes at its front and consume() releases
+ * them, so a parser can work on the driver's memory without copying.
+ * Writes are queued whole into a transmit buffer and never block.
+ *
+ * The reading side and the writing side may each be used from one context
+ * (they may differ). poll() moves bytes between the hardware and the
+ * buffers for drivers that are not interrupt or thread driven.
+ */
+class IUart {
+public:
+    virtual ~IUart() = default;
+
+    /**
+     * @brief Moves received bytes into the receive buffer and queued bytes
+     *        out to the hardware, without blocking.
+     */
+    virtual void poll() = 0;
+
+    // --- Receive ---
+
+    /**
+     * @brief Bytes in the receive buffer.
+     */
+    virtual size_t available() const = 0;
+
+    /**
+     * @brief Contiguous received bytes at the front of the buffer (possibly
+     *        fewer than available() when they wrap). Valid until consume().
+     */
+    virtual ByteView peek() const = 0;
+
+    /**
+     * @brief All received bytes as up to two views (the second one is the wrapped part).
+     * @return The number of non-empty views.
+     */
+    virtual size_t peek(ByteView views[2]) const = 0;
+
+    /**
+     * @brief Releases length bytes (at most available()) from the front.
+     */
+    virtual void consume(size_t length) = 0;
+
+    // --- Transmit ---
+
+    /**
+     * @brief Free space in the transmit buffer.
+     */
+    virtual size_t getWriteSpace() const = 0;
+
+    /**
+     * @brief Queues the concatenation of count buffers, entirely or not at all.
+     * @return status::ok, status::busy if it does not fit right now, or
+     *         status::param if it can never fit.
+     */
+    virtual base::status writev(const ByteView* parts, size_t count) = 0;
+
+    /**
+     * @brief True when the transmit buffer is empty.
+     */
+    virtual bool isWriteIdle() const = 0;
+
+    /**
+     * @brief Copies up to length received bytes out and consumes them.
+     * @return Bytes read.
+     */
+    size_t read(uint8_t* data, size_t length);
+
+    /**
+     * @brief Queues length bytes, entirely or not at all (see writev()).
+     */
+    base::status write(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Polls until the transmit buffer is empty.
+     * @return status::ok, or status::timeout.
+     */
+    base::status flush(uint32_t timeout_ms = 1000);
+};
+
+}}} // namespace flexhal::hal::uart
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_UART_IUART_IPP
+#define FLEXHAL_INTERNAL_HAL_UART_IUART_IPP
+
+#include <cstring>
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal { namespace hal { namespace uart {
+
+size_t IUart::read(uint8_t* data, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        const ByteView view = peek();
+        if (view.size == 0) break;
+        const size_t chunk = (length - count) < view.size ? (length - count) : view.size;
+        memcpy(data + count, view.data, chunk);
+        consume(chunk);
+        count += chunk;
+    }
+    return count;
+}
+
+base::status IUart::write(const uint8_t* data, size_t length) {
+    const ByteView part{data, length};
+    return writev(&part, 1);
+}
+
+base::status IUart::flush(uint32_t timeout_ms) {
+    const uint64_t start = flexhal::utils::time::micros64();
+    while (!isWriteIdle()) {
+        if (flexhal::utils::time::micros64() - start >= static_cast<uint64_t>(timeout_ms) * 1000u) {
+            return base::status::timeout;
+        }
+        poll();
+    }
+    return base::status::ok;
+}
+
+}}} // namespace flexhal::hal::uart
+
+#endif // FLEXHAL_INTERNAL_HAL_UART_IUART_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/utils/logger.hpp"
+#include "IUart.hpp"
+
+namespace flexhal { namespace hal { namespace uart {
+
+/**
+ * @brief Logger that queues "[L] [tag] message\n" lines into an IUart
+ *        instead of printing them.
+ *
+ * log() formats on the caller's stack and hands the prefix, the message and
+ * the newline to IUart::writev() as one scatter-gather write: a line is
+ * queued whole or, when the transmit buffer is full, dropped and counted
+ * (getDroppedCount()). It never blocks. flush() waits for the queued lines
+ * to leave.
+ *
+ * The UART's writing side is single-context, so log from one thread, or put
+ * an AsyncLogger in front of it when several threads log.
+ */
+class UartLogger : public flexhal::utils::logger::ILogger {
+public:
+    /// Longest message; longer ones are truncated.
+    static constexpr size_t MESSAGE_BYTES = 192;
+
+    explicit UartLogger(IUart& uart);
+
+    // --- ILogger Interface Implementation ---
+    void log(flexhal::utils::logger::LogLevel level, const char* tag, const char* format,
+             std::va_list args) override;
+    void flush() override;
+    // --- End ILogger Interface ---
+
+    /**
+     * @brief Lines dropped because the transmit buffer was full.
+     */
+    uint32_t getDroppedCount() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    IUart& _uart;
+    std::atomic<uint32_t> _dropped;
+};
+
+}}} // namespace flexhal::hal::uart
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_HAL_UART_UARTLOGGER_IPP
+#define FLEXHAL_INTERNAL_HAL_UART_UARTLOGGER_IPP
+
+#include <cstdio>
+
+namespace flexhal { namespace hal { namespace uart {
+
+UartLogger::UartLogger(IUart& uart) : _uart(uart), _dropped(0)
+{
+}
+
+void UartLogger::log(flexhal::utils::logger::LogLevel level, const char* tag, const char* format,
+                     std::va_list args) {
+    static const char level_chars[] = {'N', 'E', 'W', 'I', 'D', 'V'};
+    const size_t index = static_cast<size_t>(level);
+
+    char prefix[48];
+    int prefix_length = snprintf(prefix, sizeof(prefix), "[%c] [%s] ",
+                                 index < sizeof(level_chars) ? level_chars[index] : '?', tag ? tag : "");
+    if (prefix_length < 0) prefix_length = 0;
+    if (static_cast<size_t>(prefix_length) >= sizeof(prefix)) prefix_length = sizeof(prefix) - 1;
+
+    char message[MESSAGE_BYTES];
+    std::va_list copy;
+    va_copy(copy, args);
+    int message_length = vsnprintf(message, sizeof(message), format, copy);
+    va_end(copy);
+    if (message_length < 0) message_length = 0;
+    if (static_cast<size_t>(message_length) >= sizeof(message)) message_length = sizeof(message) - 1;
+
+    static const uint8_t newline = '\n';
+    const ByteView parts[3] = {
+        {reinterpret_cast<const uint8_t*>(prefix), static_cast<size_t>(prefix_length)},
+        {reinterpret_cast<const uint8_t*>(message), static_cast<size_t>(message_length)},
+        {&newline, 1},
+    };
+    if (_uart.writev(parts, 3) != base::status::ok) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void UartLogger::flush() {
+    _uart.flush();
+}
+
+}}} // namespace flexhal::hal::uart
+
+#endif // FLEXHAL_INTERNAL_HAL_UART_UARTLOGGER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
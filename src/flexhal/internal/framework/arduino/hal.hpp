@@ -2,6 +2,10 @@
 
 // Include HAL module headers for Arduino
 #include "hal/gpio.hpp" // Include GPIO HAL module
+#include "hal/adc.hpp"  // Include ADC HAL module (analogRead based)
+#include "hal/spi.hpp"  // Include SPI HAL module (SPI library based)
+#include "hal/i2c.hpp"  // Include I2C HAL module (Wire library based)
+#include "hal/uart.hpp" // Include UART HAL module (Stream based)
 
-// If other HAL modules for Arduino (like SPI, I2C) are added later,
-// include their respective headers (e.g., "hal/spi.hpp") here.
+// If other HAL modules for Arduino are added later,
+// include their respective headers here.
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstdint>
+#include <Arduino.h> // For analogRead()
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/adc.hpp"
+
+// analogRead() returns 12-bit values on the ESP32 family and 10-bit values on most other cores.
+#if defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
+ #define FLEXHAL_INTERNAL_ARDUINO_ADC_BITS 12
+#else
+ #define FLEXHAL_INTERNAL_ARDUINO_ADC_BITS 10
+#endif
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace adc {
+
+/**
+ * @brief IAdc on top of Arduino's analogRead(); channels are Arduino pin numbers (A0, ...).
+ *
+ * The portable core has no DMA or timer-triggered conversion, so continuous
+ * acquisition is timed in software: poll() converts one scan whenever its
+ * time has come, directly into the caller's buffer, and fires the half/full
+ * callbacks from poll(). When poll() is late by more than a scan period, the
+ * missed scans are skipped and counted as overruns, so the scans in the
+ * buffer stay on the scan-rate grid.
+ */
+class ArduinoAdc : public flexhal::hal::adc::IAdc {
+public:
+    /**
+     * @param resolution_bits Resolution analogRead() is configured for
+     *        (e.g. after analogReadResolution()).
+     */
+    explicit ArduinoAdc(uint8_t resolution_bits = FLEXHAL_INTERNAL_ARDUINO_ADC_BITS);
+
+    // --- IAdc Interface Implementation ---
+    uint32_t getNumberOfChannels() const override;
+    uint8_t getResolutionBits() const override;
+    base::status readScan(const flexhal::hal::adc::ScanGroup& group, flexhal::hal::adc::sample_t* out) override;
+    base::status startContinuous(const flexhal::hal::adc::ScanGroup& group,
+                                 const flexhal::hal::adc::ContinuousConfig& config) override;
+    void stopContinuous() override;
+    bool isContinuousRunning() const override;
+    void poll() override;
+    uint32_t getOverrunCount() const override;
+    // --- End IAdc Interface ---
+
+private:
+    void scan(flexhal::hal::adc::sample_t* out) const;
+
+    uint8_t _resolution_bits;
+    flexhal::hal::adc::ScanGroup _group;
+    flexhal::hal::adc::ScanBuffer _buffer;
+    uint64_t _next_us;
+    uint32_t _period_us;
+    uint32_t _overruns;
+    bool _running;
+};
+
+} // namespace adc
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_ADC_ARDUINOADC_IPP
+#define FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_ADC_ARDUINOADC_IPP
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace adc {
+
+inline ArduinoAdc::ArduinoAdc(uint8_t resolution_bits)
+    : _resolution_bits(resolution_bits),
+      _group(),
+      _buffer(),
+      _next_us(0),
+      _period_us(0),
+      _overruns(0),
+      _running(false)
+{
+}
+
+inline uint32_t ArduinoAdc::getNumberOfChannels() const {
+#if defined(NUM_DIGITAL_PINS)
+    return NUM_DIGITAL_PINS;
+#else
+    return 256; // analogRead() takes a uint8_t pin number
+#endif
+}
+
+inline uint8_t ArduinoAdc::getResolutionBits() const {
+    return _resolution_bits;
+}
+
+inline uint32_t ArduinoAdc::getOverrunCount() const {
+    return _overruns;
+}
+
+inline bool ArduinoAdc::isContinuousRunning() const {
+    return _running;
+}
+
+inline void ArduinoAdc::scan(flexhal::hal::adc::sample_t* out) const {
+    const uint32_t oversampling = _group.oversampling ? _group.oversampling : 1;
+    for (uint32_t i = 0; i < _group.channel_count; ++i) {
+        const uint8_t pin = static_cast<uint8_t>(_group.channels[i]);
+        uint32_t sum      = 0;
+        for (uint32_t j = 0; j < oversampling; ++j) {
+            sum += static_cast<uint32_t>(::analogRead(pin));
+        }
+        out[i] = flexhal::hal::adc::average_samples(sum, oversampling);
+    }
+}
+
+inline base::status ArduinoAdc::readScan(const flexhal::hal::adc::ScanGroup& group, flexhal::hal::adc::sample_t* out) {
+    if (out == nullptr || flexhal::hal::adc::check_scan_group(group, getNumberOfChannels()) != base::status::ok) {
+        return base::status::param;
+    }
+    if (_running) {
+        return base::status::busy;
+    }
+    _group = group;
+    scan(out);
+    return base::status::ok;
+}
+
+inline base::status ArduinoAdc::startContinuous(const flexhal::hal::adc::ScanGroup& group,
+                                                const flexhal::hal::adc::ContinuousConfig& config) {
+    if (flexhal::hal::adc::check_scan_group(group, getNumberOfChannels()) != base::status::ok) {
+        return base::status::param;
+    }
+    if (_running) {
+        return base::status::busy;
+    }
+    if (_buffer.reset(config, group.channel_count) != base::status::ok) {
+        return base::status::param;
+    }
+    _group     = group;
+    _period_us = 1000000u / config.scan_rate_hz;
+    if (_period_us == 0) _period_us = 1;
+    _overruns = 0;
+    _next_us  = flexhal::utils::time::micros64();
+    _running  = true;
+    return base::status::ok;
+}
+
+inline void ArduinoAdc::stopContinuous() {
+    _running = false;
+}
+
+inline void ArduinoAdc::poll() {
+    if (!_running) return;
+    const uint64_t now = flexhal::utils::time::micros64();
+    if (now < _next_us) return;
+    const uint64_t late = (now - _next_us) / _period_us;
+    if (late > 0) {
+        _overruns += static_cast<uint32_t>(late);
+        _next_us += late * _period_us;
+    }
+    _next_us += _period_us;
+    scan(_buffer.next());
+    _buffer.commit(); // May stop the acquisition from a callback
+}
+
+} // namespace adc
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_ADC_ARDUINOADC_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -33,8 +33,12 @@ base::status pin_mode(uint32_t pin_number, flexhal::hal::gpio::PinMode mode);
  * @param pin_number The platform-specific pin number.
  * @param level The value to write (true for HIGH, false for LOW).
  * @return flexhal::base::status Always returns ok for Arduino.
+ * @note Defined inline so that StaticPin calls compile down to ::digitalWrite.
  */
-base::status digital_write(uint32_t pin_number, bool level);
+inline base::status digital_write(uint32_t pin_number, bool level) {
+    ::digitalWrite(pin_number, level ? HIGH : LOW);
+    return base::status::ok;
+}
 
 /**
  * @brief Reads the digital value (HIGH or LOW) from a specific pin (Arduino implementation).
@@ -42,7 +46,9 @@ base::status digital_write(uint32_t pin_number, bool level);
  * @param pin_number The platform-specific pin number.
  * @return 1 (HIGH) or 0 (LOW). Note: Error handling (e.g., for non-digital pins) is not directly supported by Arduino's digitalRead.
  */
-int digital_read(uint32_t pin_number);
+inline int digital_read(uint32_t pin_number) {
+    return ::digitalRead(pin_number);
+}
 
 // Add declarations for analog_write, analog_read, pin_config etc. later
 
@@ -53,6 +59,12 @@ int digital_read(uint32_t pin_number);
 } // namespace internal
 } // namespace flexhal
 
+// Select this functional API for flexhal::hal::gpio::StaticPin unless another backend already did.
+#ifndef FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO
+#define FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO flexhal::internal::framework::arduino::hal::gpio
+#endif
+#include "flexhal/hal/gpio/StaticPin.hpp"
+
 
 // --- Implementation Section ---
 #ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -152,16 +164,6 @@ base::status pin_mode(uint32_t pin_number, flexhal::hal::gpio::PinMode mode) {
     }
 }
 
-// digital_write and digital_read implementations remain the same as before
-base::status digital_write(uint32_t pin_number, bool level) {
-    ::digitalWrite(pin_number, level ? HIGH : LOW);
-    return base::status::ok;
-}
-
-int digital_read(uint32_t pin_number) {
-    return ::digitalRead(pin_number);
-}
-
 } // namespace gpio
 } // namespace hal
 } // namespace arduino
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <memory>
-#include <vector>
 #include <cstdint>
 #include <cstdlib>         // For abort()
 #include <cassert>         // For assert()
@@ -10,6 +8,8 @@
 #include "flexhal/hal/gpio/IGpio.hpp"
 // Include the Port interface needed by getPort()
 #include "flexhal/hal/gpio/IPort.hpp"
+// The port is a member, so its complete type is needed here
+#include "ArduinoPort.hpp"
 
 // #include "ArduinoPin.hpp" // No longer directly needed here
 // #include "flexhal/hal/gpio/IPin.hpp" // No longer directly needed here
@@ -21,15 +21,15 @@ namespace arduino {
 namespace hal {
 namespace gpio {
 
-// Forward declare the port implementation
-class ArduinoPort;
-
 // Implement the IGpio interface for standard Arduino digital pins
 class ArduinoGpio : public flexhal::hal::gpio::IGpio { // Inherit from IGpio
 public:
-    ArduinoGpio() = default; // Default constructor
+    ArduinoGpio(); // Builds the port (and its pin table) in place; no heap allocation
     virtual ~ArduinoGpio() = default; // Virtual destructor for interface
 
+    ArduinoGpio(const ArduinoGpio&) = delete;
+    ArduinoGpio& operator=(const ArduinoGpio&) = delete;
+
     // --- IGpio Interface Implementation ---
 
     // Arduino typically presents digital pins as a single logical port (port 0)
@@ -48,13 +48,8 @@ public:
 
 
 private:
-    // Store the single port (Port 0 for Arduino)
-    // Use mutable to allow lazy initialization in const getPort()
-    mutable std::unique_ptr<ArduinoPort> _port0;
-    mutable bool _port0_initialized = false;
-
-     // Helper for lazy initialization in const version
-    void ensurePortInitialized() const;
+    // The single port (Port 0 for Arduino), embedded so that no HAL call allocates
+    ArduinoPort _port0;
 
     // --- Removed Pin Cache ---
     // We no longer cache pins directly in Gpio; the Port does.
@@ -76,8 +71,6 @@ private:
 #ifndef FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_GPIO_ARDUINOGPIO_IPP
 #define FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_GPIO_ARDUINOGPIO_IPP
 
-#include "ArduinoPort.hpp" // Need the definition for make_unique
-
 namespace flexhal {
 namespace internal {
 namespace framework {
@@ -85,6 +78,10 @@ namespace arduino {
 namespace hal {
 namespace gpio {
 
+inline ArduinoGpio::ArduinoGpio() : _port0(*this, 0) // The port only keeps the reference
+{
+}
+
 // --- IGpio Implementation ---
 
 inline uint32_t ArduinoGpio::getNumberOfPorts() const {
@@ -92,15 +89,6 @@ inline uint32_t ArduinoGpio::getNumberOfPorts() const {
     return 1;
 }
 
-// Helper for lazy initialization
-inline void ArduinoGpio::ensurePortInitialized() const {
-     if (!_port0_initialized) {
-        _port0 = std::make_unique<ArduinoPort>(*this, 0); // Pass *this and port index 0
-        _port0_initialized = true;
-    }
-}
-
-
 // Non-const getPort
 inline flexhal::hal::gpio::IPort& ArduinoGpio::getPort(uint32_t port_index) {
     // Check for invalid index first
@@ -109,9 +97,7 @@ inline flexhal::hal::gpio::IPort& ArduinoGpio::getPort(uint32_t port_index) {
         assert(false && "ArduinoGpio::getPort: Invalid port_index (only port 0 exists).");
         abort(); // Terminate in release builds if assert is disabled
     }
-    // If port_index is 0, proceed normally
-    ensurePortInitialized(); // Initialize if needed
-    return *_port0;
+    return _port0;
 }
 
 // Const getPort
@@ -122,9 +108,7 @@ inline const flexhal::hal::gpio::IPort& ArduinoGpio::getPort(uint32_t port_index
         assert(false && "ArduinoGpio::getPort(const): Invalid port_index (only port 0 exists).");
         abort(); // Terminate in release builds if assert is disabled
       }
-     // If port_index is 0, proceed normally
-     ensurePortInitialized(); // Initialize if needed (mutable allows this)
-     return *_port0;
+     return _port0;
 }
 
 
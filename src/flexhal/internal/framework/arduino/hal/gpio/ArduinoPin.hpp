@@ -8,6 +8,29 @@
 #include "flexhal/hal/gpio/IPort.hpp" // Include IPort for getPort()
 #include "flexhal/hal/gpio.hpp"    // Include gpio.hpp for PinMode, PinConfig etc.
 
+// Cores with attachInterruptArg() pass the pin to the handler directly; on the
+// others a fixed table of trampolines maps each interrupt back to its pin.
+#if defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266)
+ #define FLEXHAL_INTERNAL_ARDUINO_INTERRUPT_ARG 1
+#else
+ #define FLEXHAL_INTERNAL_ARDUINO_INTERRUPT_ARG 0
+#endif
+
+/**
+ * @brief Number of pins that can have an interrupt attached at the same time
+ *        on cores without attachInterruptArg().
+ */
+#ifndef FLEXHAL_ARDUINO_INTERRUPT_SLOTS
+#define FLEXHAL_ARDUINO_INTERRUPT_SLOTS 8
+#endif
+
+// Interrupt handlers must live in IRAM on ESP32 / ESP8266.
+#if defined(IRAM_ATTR)
+ #define FLEXHAL_INTERNAL_ARDUINO_ISR_ATTR IRAM_ATTR
+#else
+ #define FLEXHAL_INTERNAL_ARDUINO_ISR_ATTR
+#endif
+
 namespace flexhal {
 namespace internal {
 namespace framework {
@@ -38,16 +61,36 @@ public:
     // Digital I/O
     flexhal::base::status digitalWrite(bool level) override; // Updated parameter to bool
     int digitalRead() const override;             // Updated return type to int
+    flexhal::base::result<bool> tryDigitalRead() const override;
 
     // Analog I/O (PWM/DAC/ADC) - Keep existing signatures if they match IPin
     flexhal::base::status analogWrite(uint32_t value) override; // Keep uint32_t if IPin uses it
     int analogRead() const override;                  // Keep int if IPin uses it
+    flexhal::base::result<uint32_t> tryAnalogRead() const override;
+
+    // Interrupts: maps to ::attachInterrupt(); the event level is read in the handler.
+    using flexhal::hal::gpio::IPin::attachInterrupt;
+    flexhal::base::status attachInterrupt(flexhal::hal::gpio::PinEdge edge,
+                                          flexhal::hal::gpio::InterruptCallback callback,
+                                          void* context = nullptr) override;
+    flexhal::base::status detachInterrupt() override;
 
     // --- End IPin Interface ---
 
+    /**
+     * @brief Builds the PinEvent and calls the attached callback (interrupt context).
+     *
+     * Runs from IRAM on ESP32 without touching flash: the port index is cached
+     * by attachInterrupt() and the level is read from the GPIO input register.
+     */
+    void handleInterrupt();
+
 private:
     flexhal::hal::gpio::IPort& _port; // Reference to the parent port
     uint32_t _pin_index;              // Pin index within the port
+    uint16_t _port_index = 0;         // _port.getPortIndex(), cached for handleInterrupt()
+    flexhal::hal::gpio::InterruptCallback _callback = nullptr;
+    void* _context                                  = nullptr;
 };
 
 } // namespace gpio
@@ -62,6 +105,21 @@ private:
 #define FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_GPIO_ARDUINOPIN_IPP
 
 #include <Arduino.h> // Make sure Arduino API is available for implementation
+#include "flexhal/utils/time.hpp"
+#include "flexhal/utils/trace.hpp"
+#if !FLEXHAL_INTERNAL_ARDUINO_INTERRUPT_ARG
+#include <utility>
+#endif
+
+// ESP32 family: the interrupt handler reads the level from the GPIO input registers,
+// since digitalRead() is not guaranteed to be in IRAM.
+#if defined(ESP_PLATFORM) && __has_include(<soc/gpio_reg.h>) && __has_include(<soc/soc.h>)
+ #include <soc/soc.h>
+ #include <soc/gpio_reg.h>
+ #define FLEXHAL_INTERNAL_ARDUINO_GPIO_IN_REG 1
+#else
+ #define FLEXHAL_INTERNAL_ARDUINO_GPIO_IN_REG 0
+#endif
 
 namespace flexhal {
 namespace internal {
@@ -155,14 +213,21 @@ inline flexhal::base::status ArduinoPin::setConfig(const flexhal::hal::gpio::Pin
 }
 
 inline flexhal::base::status ArduinoPin::digitalWrite(bool level) {
+    FLEXHAL_TRACE_SCOPE("gpio.write");
     ::digitalWrite(_pin_index, level ? HIGH : LOW); // Use global namespace ::digitalWrite
     return flexhal::base::status::ok; // Assume success
 }
 
 inline int ArduinoPin::digitalRead() const {
+    FLEXHAL_TRACE_SCOPE("gpio.read");
     return ::digitalRead(_pin_index); // Use global namespace ::digitalRead. Returns HIGH (1) or LOW (0).
 }
 
+inline flexhal::base::result<bool> ArduinoPin::tryDigitalRead() const {
+    FLEXHAL_TRACE_SCOPE("gpio.try_read");
+    return ::digitalRead(_pin_index) == HIGH;
+}
+
 inline flexhal::base::status ArduinoPin::analogWrite(uint32_t value) {
     // Arduino analogWrite usually takes an int (0-255 for PWM).
     // Need to consider the range of value (uint32_t) and map/clamp it.
@@ -176,6 +241,122 @@ inline int ArduinoPin::analogRead() const {
     return ::analogRead(_pin_index); // Use global namespace ::analogRead
 }
 
+inline flexhal::base::result<uint32_t> ArduinoPin::tryAnalogRead() const {
+    return static_cast<uint32_t>(::analogRead(_pin_index));
+}
+
+namespace {
+
+#if FLEXHAL_INTERNAL_ARDUINO_INTERRUPT_ARG
+FLEXHAL_INTERNAL_ARDUINO_ISR_ATTR void arduino_pin_isr(void* arg) {
+    static_cast<ArduinoPin*>(arg)->handleInterrupt();
+}
+#else
+// Pin attached to each trampoline slot (nullptr = free).
+ArduinoPin* volatile interrupt_slots[FLEXHAL_ARDUINO_INTERRUPT_SLOTS];
+
+template <size_t Slot>
+FLEXHAL_INTERNAL_ARDUINO_ISR_ATTR void interrupt_trampoline() {
+    ArduinoPin* pin = interrupt_slots[Slot];
+    if (pin != nullptr) pin->handleInterrupt();
+}
+
+using trampoline_t = void (*)();
+
+template <size_t... Slots>
+struct TrampolineTable {
+    static constexpr trampoline_t table[sizeof...(Slots)] = {&interrupt_trampoline<Slots>...};
+};
+
+template <size_t... Slots>
+constexpr const trampoline_t* trampolines(std::index_sequence<Slots...>) {
+    return TrampolineTable<Slots...>::table;
+}
+#endif
+
+// Pin level from interrupt context.
+inline FLEXHAL_INTERNAL_ARDUINO_ISR_ATTR bool isr_read_level(uint32_t pin) {
+#if FLEXHAL_INTERNAL_ARDUINO_GPIO_IN_REG
+ #if defined(GPIO_IN1_REG)
+    if (pin >= 32) return (REG_READ(GPIO_IN1_REG) >> (pin - 32)) & 1u;
+ #endif
+    return (REG_READ(GPIO_IN_REG) >> pin) & 1u;
+#else
+    return ::digitalRead(pin) == HIGH;
+#endif
+}
+
+int to_arduino_mode(flexhal::hal::gpio::PinEdge edge) {
+    switch (edge) {
+        case flexhal::hal::gpio::PinEdge::Rising:
+            return RISING;
+        case flexhal::hal::gpio::PinEdge::Falling:
+            return FALLING;
+        default:
+            return CHANGE;
+    }
+}
+
+} // namespace
+
+inline FLEXHAL_INTERNAL_ARDUINO_ISR_ATTR void ArduinoPin::handleInterrupt() {
+    const flexhal::hal::gpio::InterruptCallback callback = _callback;
+    if (callback == nullptr) return;
+    const flexhal::hal::gpio::PinEvent event{flexhal::utils::time::nanos64(), _port_index,
+                                             static_cast<uint16_t>(_pin_index),
+                                             static_cast<uint8_t>(isr_read_level(_pin_index) ? 1 : 0)};
+    callback(_context, event);
+}
+
+inline flexhal::base::status ArduinoPin::attachInterrupt(flexhal::hal::gpio::PinEdge edge,
+                                                         flexhal::hal::gpio::InterruptCallback callback,
+                                                         void* context) {
+    if (callback == nullptr) {
+        return flexhal::base::status::param;
+    }
+#if defined(NOT_AN_INTERRUPT)
+    if (digitalPinToInterrupt(_pin_index) == NOT_AN_INTERRUPT) {
+        return flexhal::base::status::unsupported;
+    }
+#endif
+    detachInterrupt();
+    _port_index = static_cast<uint16_t>(_port.getPortIndex());
+    _callback   = callback;
+    _context    = context;
+#if FLEXHAL_INTERNAL_ARDUINO_INTERRUPT_ARG
+    ::attachInterruptArg(digitalPinToInterrupt(_pin_index), arduino_pin_isr, this, to_arduino_mode(edge));
+#else
+    size_t slot = 0;
+    while (slot < FLEXHAL_ARDUINO_INTERRUPT_SLOTS && interrupt_slots[slot] != nullptr) {
+        ++slot;
+    }
+    if (slot == FLEXHAL_ARDUINO_INTERRUPT_SLOTS) {
+        _callback = nullptr;
+        return flexhal::base::status::no_memory;
+    }
+    interrupt_slots[slot] = this;
+    ::attachInterrupt(digitalPinToInterrupt(_pin_index),
+                      trampolines(std::make_index_sequence<FLEXHAL_ARDUINO_INTERRUPT_SLOTS>())[slot],
+                      to_arduino_mode(edge));
+#endif
+    return flexhal::base::status::ok;
+}
+
+inline flexhal::base::status ArduinoPin::detachInterrupt() {
+    if (_callback == nullptr) {
+        return flexhal::base::status::ok;
+    }
+    ::detachInterrupt(digitalPinToInterrupt(_pin_index));
+#if !FLEXHAL_INTERNAL_ARDUINO_INTERRUPT_ARG
+    for (size_t slot = 0; slot < FLEXHAL_ARDUINO_INTERRUPT_SLOTS; ++slot) {
+        if (interrupt_slots[slot] == this) interrupt_slots[slot] = nullptr;
+    }
+#endif
+    _callback = nullptr;
+    _context  = nullptr;
+    return flexhal::base::status::ok;
+}
+
 // --- End IPin Implementation ---
 
 
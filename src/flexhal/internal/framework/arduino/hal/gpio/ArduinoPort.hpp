@@ -1,12 +1,23 @@
 #pragma once
 
-#include <vector>
-#include <memory>
 #include <cstdint>
 #include <cassert> // For assert()
 
 #include "flexhal/hal/gpio/IPort.hpp"
 #include "flexhal/hal/gpio/IPin.hpp"
+#include "ArduinoPin.hpp" // Complete type needed for the in-place pin table (also brings in Arduino.h)
+
+// Number of pins in the port. Defaults to the board's NUM_DIGITAL_PINS; define
+// FLEXHAL_ARDUINO_PIN_COUNT (e.g., -DFLEXHAL_ARDUINO_PIN_COUNT=30 in build_flags)
+// for cores that do not provide it. All pins live in a fixed-size table inside the
+// port and are constructed up front: no heap use and no lazy-init branch.
+#ifndef FLEXHAL_ARDUINO_PIN_COUNT
+ #if defined(NUM_DIGITAL_PINS)
+  #define FLEXHAL_ARDUINO_PIN_COUNT NUM_DIGITAL_PINS
+ #else
+  #error "FlexHAL: NUM_DIGITAL_PINS is not defined by this Arduino core; define FLEXHAL_ARDUINO_PIN_COUNT"
+ #endif
+#endif
 
 // Forward declare IGpio for the reference in constructor/member
 namespace flexhal { namespace hal { namespace gpio { class IGpio; } } }
@@ -18,9 +29,6 @@ namespace arduino {
 namespace hal {
 namespace gpio {
 
-// Forward declare ArduinoPin to be included only in implementation section
-class ArduinoPin;
-
 // Forward declare ArduinoGpio if needed, or include IGpio reference
 class ArduinoGpio; // Assuming this is the concrete type, better use IGpio&
 
@@ -28,7 +36,11 @@ class ArduinoPort : public flexhal::hal::gpio::IPort {
 public:
     // Constructor now takes a const reference to the parent GPIO controller
     explicit ArduinoPort(const flexhal::hal::gpio::IGpio& gpio, uint32_t port_index);
-    virtual ~ArduinoPort() = default; // Virtual destructor
+    virtual ~ArduinoPort(); // Virtual destructor
+
+    // Pins keep a reference to this port, so it must stay in place.
+    ArduinoPort(const ArduinoPort&) = delete;
+    ArduinoPort& operator=(const ArduinoPort&) = delete;
 
     // --- IPort Interface Implementation ---
 
@@ -49,8 +61,17 @@ public:
     // Port-level operations (optional, default implementations in IPort return unsupported)
     // base::error_t writePort(uint32_t value, uint32_t mask = 0xFFFFFFFF) override; // Use write() instead
     // uint32_t readPort(uint32_t mask = 0xFFFFFFFF) const override; // Use read() instead
+    // The port-wide operations address the first 32 pins (bit n = Arduino pin n).
     base::status write(uint32_t value) override; // Implement required write
     uint32_t read() const override;               // Implement required read
+    base::result<uint32_t> tryRead() const override;
+
+    // Multi-pin operations: a single W1TS/W1TC register write on ESP32,
+    // otherwise one pass over the set bits of the mask.
+    base::status setBits(uint32_t mask) override;
+    base::status clearBits(uint32_t mask) override;
+    base::status toggleBits(uint32_t mask) override;
+    base::status writeMasked(uint32_t mask, uint32_t value) override;
     // base::error_t setMode(flexhal::hal::gpio::PinMode mode, uint32_t mask = 0xFFFFFFFF) override;
     // base::error_t setConfig(const flexhal::hal::gpio::PinConfig& config, uint32_t mask = 0xFFFFFFFF) override;
 
@@ -59,13 +80,20 @@ public:
 private:
     const flexhal::hal::gpio::IGpio& _gpio; // Const reference to the parent Gpio controller
     uint32_t _port_index;
-    // Use IPin pointers to store ArduinoPin instances polymorphically.
-    // Use mutable for const getPin to allow lazy initialization.
-    mutable std::vector<std::unique_ptr<flexhal::hal::gpio::IPin>> _pins;
-    mutable bool _pins_initialized = false;
+    static constexpr uint32_t PIN_COUNT = FLEXHAL_ARDUINO_PIN_COUNT;
+    static_assert(PIN_COUNT > 0, "FLEXHAL_ARDUINO_PIN_COUNT must be at least 1");
+    // Contiguous storage for PIN_COUNT ArduinoPin objects, constructed in place by the constructor.
+    alignas(ArduinoPin) unsigned char _pin_storage[sizeof(ArduinoPin) * PIN_COUNT];
 
-    // Helper for lazy initialization in const version
-    void ensurePinsInitialized() const;
+    ArduinoPin* pinTable() {
+        return reinterpret_cast<ArduinoPin*>(_pin_storage);
+    }
+    const ArduinoPin* pinTable() const {
+        return reinterpret_cast<const ArduinoPin*>(_pin_storage);
+    }
+
+    // Mask of the pins reachable through the 32-bit port operations
+    uint32_t validMask() const;
 };
 
 } // namespace gpio
@@ -81,11 +109,22 @@ private:
 #ifndef FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_GPIO_ARDUINOPORT_IPP
 #define FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_GPIO_ARDUINOPORT_IPP
 
-#include "ArduinoPin.hpp" // Include full definition for make_unique
-#include <stdexcept>      // For std::out_of_range
+#include <cstdlib>        // For abort()
+#include <new>            // For placement new
 #include <limits>       // For numeric_limits
 #include <Arduino.h> // Include Arduino headers only in implementation for NUM_DIGITAL_PINS
 
+#include "flexhal/utils/trace.hpp"
+
+// ESP32 family: GPIO 0-31 can be set/cleared atomically through the W1TS/W1TC registers.
+#if defined(ESP_PLATFORM) && __has_include(<soc/gpio_reg.h>) && __has_include(<soc/soc.h>)
+ #include <soc/soc.h>
+ #include <soc/gpio_reg.h>
+ #define FLEXHAL_INTERNAL_ARDUINO_GPIO_USE_W1TS 1
+#else
+ #define FLEXHAL_INTERNAL_ARDUINO_GPIO_USE_W1TS 0
+#endif
+
 namespace flexhal {
 namespace internal {
 namespace framework {
@@ -97,10 +136,17 @@ namespace gpio {
 inline ArduinoPort::ArduinoPort(const flexhal::hal::gpio::IGpio& gpio, uint32_t port_index)
     : _gpio(gpio), _port_index(port_index)
 {
-    // Determine the number of pins for this port.
-    // For Arduino, we typically map all digital pins to a single port (port 0).
-    // Size _pins vector immediately? Or lazy init in getPin?
-    // Let's lazy init in getPin/ensurePinsInitialized. NUM_DIGITAL_PINS is often a macro.
+    // For Arduino, we map all digital pins to a single port (port 0).
+    // Construct every pin in place now so getPin() is a plain index.
+    for (uint32_t i = 0; i < PIN_COUNT; ++i) {
+        new (&pinTable()[i]) ArduinoPin(*this, i);
+    }
+}
+
+inline ArduinoPort::~ArduinoPort() {
+    for (uint32_t i = 0; i < PIN_COUNT; ++i) {
+        pinTable()[i].~ArduinoPin();
+    }
 }
 
 inline uint32_t ArduinoPort::getPortIndex() const {
@@ -120,79 +166,109 @@ inline const flexhal::hal::gpio::IGpio& ArduinoPort::getGpio() const {
 
 inline uint32_t ArduinoPort::getNumberOfPins() const {
     // Return the total number of digital pins available on the Arduino board.
-#if defined(NUM_DIGITAL_PINS)
-    return NUM_DIGITAL_PINS;
-#else
-    // Fallback if NUM_DIGITAL_PINS is not defined (should be defined by Arduino core)
-    // Return a reasonable default or 0, indicating an issue.
-    // Or maybe determine dynamically if possible?
-    // Let's return 0 for now to indicate potential problem.
-    // Consider adding a warning/error log here.
-    // Warning: NUM_DIGITAL_PINS not defined for this Arduino platform.
-    return 0; // Or throw?
-#endif
+    return PIN_COUNT;
 }
 
-// Helper for lazy initialization
-inline void ArduinoPort::ensurePinsInitialized() const {
-    if (!_pins_initialized) {
-        _pins.resize(getNumberOfPins()); // Resize vector to hold all pins
-        _pins_initialized = true;
-    }
-}
-
-// Non-const getPin
+// Non-const getPin: bounds-checked index into the pin table
 inline flexhal::hal::gpio::IPin& ArduinoPort::getPin(uint32_t pin_index) {
-    ensurePinsInitialized(); // Make sure vector is sized
-
-    if (pin_index >= _pins.size()) {
-        // Since exceptions are disabled, assert in debug, return pin 0 in release.
+    if (pin_index >= PIN_COUNT) {
         assert(false && "ArduinoPort::getPin: pin_index out of range");
-        // TODO: Log an error here in release builds?
-        // Fallback: Return pin 0. This might hide errors but avoids crashing.
-        // Be careful of infinite recursion if 0 is also invalid!
-        return getPin(0);
+        abort(); // Terminate in release builds if assert is disabled
     }
-
-    // Lazy initialization of the specific pin
-    if (!_pins[pin_index]) {
-        _pins[pin_index] = std::make_unique<ArduinoPin>(*this, pin_index);
-    }
-    return *_pins[pin_index];
+    return pinTable()[pin_index];
 }
 
 // Const getPin
 inline const flexhal::hal::gpio::IPin& ArduinoPort::getPin(uint32_t pin_index) const {
-    ensurePinsInitialized(); // Make sure vector is sized (mutable allows this)
-
-    if (pin_index >= _pins.size()) { // Check bounds
+    if (pin_index >= PIN_COUNT) {
         assert(false && "ArduinoPort::getPin(const): pin_index out of range");
-        // TODO: Log an error here in release builds?
-        return getPin(0); // Fallback to pin 0 (const version)
+        abort(); // Terminate in release builds if assert is disabled
     }
+    return pinTable()[pin_index];
+}
 
-    // Lazy initialization of the specific pin (mutable allows this)
-    if (!_pins[pin_index]) {
-        // With no exceptions, assert and fallback.
-        assert(false && "ArduinoPort::getPin(const): Pin requested before initialization");
-        // This case is less likely if bounds check passes and ensurePinsInitialized worked.
-        // If it happens, returning pin 0 might be the safest fallback.
-        return getPin(0);
-        // Alternative: Return a static const error pin?
-        // static const ErrorPin nullPin; return nullPin;
-    }
-    return *_pins[pin_index]; // Return const reference
+
+inline uint32_t ArduinoPort::validMask() const {
+    const uint32_t pin_count = getNumberOfPins();
+    return (pin_count >= 32) ? 0xFFFFFFFFu : ((1u << pin_count) - 1u);
 }
 
-// Implement write and read as unsupported for Arduino port-level access
+// Port-level write: all of the first 32 pins at once
 inline base::status ArduinoPort::write(uint32_t value) {
-    (void)value; // Mark unused
-    return flexhal::base::status::unsupported; // Port write not supported
+    FLEXHAL_TRACE_SCOPE("gpio.port_write");
+    return writeMasked(0xFFFFFFFFu, value);
 }
 
 inline uint32_t ArduinoPort::read() const {
-    // Port read not supported, return a default value (e.g., 0)
-    return 0; // Or perhaps std::numeric_limits<uint32_t>::max() to indicate error?
+    FLEXHAL_TRACE_SCOPE("gpio.port_read");
+    const uint32_t mask = validMask();
+#if FLEXHAL_INTERNAL_ARDUINO_GPIO_USE_W1TS
+    return REG_READ(GPIO_IN_REG) & mask;
+#else
+    uint32_t value = 0;
+    for (uint32_t bits = mask; bits; bits &= bits - 1) {
+        const uint32_t pin = __builtin_ctz(bits);
+        if (::digitalRead(pin) == HIGH) value |= 1u << pin;
+    }
+    return value;
+#endif
+}
+
+inline base::result<uint32_t> ArduinoPort::tryRead() const {
+    return ArduinoPort::read(); // Qualified: no second virtual call
+}
+
+inline base::status ArduinoPort::setBits(uint32_t mask) {
+    mask &= validMask();
+#if FLEXHAL_INTERNAL_ARDUINO_GPIO_USE_W1TS
+    REG_WRITE(GPIO_OUT_W1TS_REG, mask);
+#else
+    for (; mask; mask &= mask - 1) {
+        ::digitalWrite(__builtin_ctz(mask), HIGH);
+    }
+#endif
+    return flexhal::base::status::ok;
+}
+
+inline base::status ArduinoPort::clearBits(uint32_t mask) {
+    mask &= validMask();
+#if FLEXHAL_INTERNAL_ARDUINO_GPIO_USE_W1TS
+    REG_WRITE(GPIO_OUT_W1TC_REG, mask);
+#else
+    for (; mask; mask &= mask - 1) {
+        ::digitalWrite(__builtin_ctz(mask), LOW);
+    }
+#endif
+    return flexhal::base::status::ok;
+}
+
+inline base::status ArduinoPort::toggleBits(uint32_t mask) {
+    mask &= validMask();
+#if FLEXHAL_INTERNAL_ARDUINO_GPIO_USE_W1TS
+    const uint32_t out = REG_READ(GPIO_OUT_REG);
+    REG_WRITE(GPIO_OUT_W1TS_REG, ~out & mask);
+    REG_WRITE(GPIO_OUT_W1TC_REG, out & mask);
+#else
+    for (; mask; mask &= mask - 1) {
+        const uint32_t pin = __builtin_ctz(mask);
+        ::digitalWrite(pin, ::digitalRead(pin) == HIGH ? LOW : HIGH);
+    }
+#endif
+    return flexhal::base::status::ok;
+}
+
+inline base::status ArduinoPort::writeMasked(uint32_t mask, uint32_t value) {
+    mask &= validMask();
+#if FLEXHAL_INTERNAL_ARDUINO_GPIO_USE_W1TS
+    REG_WRITE(GPIO_OUT_W1TS_REG, value & mask);
+    REG_WRITE(GPIO_OUT_W1TC_REG, ~value & mask);
+#else
+    for (; mask; mask &= mask - 1) {
+        const uint32_t pin = __builtin_ctz(mask);
+        ::digitalWrite(pin, ((value >> pin) & 1u) ? HIGH : LOW);
+    }
+#endif
+    return flexhal::base::status::ok;
 }
 
 } // namespace gpio
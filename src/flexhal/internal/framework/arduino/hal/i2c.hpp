@@ -0,0 +1,4 @@
+#pragma once
+
+// Include all headers from the i2c implementation subdirectory
+#include "i2c/ArduinoI2c.hpp"
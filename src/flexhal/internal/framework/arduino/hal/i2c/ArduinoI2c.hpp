@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <Arduino.h>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/i2c.hpp"
+
+// Every mainstream core ships the Wire library, but it is a separate header.
+#if defined(__has_include)
+ #if __has_include(<Wire.h>)
+  #include <Wire.h>
+  #define FLEXHAL_INTERNAL_ARDUINO_I2C 1
+ #endif
+#endif
+
+#if FLEXHAL_INTERNAL_ARDUINO_I2C
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace i2c {
+
+/**
+ * @brief II2c on top of an Arduino TwoWire (Wire by default).
+ *
+ * The batch scheduling is done by I2cBus; each message maps to
+ * endTransmission(false) for the write phase and requestFrom() with the
+ * stop flag for the read phase, so the repeated starts reach the bus.
+ * The bus must have been started with TwoWire::begin(). Reads are limited
+ * to 255 bytes per message (the Wire buffer is usually smaller still, so
+ * keep FLEXHAL_I2C_MERGE_SIZE within it).
+ */
+class ArduinoI2c : public flexhal::hal::i2c::I2cBus {
+public:
+    explicit ArduinoI2c(TwoWire& bus = Wire);
+
+    ArduinoI2c(const ArduinoI2c&)            = delete;
+    ArduinoI2c& operator=(const ArduinoI2c&) = delete;
+
+protected:
+    base::status transferMessage(uint16_t address, const uint8_t* write, size_t write_length, uint8_t* read,
+                                 size_t read_length, bool stop) override;
+
+private:
+    TwoWire& _bus;
+};
+
+} // namespace i2c
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_I2C_ARDUINOI2C_IPP
+#define FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_I2C_ARDUINOI2C_IPP
+
+#include "flexhal/utils/trace.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace i2c {
+
+inline ArduinoI2c::ArduinoI2c(TwoWire& bus) : _bus(bus)
+{
+}
+
+inline base::status ArduinoI2c::transferMessage(uint16_t address, const uint8_t* write, size_t write_length,
+                                                uint8_t* read, size_t read_length, bool stop) {
+    FLEXHAL_TRACE_SCOPE("i2c.transfer");
+    if (read_length > 255) {
+        return base::status::param;
+    }
+    const uint8_t device = static_cast<uint8_t>(address);
+
+    if (write_length > 0 || read_length == 0) {
+        _bus.beginTransmission(device);
+        if (write_length > 0 && _bus.write(write, write_length) != write_length) {
+            _bus.endTransmission(true);
+            return base::status::no_memory; // Larger than the Wire transmit buffer
+        }
+        // endTransmission(): 0 success, 2 address NACK, 3 data NACK, 5 timeout (ESP32, newer AVR cores).
+        switch (_bus.endTransmission(read_length > 0 ? false : stop)) {
+        case 0: break;
+        case 2: return base::status::not_found;
+        case 3: return base::status::io;
+        case 5: return base::status::timeout;
+        default: return base::status::error;
+        }
+    }
+    if (read_length > 0) {
+        const uint8_t received = _bus.requestFrom(device, static_cast<uint8_t>(read_length), static_cast<uint8_t>(stop));
+        for (size_t i = 0; i < received && _bus.available(); ++i) {
+            read[i] = static_cast<uint8_t>(_bus.read());
+        }
+        if (received != read_length) {
+            // The core only reports a byte count; nothing at all means the address was not acknowledged.
+            return received == 0 ? base::status::not_found : base::status::io;
+        }
+    }
+    return base::status::ok;
+}
+
+} // namespace i2c
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_I2C_ARDUINOI2C_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
+
+#endif // FLEXHAL_INTERNAL_ARDUINO_I2C
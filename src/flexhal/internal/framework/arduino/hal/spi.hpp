@@ -0,0 +1,4 @@
+#pragma once
+
+// Include all headers from the spi implementation subdirectory
+#include "spi/ArduinoSpi.hpp"
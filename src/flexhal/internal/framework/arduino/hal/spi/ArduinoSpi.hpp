@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <Arduino.h>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/spi.hpp"
+
+// Every mainstream core ships the SPI library, but it is a separate header.
+#if defined(__has_include)
+ #if __has_include(<SPI.h>)
+  #include <SPI.h>
+  #define FLEXHAL_INTERNAL_ARDUINO_SPI 1
+ #endif
+#endif
+
+// The ESP32 core can send and receive whole buffers without a per-byte call.
+#if defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
+ #define FLEXHAL_INTERNAL_ARDUINO_SPI_BYTES 1
+#else
+ #define FLEXHAL_INTERNAL_ARDUINO_SPI_BYTES 0
+#endif
+
+#if FLEXHAL_INTERNAL_ARDUINO_SPI
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace spi {
+
+/**
+ * @brief ISpi on top of an Arduino SPIClass (SPI by default).
+ *
+ * submit() only queues; poll() (called by the blocking and awaitable
+ * transfers while they wait) executes every queued transaction back to
+ * back, wrapping each frame in beginTransaction() / endTransaction().
+ * submit() and poll() must be called from the same context. The bus must
+ * have been started with SPIClass::begin().
+ */
+class ArduinoSpi : public flexhal::hal::spi::ISpi {
+public:
+    explicit ArduinoSpi(SPIClass& bus = SPI);
+
+    ArduinoSpi(const ArduinoSpi&)            = delete;
+    ArduinoSpi& operator=(const ArduinoSpi&) = delete;
+
+    // --- ISpi Interface Implementation ---
+    base::status submit(flexhal::hal::spi::SpiTransaction& transaction) override;
+    void poll() override;
+    bool isIdle() const override;
+    // --- End ISpi Interface ---
+
+private:
+    void select(const flexhal::hal::spi::SpiDevice* device);
+    void deselect();
+    void execute(flexhal::hal::spi::SpiTransaction& transaction);
+
+    SPIClass& _bus;
+    flexhal::hal::spi::SpiQueue _queue;
+    const flexhal::hal::spi::SpiDevice* _selected;
+    bool _polling;
+};
+
+} // namespace spi
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_SPI_ARDUINOSPI_IPP
+#define FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_SPI_ARDUINOSPI_IPP
+
+#include "flexhal/utils/trace.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace spi {
+
+inline ArduinoSpi::ArduinoSpi(SPIClass& bus) : _bus(bus), _queue(), _selected(nullptr), _polling(false)
+{
+}
+
+inline base::status ArduinoSpi::submit(flexhal::hal::spi::SpiTransaction& transaction) {
+    FLEXHAL_TRACE_SCOPE("spi.submit");
+    if (transaction.device == nullptr || transaction.length == 0) {
+        return base::status::param;
+    }
+    if (transaction.result.load(std::memory_order_relaxed) == base::status::pending) {
+        return base::status::busy;
+    }
+    transaction.result.store(base::status::pending, std::memory_order_relaxed);
+    _queue.push(transaction);
+    return base::status::ok;
+}
+
+inline bool ArduinoSpi::isIdle() const {
+    return _queue.empty() && !_polling;
+}
+
+inline void ArduinoSpi::poll() {
+    if (_polling) return; // Called again from a callback
+    _polling = true;
+    while (flexhal::hal::spi::SpiTransaction* transaction = _queue.pop()) {
+        execute(*transaction);
+    }
+    _polling = false;
+}
+
+inline void ArduinoSpi::select(const flexhal::hal::spi::SpiDevice* device) {
+    if (_selected == device) return;
+    deselect();
+    static const uint8_t modes[4] = {SPI_MODE0, SPI_MODE1, SPI_MODE2, SPI_MODE3};
+    const uint8_t order = (device->bit_order == flexhal::hal::spi::SpiBitOrder::MsbFirst) ? MSBFIRST : LSBFIRST;
+    _bus.beginTransaction(SPISettings(device->clock_hz, order, modes[static_cast<uint8_t>(device->mode) & 3u]));
+    if (device->cs != nullptr) device->cs->digitalWrite(device->cs_active_high);
+    _selected = device;
+}
+
+inline void ArduinoSpi::deselect() {
+    if (_selected == nullptr) return;
+    if (_selected->cs != nullptr) _selected->cs->digitalWrite(!_selected->cs_active_high);
+    _bus.endTransaction();
+    _selected = nullptr;
+}
+
+inline void ArduinoSpi::execute(flexhal::hal::spi::SpiTransaction& transaction) {
+    const flexhal::hal::spi::SpiDevice* device = transaction.device;
+    const uint8_t* tx                          = transaction.tx;
+    uint8_t* rx                                = transaction.rx;
+    const size_t length                        = transaction.length;
+
+    select(device);
+#if FLEXHAL_INTERNAL_ARDUINO_SPI_BYTES
+    if (tx != nullptr && rx != nullptr) {
+        _bus.transferBytes(tx, rx, static_cast<uint32_t>(length));
+    } else if (tx != nullptr) {
+        _bus.writeBytes(tx, static_cast<uint32_t>(length));
+    } else
+#endif
+    {
+        for (size_t i = 0; i < length; ++i) {
+            const uint8_t in = _bus.transfer(tx != nullptr ? tx[i] : device->fill);
+            if (rx != nullptr) rx[i] = in;
+        }
+    }
+    if (!(transaction.flags & flexhal::hal::spi::SpiTransaction::keep_cs)) {
+        deselect();
+    }
+
+    if (transaction.callback != nullptr) {
+        transaction.callback(transaction.context, transaction, base::status::ok);
+    }
+    transaction.result.store(base::status::ok, std::memory_order_release);
+}
+
+} // namespace spi
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_SPI_ARDUINOSPI_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
+
+#endif // FLEXHAL_INTERNAL_ARDUINO_SPI
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <Arduino.h>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/uart.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace uart {
+
+/**
+ * @brief IUart on top of an Arduino Stream (Serial, Serial1, USB CDC, ...).
+ *
+ * poll() moves what the core has received into the receive ring and hands
+ * the transmit ring to the core, never more than availableForWrite() so it
+ * does not block. Streams whose availableForWrite() always returns 0 (the
+ * Print default) need force_writes, which writes everything and lets the
+ * core block. The stream must have been started (e.g. Serial.begin()).
+ */
+class ArduinoUart : public flexhal::hal::uart::BufferedUart {
+public:
+    explicit ArduinoUart(Stream& stream, size_t rx_capacity = 256, size_t tx_capacity = 512,
+                         bool force_writes = false);
+
+    ArduinoUart(const ArduinoUart&)            = delete;
+    ArduinoUart& operator=(const ArduinoUart&) = delete;
+
+protected:
+    size_t receive(uint8_t* data, size_t length) override;
+    size_t transmit(const uint8_t* data, size_t length) override;
+
+private:
+    Stream& _stream;
+    bool _force_writes;
+};
+
+} // namespace uart
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_UART_ARDUINOUART_IPP
+#define FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_UART_ARDUINOUART_IPP
+
+namespace flexhal {
+namespace internal {
+namespace framework {
+namespace arduino {
+namespace hal {
+namespace uart {
+
+inline ArduinoUart::ArduinoUart(Stream& stream, size_t rx_capacity, size_t tx_capacity, bool force_writes)
+    : BufferedUart(rx_capacity, tx_capacity), _stream(stream), _force_writes(force_writes)
+{
+}
+
+inline size_t ArduinoUart::receive(uint8_t* data, size_t length) {
+    const int pending = _stream.available();
+    if (pending <= 0) {
+        return 0;
+    }
+    const size_t count = static_cast<size_t>(pending) < length ? static_cast<size_t>(pending) : length;
+    return _stream.readBytes(reinterpret_cast<char*>(data), count);
+}
+
+inline size_t ArduinoUart::transmit(const uint8_t* data, size_t length) {
+    size_t count = length;
+    if (!_force_writes) {
+        const int room = _stream.availableForWrite();
+        if (room <= 0) {
+            return 0;
+        }
+        if (static_cast<size_t>(room) < count) count = static_cast<size_t>(room);
+    }
+    return _stream.write(data, count);
+}
+
+} // namespace uart
+} // namespace hal
+} // namespace arduino
+} // namespace framework
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_FRAMEWORK_ARDUINO_HAL_UART_ARDUINOUART_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
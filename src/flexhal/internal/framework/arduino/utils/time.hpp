@@ -3,20 +3,37 @@
 #include <Arduino.h>
 #include "flexhal/base/status.hpp"
 
+#if defined(ESP_PLATFORM) && __has_include(<esp_timer.h>)
+ #include <esp_timer.h>
+ #define FLEXHAL_INTERNAL_ARDUINO_TIME_ESP_TIMER 1
+#elif defined(__AVR__)
+ #define FLEXHAL_INTERNAL_ARDUINO_TIME_ESP_TIMER 0
+#else
+ #include <atomic>
+ #define FLEXHAL_INTERNAL_ARDUINO_TIME_ESP_TIMER 0
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32) && __has_include(<Esp.h>)
+ #include <Esp.h>
+ #define FLEXHAL_INTERNAL_ARDUINO_TIME_CYCLES 1
+#else
+ #define FLEXHAL_INTERNAL_ARDUINO_TIME_CYCLES 0
+#endif
+
 #ifndef FLEXHAL_INTERNAL_FLEXHAL_UTILS_TIME
 #define FLEXHAL_INTERNAL_FLEXHAL_UTILS_TIME flexhal::internal::framework::arduino::utils::time
 #endif
 
 namespace flexhal::internal::framework::arduino::utils::time {
 
-  inline base::error_t delay_ms(uint32_t ms) {
+  inline base::status delay_ms(uint32_t ms) {
     ::delay(ms);
-    return to_error(base::status::ok);
+    return base::status::ok;
   }
 
-  inline base::error_t delay_us(uint32_t us) {
+  inline base::status delay_us(uint32_t us) {
     ::delayMicroseconds(us);
-    return to_error(base::status::ok);
+    return base::status::ok;
   }
 
   inline uint32_t millis() {
@@ -27,4 +44,96 @@ namespace flexhal::internal::framework::arduino::utils::time {
     return ::micros();
   }
 
+  /**
+   * @brief Monotonic time in microseconds (does not wrap).
+   *
+   * ESP32 reads the 64-bit esp_timer directly. Elsewhere the 32-bit
+   * ::micros() is extended by remembering the last value: each call that
+   * sees the counter go backwards adds one wrap. This is correct as long as
+   * micros64() is called at least once every ~71 minutes.
+   */
+  inline uint64_t micros64() {
+#if FLEXHAL_INTERNAL_ARDUINO_TIME_ESP_TIMER
+    return static_cast<uint64_t>(esp_timer_get_time());
+#elif defined(__AVR__)
+    // No 64-bit atomics on AVR: update the state with interrupts masked.
+    static uint64_t last = 0;
+    const uint8_t sreg = SREG;
+    cli();
+    const uint32_t now = ::micros();
+    uint64_t extended  = (last & 0xFFFFFFFF00000000ull) | now;
+    if (now < static_cast<uint32_t>(last)) {
+      extended += 0x100000000ull;
+    }
+    last = extended;
+    SREG = sreg;
+    return extended;
+#else
+    // Lock-free: ::micros() is always read after loading the stored value
+    // (acquire), so it is never older than it; callers racing on the same wrap
+    // compute the same value and the CAS only ever moves the stored value forward.
+    static std::atomic<uint64_t> last(0);
+    uint64_t previous = last.load(std::memory_order_acquire);
+    for (;;) {
+      const uint32_t now = ::micros();
+      uint64_t extended  = (previous & 0xFFFFFFFF00000000ull) | now;
+      if (now < static_cast<uint32_t>(previous)) {
+        extended += 0x100000000ull;
+      }
+      if (extended <= previous ||
+          last.compare_exchange_weak(previous, extended, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return (extended > previous) ? extended : previous;
+      }
+    }
+#endif
+  }
+
+  /**
+   * @brief Monotonic time in nanoseconds (microsecond resolution on this backend).
+   */
+  inline uint64_t nanos64() {
+    return micros64() * 1000u;
+  }
+
+  /**
+   * @brief Raw timestamp. On this backend one tick is one microsecond.
+   */
+  inline uint64_t ticks() {
+    return micros64();
+  }
+
+  inline uint64_t ticks_to_ns(uint64_t ticks) {
+    return ticks * 1000u;
+  }
+
+  /**
+   * @brief Fine-grained counter for timing short intervals (trace scopes,
+   *        waveform steps).
+   *
+   * ESP32 reads the CPU cycle counter, which is per core and wraps every
+   * ~18 s at 240 MHz; elsewhere it is ::micros(). Only the difference of two
+   * readings on the same core is meaningful: subtract them as uint32_t and
+   * convert with cycles_to_ns().
+   */
+  inline uint32_t cycles() {
+#if FLEXHAL_INTERNAL_ARDUINO_TIME_CYCLES
+    return ESP.getCycleCount();
+#else
+    return ::micros();
+#endif
+  }
+
+  /**
+   * @brief Converts a cycles() difference (or a sum of them) to nanoseconds.
+   *        Assumes the CPU frequency does not change after the first call.
+   */
+  inline uint64_t cycles_to_ns(uint64_t cycles) {
+#if FLEXHAL_INTERNAL_ARDUINO_TIME_CYCLES
+    static const uint32_t mhz = ESP.getCpuFreqMHz();
+    return cycles * 1000u / mhz;
+#else
+    return cycles * 1000u;
+#endif
+  }
+
 } // namespace flexhal::internal::framework::arduino::utils::time
@@ -4,7 +4,8 @@
 
 #if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
 
-// #include "native/utils.h"
+#include "native/utils.hpp"
+#include "native/hal.hpp"
 
 #endif
 
@@ -0,0 +1,8 @@
+#pragma once
+
+// Include HAL module headers for the native (desktop) platform
+#include "hal/gpio.hpp" // Simulated GPIO backed by a shared pin-state block
+#include "hal/adc.hpp"  // Simulated ADC sampling synthesized signals
+#include "hal/spi.hpp"  // Simulated SPI master with loopback and simulated devices
+#include "hal/i2c.hpp"  // Simulated I2C master with register-map devices
+#include "hal/uart.hpp" // UART over a socketpair, pseudo-terminal or file descriptor
@@ -0,0 +1,4 @@
+#pragma once
+
+// Include all headers from the adc implementation subdirectory
+#include "adc/NativeAdc.hpp"
@@ -0,0 +1,446 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/adc.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace adc {
+
+/**
+ * @brief A periodic test signal, in LSB of the converter.
+ */
+struct Waveform {
+    enum class Shape : uint8_t { Constant, Sine, Square, Triangle, Sawtooth };
+
+    Shape shape;
+    double frequency_hz;
+    double amplitude; ///< Peak deviation from offset.
+    double offset;    ///< Mid value.
+    uint32_t noise;   ///< Peak of the uniform noise added to every conversion (0 = none).
+};
+
+/**
+ * @brief User-supplied signal: the value of a channel, in LSB, at a simulated time.
+ */
+using SignalGenerator = double (*)(void* context, uint32_t channel, uint64_t time_ns);
+
+/**
+ * @brief Simulated ADC whose channels sample synthesized signals.
+ *
+ * Every channel has a source: a Waveform (the default is a constant 0), a
+ * SignalGenerator, or a sample sequence loaded from memory or a text file
+ * and played back in a loop. Conversions are rounded and clamped to the
+ * resolution, so oversampling and averaging behave as on hardware.
+ *
+ * Continuous acquisition runs on a dedicated thread that plays the role of
+ * the DMA controller; the buffer callbacks run on that thread. Signals are
+ * evaluated at the ideal time of each conversion (scans are spread over
+ * the scan period), so the data does not depend on scheduling jitter.
+ * - Real-time mode (default): the simulated time is the wall-clock time
+ *   since construction and scans are delivered at the scan rate. When the
+ *   thread falls more than a buffer behind, the missed scans are skipped
+ *   and counted as overruns.
+ * - Fast mode (setRealtime(false)): scans are produced as fast as possible
+ *   and the simulated time restarts at 0 on every startContinuous(), which
+ *   makes the buffer contents fully reproducible.
+ *
+ * Configure the sources before starting an acquisition.
+ */
+class NativeAdc : public flexhal::hal::adc::IAdc {
+public:
+    /**
+     * @param channel_count Number of channels.
+     * @param resolution_bits Sample resolution (1 to 16).
+     */
+    explicit NativeAdc(uint32_t channel_count = 8, uint8_t resolution_bits = 12);
+    ~NativeAdc() override;
+
+    NativeAdc(const NativeAdc&)            = delete;
+    NativeAdc& operator=(const NativeAdc&) = delete;
+
+    // --- IAdc Interface Implementation ---
+    uint32_t getNumberOfChannels() const override;
+    uint8_t getResolutionBits() const override;
+    base::status readScan(const flexhal::hal::adc::ScanGroup& group, flexhal::hal::adc::sample_t* out) override;
+    base::status startContinuous(const flexhal::hal::adc::ScanGroup& group,
+                                 const flexhal::hal::adc::ContinuousConfig& config) override;
+    void stopContinuous() override;
+    bool isContinuousRunning() const override;
+    uint32_t getOverrunCount() const override;
+    // --- End IAdc Interface ---
+
+    /**
+     * @return status::ok, or status::param for an invalid channel.
+     */
+    base::status setWaveform(uint32_t channel, const Waveform& waveform);
+
+    /**
+     * @return status::ok, or status::param for an invalid channel or a null generator.
+     */
+    base::status setGenerator(uint32_t channel, SignalGenerator generator, void* context);
+
+    /**
+     * @brief Plays back a copy of samples at sample_rate_hz, looping at the end.
+     * @return status::ok, or status::param for an invalid channel, empty data or a zero rate.
+     */
+    base::status setSamples(uint32_t channel, const flexhal::hal::adc::sample_t* samples, size_t count,
+                            uint32_t sample_rate_hz);
+
+    /**
+     * @brief Loads samples from a text file and plays them back like setSamples().
+     *
+     * Values are separated by whitespace or commas (one per line, or a
+     * single CSV column or row); lines starting with '#' are comments.
+     * @return status::ok, status::io if the file cannot be read, or
+     *         status::param if it contains no values.
+     */
+    base::status loadSamples(uint32_t channel, const char* path, uint32_t sample_rate_hz);
+
+    /**
+     * @brief Selects real-time (default) or fast continuous acquisition; takes
+     *        effect at the next startContinuous().
+     */
+    void setRealtime(bool realtime) {
+        _realtime = realtime;
+    }
+
+    /**
+     * @brief Conversions performed since construction (each oversample counts).
+     */
+    uint64_t getConversionCount() const {
+        return _conversions.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Source {
+        enum class Kind : uint8_t { Waveform, Generator, Samples };
+
+        Kind kind;
+        Waveform waveform;
+        SignalGenerator generator;
+        void* context;
+        std::vector<flexhal::hal::adc::sample_t> samples;
+        uint32_t sample_rate_hz;
+    };
+
+    flexhal::hal::adc::sample_t convert(uint32_t channel, uint64_t time_ns);
+    void scan(const flexhal::hal::adc::ScanGroup& group, uint64_t time_ns, uint64_t period_ns,
+              flexhal::hal::adc::sample_t* out);
+    void run();
+
+    std::unique_ptr<Source[]> _sources;
+    uint32_t _channel_count;
+    uint8_t _resolution_bits;
+    uint32_t _max_value;
+    uint32_t _noise_state;
+    uint64_t _origin_ns;
+    bool _realtime;
+
+    flexhal::hal::adc::ScanGroup _group;
+    flexhal::hal::adc::ScanBuffer _buffer;
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::atomic<uint64_t> _conversions;
+    std::atomic<uint32_t> _overruns;
+};
+
+} // namespace adc
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_ADC_NATIVEADC_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_ADC_NATIVEADC_IPP
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace adc {
+
+using flexhal::hal::adc::sample_t;
+
+NativeAdc::NativeAdc(uint32_t channel_count, uint8_t resolution_bits)
+    : _sources(new Source[channel_count ? channel_count : 1]),
+      _channel_count(channel_count ? channel_count : 1),
+      _resolution_bits(resolution_bits < 1 ? 1 : (resolution_bits > 16 ? 16 : resolution_bits)),
+      _max_value(0),
+      _noise_state(0x2545F491u),
+      _origin_ns(flexhal::utils::time::nanos64()),
+      _realtime(true),
+      _group(),
+      _running(false),
+      _conversions(0),
+      _overruns(0)
+{
+    _max_value = (1u << _resolution_bits) - 1u;
+    for (uint32_t i = 0; i < _channel_count; ++i) {
+        _sources[i].kind           = Source::Kind::Waveform;
+        _sources[i].waveform       = Waveform{Waveform::Shape::Constant, 0.0, 0.0, 0.0, 0};
+        _sources[i].generator      = nullptr;
+        _sources[i].context        = nullptr;
+        _sources[i].sample_rate_hz = 0;
+    }
+}
+
+NativeAdc::~NativeAdc() {
+    stopContinuous();
+}
+
+uint32_t NativeAdc::getNumberOfChannels() const {
+    return _channel_count;
+}
+
+uint8_t NativeAdc::getResolutionBits() const {
+    return _resolution_bits;
+}
+
+uint32_t NativeAdc::getOverrunCount() const {
+    return _overruns.load(std::memory_order_relaxed);
+}
+
+bool NativeAdc::isContinuousRunning() const {
+    return _running.load(std::memory_order_relaxed);
+}
+
+base::status NativeAdc::setWaveform(uint32_t channel, const Waveform& waveform) {
+    if (channel >= _channel_count) {
+        return base::status::param;
+    }
+    _sources[channel].kind     = Source::Kind::Waveform;
+    _sources[channel].waveform = waveform;
+    return base::status::ok;
+}
+
+base::status NativeAdc::setGenerator(uint32_t channel, SignalGenerator generator, void* context) {
+    if (channel >= _channel_count || generator == nullptr) {
+        return base::status::param;
+    }
+    _sources[channel].kind      = Source::Kind::Generator;
+    _sources[channel].generator = generator;
+    _sources[channel].context   = context;
+    return base::status::ok;
+}
+
+base::status NativeAdc::setSamples(uint32_t channel, const sample_t* samples, size_t count, uint32_t sample_rate_hz) {
+    if (channel >= _channel_count || samples == nullptr || count == 0 || sample_rate_hz == 0) {
+        return base::status::param;
+    }
+    _sources[channel].kind = Source::Kind::Samples;
+    _sources[channel].samples.assign(samples, samples + count);
+    _sources[channel].sample_rate_hz = sample_rate_hz;
+    return base::status::ok;
+}
+
+base::status NativeAdc::loadSamples(uint32_t channel, const char* path, uint32_t sample_rate_hz) {
+    FILE* in = fopen(path, "r");
+    if (in == nullptr) {
+        return base::status::io;
+    }
+    std::string text;
+    char chunk[512];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+        text.append(chunk, n);
+    }
+    const bool failed = ferror(in) != 0;
+    fclose(in);
+    if (failed) {
+        return base::status::io;
+    }
+
+    std::vector<sample_t> values;
+    const char* p = text.c_str();
+    while (*p != '\0') {
+        if (*p == '#') {
+            while (*p != '\0' && *p != '\n') ++p;
+            continue;
+        }
+        char* end;
+        const double v = strtod(p, &end);
+        if (end == p) {
+            ++p; // Separator
+            continue;
+        }
+        values.push_back(static_cast<sample_t>(v <= 0.0 ? 0.0 : (v >= _max_value ? _max_value : std::lround(v))));
+        p = end;
+    }
+    if (values.empty()) {
+        return base::status::param;
+    }
+    return setSamples(channel, values.data(), values.size(), sample_rate_hz);
+}
+
+sample_t NativeAdc::convert(uint32_t channel, uint64_t time_ns) {
+    const Source& source = _sources[channel];
+    double value         = 0.0;
+    switch (source.kind) {
+    case Source::Kind::Waveform: {
+        const Waveform& w  = source.waveform;
+        const double phase = std::fmod(static_cast<double>(time_ns) * 1e-9 * w.frequency_hz, 1.0);
+        switch (w.shape) {
+        case Waveform::Shape::Constant:
+            value = w.offset;
+            break;
+        case Waveform::Shape::Sine:
+            value = w.offset + w.amplitude * std::sin(6.283185307179586 * phase);
+            break;
+        case Waveform::Shape::Square:
+            value = w.offset + (phase < 0.5 ? w.amplitude : -w.amplitude);
+            break;
+        case Waveform::Shape::Triangle:
+            value = w.offset + w.amplitude * (phase < 0.5 ? 4.0 * phase - 1.0 : 3.0 - 4.0 * phase);
+            break;
+        case Waveform::Shape::Sawtooth:
+            value = w.offset + w.amplitude * (2.0 * phase - 1.0);
+            break;
+        }
+        if (w.noise != 0) {
+            // xorshift32: cheap and reproducible across runs.
+            _noise_state ^= _noise_state << 13;
+            _noise_state ^= _noise_state >> 17;
+            _noise_state ^= _noise_state << 5;
+            value += static_cast<double>(_noise_state % (2u * w.noise + 1u)) - static_cast<double>(w.noise);
+        }
+        break;
+    }
+    case Source::Kind::Generator:
+        value = source.generator(source.context, channel, time_ns);
+        break;
+    case Source::Kind::Samples: {
+        const uint64_t index = static_cast<uint64_t>(static_cast<double>(time_ns) * 1e-9 * source.sample_rate_hz);
+        value                = source.samples[index % source.samples.size()];
+        break;
+    }
+    }
+    _conversions.fetch_add(1, std::memory_order_relaxed);
+    if (!(value > 0.0)) return 0; // Also catches NaN
+    if (value >= _max_value) return static_cast<sample_t>(_max_value);
+    return static_cast<sample_t>(std::lround(value));
+}
+
+// Converts one scan, spreading the conversions evenly over period_ns.
+void NativeAdc::scan(const flexhal::hal::adc::ScanGroup& group, uint64_t time_ns, uint64_t period_ns, sample_t* out) {
+    const uint32_t oversampling = group.oversampling ? group.oversampling : 1;
+    const uint64_t steps        = static_cast<uint64_t>(group.channel_count) * oversampling;
+    uint64_t step               = 0;
+    for (uint32_t i = 0; i < group.channel_count; ++i) {
+        uint32_t sum = 0;
+        for (uint32_t j = 0; j < oversampling; ++j, ++step) {
+            sum += convert(group.channels[i], time_ns + period_ns * step / steps);
+        }
+        out[i] = flexhal::hal::adc::average_samples(sum, oversampling);
+    }
+}
+
+base::status NativeAdc::readScan(const flexhal::hal::adc::ScanGroup& group, sample_t* out) {
+    if (out == nullptr || flexhal::hal::adc::check_scan_group(group, _channel_count) != base::status::ok) {
+        return base::status::param;
+    }
+    if (isContinuousRunning()) {
+        return base::status::busy;
+    }
+    // Roughly 1 us per conversion, like a typical SAR converter.
+    const uint64_t oversampling = group.oversampling ? group.oversampling : 1;
+    scan(group, flexhal::utils::time::nanos64() - _origin_ns, group.channel_count * oversampling * 1000u, out);
+    return base::status::ok;
+}
+
+base::status NativeAdc::startContinuous(const flexhal::hal::adc::ScanGroup& group,
+                                        const flexhal::hal::adc::ContinuousConfig& config) {
+    if (flexhal::hal::adc::check_scan_group(group, _channel_count) != base::status::ok) {
+        return base::status::param;
+    }
+    if (isContinuousRunning()) {
+        return base::status::busy;
+    }
+    if (_thread.joinable()) {
+        _thread.join(); // Stopped from its own callback
+    }
+    if (_buffer.reset(config, group.channel_count) != base::status::ok) {
+        return base::status::param;
+    }
+    _group = group;
+    _overruns.store(0, std::memory_order_relaxed);
+    _running.store(true, std::memory_order_release);
+    _thread = std::thread([this]() { run(); });
+    return base::status::ok;
+}
+
+void NativeAdc::stopContinuous() {
+    _running.store(false, std::memory_order_release);
+    if (_thread.joinable() && _thread.get_id() != std::this_thread::get_id()) {
+        _thread.join();
+    }
+}
+
+void NativeAdc::run() {
+    const flexhal::hal::adc::ContinuousConfig& config = _buffer.getConfig();
+    const uint64_t rate                                = config.scan_rate_hz;
+    const uint64_t period_ns                           = 1000000000u / rate;
+    const uint64_t buffer_scans                        = config.length / _group.channel_count;
+    const uint64_t start_ns = _realtime ? flexhal::utils::time::nanos64() - _origin_ns : 0;
+    uint64_t index          = 0; // Scans since start, including skipped ones
+
+    // Ideal time of scan k, computed from the start so that rounding never accumulates.
+    auto scan_time = [&](uint64_t k) { return start_ns + k * 1000000000u / rate; };
+
+    while (_running.load(std::memory_order_acquire)) {
+        if (_realtime) {
+            const uint64_t now = flexhal::utils::time::nanos64() - _origin_ns;
+            if (now < scan_time(index)) {
+                flexhal::utils::time::delay_us(static_cast<uint32_t>((scan_time(index) - now + 999u) / 1000u));
+                continue;
+            }
+            const uint64_t due = (now - start_ns) * rate / 1000000000u + 1; // Scans whose time has come
+            if (due > index + buffer_scans) {
+                _overruns.fetch_add(static_cast<uint32_t>(due - buffer_scans - index), std::memory_order_relaxed);
+                index = due - buffer_scans;
+            }
+            // Catch up in one burst, checking for stop at every scan.
+            while (index < due && _running.load(std::memory_order_acquire)) {
+                scan(_group, scan_time(index), period_ns, _buffer.next());
+                _buffer.commit();
+                ++index;
+            }
+        } else {
+            scan(_group, scan_time(index), period_ns, _buffer.next());
+            _buffer.commit();
+            ++index;
+        }
+    }
+}
+
+} // namespace adc
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_ADC_NATIVEADC_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
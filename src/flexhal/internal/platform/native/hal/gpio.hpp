@@ -0,0 +1,114 @@
+#pragma once
+
+// Include all headers from the gpio implementation subdirectory
+#include "gpio/PinStateBlock.hpp"
+#include "gpio/NativePin.hpp"
+#include "gpio/NativePort.hpp"
+#include "gpio/NativeGpio.hpp"
+#include "gpio/VcdWriter.hpp"
+
+#include "flexhal/base/status.hpp"      // For base::status
+#include "flexhal/hal/gpio.hpp"         // For PinMode etc.
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+// --- Functional API Declarations ---
+// Pin numbers are flat indices into default_block():
+// port = pin_number / pins_per_port, bit = pin_number % pins_per_port.
+
+/**
+ * @brief Sets the mode of a simulated pin.
+ *
+ * @param pin_number Flat pin number in the default block.
+ * @param mode The desired pin mode (flexhal::hal::gpio::PinMode).
+ * @return flexhal::base::status::ok on success, param if the pin does not exist.
+ */
+base::status pin_mode(uint32_t pin_number, flexhal::hal::gpio::PinMode mode);
+
+/**
+ * @brief Writes a digital value to a simulated pin.
+ *
+ * @param pin_number Flat pin number in the default block.
+ * @param level The value to write (true for HIGH, false for LOW).
+ * @return flexhal::base::status::ok on success, param if the pin does not exist.
+ */
+inline base::status digital_write(uint32_t pin_number, bool level) {
+    PinStateBlock& block = default_block();
+    const uint32_t width = block.getNumberOfPins();
+    if (pin_number >= width * block.getNumberOfPorts()) {
+        return base::status::param;
+    }
+    const uint32_t mask = 1u << (pin_number % width);
+    if (level) {
+        block.setBits(pin_number / width, mask);
+    } else {
+        block.clearBits(pin_number / width, mask);
+    }
+    return base::status::ok;
+}
+
+/**
+ * @brief Reads the digital value of a simulated pin.
+ *
+ * @param pin_number Flat pin number in the default block.
+ * @return 1 (HIGH), 0 (LOW), or a negative error code if the pin does not exist.
+ */
+inline int digital_read(uint32_t pin_number) {
+    PinStateBlock& block = default_block();
+    const uint32_t width = block.getNumberOfPins();
+    if (pin_number >= width * block.getNumberOfPorts()) {
+        return static_cast<int>(base::status::param);
+    }
+    return (block.read(pin_number / width) & (1u << (pin_number % width))) ? 1 : 0;
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+// Select this functional API for flexhal::hal::gpio::StaticPin unless another backend already did.
+#ifndef FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO
+#define FLEXHAL_INTERNAL_FLEXHAL_HAL_GPIO flexhal::internal::platform::native::hal::gpio
+#endif
+#include "flexhal/hal/gpio/StaticPin.hpp"
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_IMPL_
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_IMPL_
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+base::status pin_mode(uint32_t pin_number, flexhal::hal::gpio::PinMode mode) {
+    PinStateBlock& block = default_block();
+    const uint32_t width = block.getNumberOfPins();
+    if (width == 0 || pin_number >= width * block.getNumberOfPorts()) {
+        return base::status::param;
+    }
+    block.setConfig(pin_number / width, 1u << (pin_number % width), flexhal::hal::gpio::PinConfig(mode));
+    return base::status::ok;
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_IMPL_
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
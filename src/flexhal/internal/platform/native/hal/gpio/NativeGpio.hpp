@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "flexhal/hal/gpio/IGpio.hpp"
+#include "flexhal/hal/gpio/IPort.hpp"
+#include "flexhal/utils/memory.hpp"
+#include "PinStateBlock.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+class NativePort;
+
+/**
+ * @brief Simulated GPIO peripheral exposing the ports of a PinStateBlock.
+ *
+ * The block must be open before the NativeGpio is constructed; its geometry
+ * (port count and width) determines the ports and pins created here. Ports
+ * and pins are built contiguously in one arena: a caller-provided one, or
+ * else a single heap block of getArenaSize() bytes owned by the NativeGpio.
+ */
+class NativeGpio : public flexhal::hal::gpio::IGpio {
+public:
+    /**
+     * @brief Uses the process-wide default block (see default_block()).
+     */
+    NativeGpio();
+
+    /**
+     * @brief Uses a caller-managed block, e.g. a named shm block shared with another process.
+     */
+    explicit NativeGpio(PinStateBlock& block);
+
+    /**
+     * @brief Builds the ports and pins in arena, which needs getArenaSize(block) free bytes.
+     */
+    NativeGpio(PinStateBlock& block, flexhal::utils::memory::Arena& arena);
+    virtual ~NativeGpio();
+
+    NativeGpio(const NativeGpio&)            = delete;
+    NativeGpio& operator=(const NativeGpio&) = delete;
+
+    /**
+     * @brief Arena bytes needed for the ports and pins of block (including alignment).
+     */
+    static size_t getArenaSize(const PinStateBlock& block);
+
+    // --- IGpio Interface Implementation ---
+    uint32_t getNumberOfPorts() const override;
+    flexhal::hal::gpio::IPort& getPort(uint32_t port_index) override;
+    const flexhal::hal::gpio::IPort& getPort(uint32_t port_index) const override;
+    // --- End IGpio Interface ---
+
+    /**
+     * @brief The shared pin-state block behind this peripheral.
+     */
+    PinStateBlock& getBlock() {
+        return _block;
+    }
+
+private:
+    void build(flexhal::utils::memory::Arena& arena);
+
+    PinStateBlock& _block;
+    std::unique_ptr<std::max_align_t[]> _storage; // Backs _own_arena when no arena is given
+    flexhal::utils::memory::Arena _own_arena;
+    NativePort* _ports;
+    uint32_t _port_count;
+};
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEGPIO_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEGPIO_IPP
+
+#include <cassert>
+#include <cstdlib>
+#include "NativePort.hpp"
+#include "flexhal/utils/heap.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+namespace {
+
+std::max_align_t* allocate_arena_storage(size_t size) {
+    FLEXHAL_HEAP_SCOPE("gpio");
+    return new std::max_align_t[(size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)];
+}
+
+} // namespace
+
+NativeGpio::NativeGpio() : NativeGpio(default_block())
+{
+}
+
+NativeGpio::NativeGpio(PinStateBlock& block)
+    : _block(block),
+      _storage(allocate_arena_storage(getArenaSize(block))),
+      _own_arena(_storage.get(), getArenaSize(block)),
+      _ports(nullptr),
+      _port_count(0)
+{
+    build(_own_arena);
+}
+
+NativeGpio::NativeGpio(PinStateBlock& block, flexhal::utils::memory::Arena& arena)
+    : _block(block), _own_arena(nullptr, 0), _ports(nullptr), _port_count(0)
+{
+    build(arena);
+}
+
+NativeGpio::~NativeGpio() {
+    while (_port_count > 0) {
+        _ports[--_port_count].~NativePort();
+    }
+}
+
+size_t NativeGpio::getArenaSize(const PinStateBlock& block) {
+    return sizeof(NativePort) * block.getNumberOfPorts() + alignof(NativePort) - 1 +
+           NativePort::getArenaSize(block) * block.getNumberOfPorts();
+}
+
+void NativeGpio::build(flexhal::utils::memory::Arena& arena) {
+    assert(_block.isOpen() && "NativeGpio: PinStateBlock must be opened first");
+    const uint32_t port_count = _block.getNumberOfPorts();
+    _ports = arena.allocateArray<NativePort>(port_count);
+    if (_ports == nullptr) {
+        assert(false && "NativeGpio: arena too small for the ports");
+        abort();
+    }
+    for (; _port_count < port_count; ++_port_count) {
+        new (&_ports[_port_count]) NativePort(*this, _block, _port_count, arena);
+    }
+}
+
+uint32_t NativeGpio::getNumberOfPorts() const {
+    return _port_count;
+}
+
+flexhal::hal::gpio::IPort& NativeGpio::getPort(uint32_t port_index) {
+    if (port_index >= _port_count) {
+        assert(false && "NativeGpio::getPort: Invalid port_index");
+        abort();
+    }
+    return _ports[port_index];
+}
+
+const flexhal::hal::gpio::IPort& NativeGpio::getPort(uint32_t port_index) const {
+    if (port_index >= _port_count) {
+        assert(false && "NativeGpio::getPort(const): Invalid port_index");
+        abort();
+    }
+    return _ports[port_index];
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEGPIO_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
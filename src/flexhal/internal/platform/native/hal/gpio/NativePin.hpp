@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flexhal/hal/gpio/IPin.hpp"
+#include "flexhal/hal/gpio/IPort.hpp"
+#include "flexhal/hal/gpio.hpp"
+#include "PinStateBlock.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+/**
+ * @brief Simulated pin backed by one bit of a PinStateBlock port.
+ */
+class NativePin : public flexhal::hal::gpio::IPin {
+public:
+    NativePin(flexhal::hal::gpio::IPort& port, PinStateBlock& block, uint32_t pin_index);
+
+    // --- IPin Interface Implementation ---
+    flexhal::hal::gpio::IPort& getPort() override;
+    const flexhal::hal::gpio::IPort& getPort() const override;
+    uint32_t getPinIndex() const override;
+
+    flexhal::base::status setMode(flexhal::hal::gpio::PinMode mode) override;
+    flexhal::base::status setConfig(const flexhal::hal::gpio::PinConfig& config) override;
+
+    flexhal::base::status digitalWrite(bool level) override;
+    int digitalRead() const override;
+    flexhal::base::result<bool> tryDigitalRead() const override;
+
+    // Edges are injected by level changes made through the PinStateBlock
+    // (see PinStateBlock::attachInterrupt()).
+    using flexhal::hal::gpio::IPin::attachInterrupt;
+    flexhal::base::status attachInterrupt(flexhal::hal::gpio::PinEdge edge,
+                                          flexhal::hal::gpio::InterruptCallback callback,
+                                          void* context = nullptr) override;
+    flexhal::base::status detachInterrupt() override;
+    // --- End IPin Interface ---
+
+private:
+    flexhal::hal::gpio::IPort& _port;
+    PinStateBlock& _block;
+    uint32_t _port_index;
+    uint32_t _pin_index;
+    uint32_t _mask;
+};
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEPIN_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEPIN_IPP
+
+#include "flexhal/utils/trace.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+NativePin::NativePin(flexhal::hal::gpio::IPort& port, PinStateBlock& block, uint32_t pin_index)
+    : _port(port), _block(block), _port_index(port.getPortIndex()), _pin_index(pin_index), _mask(1u << pin_index)
+{
+}
+
+flexhal::hal::gpio::IPort& NativePin::getPort() {
+    return _port;
+}
+
+const flexhal::hal::gpio::IPort& NativePin::getPort() const {
+    return _port;
+}
+
+uint32_t NativePin::getPinIndex() const {
+    return _pin_index;
+}
+
+flexhal::base::status NativePin::setMode(flexhal::hal::gpio::PinMode mode) {
+    return setConfig(flexhal::hal::gpio::PinConfig(mode));
+}
+
+flexhal::base::status NativePin::setConfig(const flexhal::hal::gpio::PinConfig& config) {
+    _block.setConfig(_port_index, _mask, config);
+    return flexhal::base::status::ok;
+}
+
+flexhal::base::status NativePin::digitalWrite(bool level) {
+    FLEXHAL_TRACE_SCOPE("gpio.write");
+    if (level) {
+        _block.setBits(_port_index, _mask);
+    } else {
+        _block.clearBits(_port_index, _mask);
+    }
+    return flexhal::base::status::ok;
+}
+
+int NativePin::digitalRead() const {
+    FLEXHAL_TRACE_SCOPE("gpio.read");
+    return (_block.read(_port_index) & _mask) ? 1 : 0;
+}
+
+flexhal::base::result<bool> NativePin::tryDigitalRead() const {
+    FLEXHAL_TRACE_SCOPE("gpio.try_read");
+    return (_block.read(_port_index) & _mask) != 0;
+}
+
+flexhal::base::status NativePin::attachInterrupt(flexhal::hal::gpio::PinEdge edge,
+                                                 flexhal::hal::gpio::InterruptCallback callback, void* context) {
+    return _block.attachInterrupt(_port_index, _pin_index, edge, callback, context);
+}
+
+flexhal::base::status NativePin::detachInterrupt() {
+    return _block.detachInterrupt(_port_index, _pin_index);
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEPIN_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/hal/gpio/IPort.hpp"
+#include "flexhal/hal/gpio/IPin.hpp"
+#include "flexhal/utils/memory.hpp"
+#include "PinStateBlock.hpp"
+
+namespace flexhal { namespace hal { namespace gpio { class IGpio; } } }
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+class NativePin;
+
+/**
+ * @brief Simulated port mapped onto one PortState of a PinStateBlock.
+ *
+ * All pins are constructed up front, side by side in the arena given by the
+ * owning NativeGpio, so that getPin() never allocates.
+ */
+class NativePort : public flexhal::hal::gpio::IPort {
+public:
+    NativePort(flexhal::hal::gpio::IGpio& gpio, PinStateBlock& block, uint32_t port_index,
+               flexhal::utils::memory::Arena& arena);
+    virtual ~NativePort();
+
+    /**
+     * @brief Arena bytes needed for the pins of one port of block (including alignment).
+     */
+    static size_t getArenaSize(const PinStateBlock& block);
+
+    // --- IPort Interface Implementation ---
+    flexhal::hal::gpio::IGpio& getGpio() override;
+    const flexhal::hal::gpio::IGpio& getGpio() const override;
+    uint32_t getPortIndex() const override;
+    uint32_t getNumberOfPins() const override;
+
+    base::status write(uint32_t value) override;
+    uint32_t read() const override;
+    base::result<uint32_t> tryRead() const override;
+
+    // Single atomic operations on the shared block
+    base::status setBits(uint32_t mask) override;
+    base::status clearBits(uint32_t mask) override;
+    base::status toggleBits(uint32_t mask) override;
+    base::status writeMasked(uint32_t mask, uint32_t value) override;
+
+    flexhal::hal::gpio::IPin& getPin(uint32_t pin_index) override;
+    const flexhal::hal::gpio::IPin& getPin(uint32_t pin_index) const override;
+    // --- End IPort Interface ---
+
+private:
+    flexhal::hal::gpio::IGpio& _gpio;
+    PinStateBlock& _block;
+    uint32_t _port_index;
+    NativePin* _pins;
+    uint32_t _pin_count;
+};
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEPORT_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEPORT_IPP
+
+#include <cassert>
+#include <cstdlib>
+#include "NativePin.hpp"
+#include "flexhal/utils/trace.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+NativePort::NativePort(flexhal::hal::gpio::IGpio& gpio, PinStateBlock& block, uint32_t port_index,
+                       flexhal::utils::memory::Arena& arena)
+    : _gpio(gpio), _block(block), _port_index(port_index), _pins(nullptr), _pin_count(0)
+{
+    const uint32_t pin_count = block.getNumberOfPins();
+    _pins = arena.allocateArray<NativePin>(pin_count);
+    if (_pins == nullptr) {
+        assert(false && "NativePort: arena too small for the pins");
+        abort();
+    }
+    for (; _pin_count < pin_count; ++_pin_count) {
+        new (&_pins[_pin_count]) NativePin(*this, block, _pin_count);
+    }
+}
+
+NativePort::~NativePort() {
+    while (_pin_count > 0) {
+        _pins[--_pin_count].~NativePin();
+    }
+}
+
+size_t NativePort::getArenaSize(const PinStateBlock& block) {
+    return sizeof(NativePin) * block.getNumberOfPins() + alignof(NativePin) - 1;
+}
+
+flexhal::hal::gpio::IGpio& NativePort::getGpio() {
+    return _gpio;
+}
+
+const flexhal::hal::gpio::IGpio& NativePort::getGpio() const {
+    return _gpio;
+}
+
+uint32_t NativePort::getPortIndex() const {
+    return _port_index;
+}
+
+uint32_t NativePort::getNumberOfPins() const {
+    return _block.getNumberOfPins();
+}
+
+base::status NativePort::write(uint32_t value) {
+    FLEXHAL_TRACE_SCOPE("gpio.port_write");
+    _block.write(_port_index, value);
+    return base::status::ok;
+}
+
+uint32_t NativePort::read() const {
+    FLEXHAL_TRACE_SCOPE("gpio.port_read");
+    return _block.read(_port_index);
+}
+
+base::result<uint32_t> NativePort::tryRead() const {
+    FLEXHAL_TRACE_SCOPE("gpio.port_try_read");
+    return _block.read(_port_index);
+}
+
+base::status NativePort::setBits(uint32_t mask) {
+    _block.setBits(_port_index, mask);
+    return base::status::ok;
+}
+
+base::status NativePort::clearBits(uint32_t mask) {
+    _block.clearBits(_port_index, mask);
+    return base::status::ok;
+}
+
+base::status NativePort::toggleBits(uint32_t mask) {
+    _block.toggleBits(_port_index, mask);
+    return base::status::ok;
+}
+
+base::status NativePort::writeMasked(uint32_t mask, uint32_t value) {
+    _block.writeMasked(_port_index, mask, value);
+    return base::status::ok;
+}
+
+flexhal::hal::gpio::IPin& NativePort::getPin(uint32_t pin_index) {
+    if (pin_index >= _pin_count) {
+        assert(false && "NativePort::getPin: pin_index out of range");
+        abort();
+    }
+    return _pins[pin_index];
+}
+
+const flexhal::hal::gpio::IPin& NativePort::getPin(uint32_t pin_index) const {
+    if (pin_index >= _pin_count) {
+        assert(false && "NativePort::getPin(const): pin_index out of range");
+        abort();
+    }
+    return _pins[pin_index];
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_NATIVEPORT_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,557 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/gpio.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+/**
+ * @brief Geometry and backing store of a simulated pin-state block.
+ */
+struct PinStateBlockConfig {
+    uint32_t port_count    = 1;       ///< Number of ports in the block.
+    uint32_t pins_per_port = 32;      ///< Port width (1..32).
+    const char* shm_name   = nullptr; ///< POSIX shm name (e.g. "/flexhal_gpio"). nullptr = anonymous mapping.
+};
+
+/**
+ * @brief State of one simulated port, as laid out in the shared mapping.
+ *
+ * Each port occupies its own cache line so that processes toggling different
+ * ports do not contend. All fields are lock-free atomics and therefore
+ * address-free, which makes them usable across processes.
+ */
+struct alignas(64) PortState {
+    std::atomic<uint32_t> level;        ///< Current pin levels (bit n = pin n).
+    std::atomic<uint32_t> output;       ///< Pins configured as output.
+    std::atomic<uint32_t> pull_up;      ///< Pins with pull-up enabled.
+    std::atomic<uint32_t> pull_down;    ///< Pins with pull-down enabled.
+    std::atomic<uint64_t> timestamp_ns; ///< nanos64() time of the last level change.
+    std::atomic<uint64_t> change_count; ///< Incremented after every level change.
+};
+
+/**
+ * @brief Header placed at the start of the mapping.
+ */
+struct alignas(64) PinStateHeader {
+    std::atomic<uint32_t> magic; ///< Written last by the creator; attachers wait for it.
+    uint32_t version;
+    uint32_t port_count;
+    uint32_t pins_per_port;
+};
+
+/**
+ * @brief Memory-mapped block holding the level and configuration of simulated pins.
+ *
+ * The block can be anonymous (private to this process and its fork() children)
+ * or backed by a named POSIX shared-memory object so that independent processes
+ * (test harness, simulated peripheral, waveform viewer) observe the same pins.
+ * Level updates are single atomic operations on the mapping followed by a
+ * vDSO clock read, so no system call is made per write.
+ */
+class PinStateBlock {
+public:
+    static constexpr uint32_t MAGIC   = 0x4C48464Eu; // "NFHL"
+    static constexpr uint32_t VERSION = 1;
+
+    PinStateBlock() = default;
+    ~PinStateBlock();
+
+    PinStateBlock(const PinStateBlock&)            = delete;
+    PinStateBlock& operator=(const PinStateBlock&) = delete;
+
+    /**
+     * @brief Creates or attaches to the pin-state mapping.
+     * @param config Geometry and optional shm name. When attaching to an existing
+     *               named block, its geometry must match.
+     * @return ok, busy (already open / creator still initializing), param
+     *         (bad geometry or mismatch), io (mapping failed) or unsupported.
+     */
+    base::status open(const PinStateBlockConfig& config = PinStateBlockConfig());
+
+    /**
+     * @brief Unmaps the block. A named shm object is left in place.
+     */
+    void close();
+
+    /**
+     * @brief Removes a named shm object created by open().
+     */
+    static base::status unlink(const char* shm_name);
+
+    bool isOpen() const {
+        return _ports != nullptr;
+    }
+
+    uint32_t getNumberOfPorts() const {
+        return _port_count;
+    }
+
+    uint32_t getNumberOfPins() const {
+        return _pins_per_port;
+    }
+
+    /**
+     * @brief Mask of the valid pin bits of a port.
+     */
+    uint32_t getPinMask() const {
+        return _pin_mask;
+    }
+
+    /**
+     * @brief Direct access to a port's shared state (no bounds check).
+     */
+    PortState& port(uint32_t port_index) {
+        return _ports[port_index];
+    }
+    const PortState& port(uint32_t port_index) const {
+        return _ports[port_index];
+    }
+
+    uint32_t read(uint32_t port_index) const {
+        return _ports[port_index].level.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Replaces the whole port value.
+     */
+    void write(uint32_t port_index, uint32_t value) {
+        PortState& p = _ports[port_index];
+        value &= _pin_mask;
+        uint32_t old = p.level.exchange(value, std::memory_order_acq_rel);
+        if (old != value) notify(port_index, old, value, stamp(p));
+    }
+
+    /**
+     * @brief Drives the masked pins high with a single atomic OR.
+     */
+    void setBits(uint32_t port_index, uint32_t mask) {
+        PortState& p = _ports[port_index];
+        mask &= _pin_mask;
+        uint32_t old = p.level.fetch_or(mask, std::memory_order_acq_rel);
+        if ((old & mask) != mask) notify(port_index, old, old | mask, stamp(p));
+    }
+
+    /**
+     * @brief Drives the masked pins low with a single atomic AND.
+     */
+    void clearBits(uint32_t port_index, uint32_t mask) {
+        PortState& p = _ports[port_index];
+        uint32_t old = p.level.fetch_and(~mask, std::memory_order_acq_rel);
+        if (old & mask) notify(port_index, old, old & ~mask, stamp(p));
+    }
+
+    /**
+     * @brief Inverts the masked pins with a single atomic XOR.
+     */
+    void toggleBits(uint32_t port_index, uint32_t mask) {
+        mask &= _pin_mask;
+        if (mask == 0) return;
+        PortState& p = _ports[port_index];
+        uint32_t old = p.level.fetch_xor(mask, std::memory_order_acq_rel);
+        notify(port_index, old, old ^ mask, stamp(p));
+    }
+
+    /**
+     * @brief Replaces the masked pins with the corresponding bits of value.
+     *
+     * Implemented as a compare-exchange loop so concurrent writers of other
+     * pins in the same port are never lost.
+     */
+    void writeMasked(uint32_t port_index, uint32_t mask, uint32_t value) {
+        PortState& p = _ports[port_index];
+        mask &= _pin_mask;
+        uint32_t old = p.level.load(std::memory_order_relaxed);
+        uint32_t next;
+        do {
+            next = (old & ~mask) | (value & mask);
+            if (next == old) return;
+        } while (!p.level.compare_exchange_weak(old, next, std::memory_order_acq_rel, std::memory_order_relaxed));
+        notify(port_index, old, next, stamp(p));
+    }
+
+    /**
+     * @brief Updates the direction / pull masks of the masked pins.
+     */
+    void setConfig(uint32_t port_index, uint32_t mask, const flexhal::hal::gpio::PinConfig& config);
+
+    /**
+     * @brief Calls callback on matching edges of one pin, like a GPIO interrupt.
+     *
+     * The callback runs synchronously in the thread that changed the level
+     * (any of the write functions above), right after the change is stamped,
+     * which is how the simulation injects edges. Handlers are local to this
+     * process: changes made by other processes sharing a named block do not
+     * trigger them. Replaces a handler already attached to the pin; do not
+     * re-attach while another thread is changing that pin.
+     * @return ok, or param for an invalid port / pin or a null callback.
+     */
+    base::status attachInterrupt(uint32_t port_index, uint32_t pin_index, flexhal::hal::gpio::PinEdge edge,
+                                 flexhal::hal::gpio::InterruptCallback callback, void* context);
+
+    /**
+     * @brief Removes the handler of one pin. A callback already running in
+     *        another thread may still complete.
+     * @return ok, or param for an invalid port / pin.
+     */
+    base::status detachInterrupt(uint32_t port_index, uint32_t pin_index);
+
+    /**
+     * @brief Current time on the clock used for change timestamps.
+     */
+    static uint64_t now_ns();
+
+private:
+    struct InterruptHandler {
+        flexhal::hal::gpio::InterruptCallback callback;
+        void* context;
+    };
+
+    // Pins of one port with a handler, per edge direction.
+    struct InterruptMasks {
+        std::atomic<uint32_t> rising;
+        std::atomic<uint32_t> falling;
+    };
+
+    static uint64_t stamp(PortState& p) {
+        const uint64_t now = now_ns();
+        p.timestamp_ns.store(now, std::memory_order_relaxed);
+        p.change_count.fetch_add(1, std::memory_order_release);
+        return now;
+    }
+
+    // Costs one load per mask when no handler is attached to a changed pin.
+    void notify(uint32_t port_index, uint32_t old, uint32_t next, uint64_t timestamp_ns) {
+        const InterruptMasks& masks = _interrupt_masks[port_index];
+        const uint32_t changed      = old ^ next;
+        const uint32_t fired        = (changed & next & masks.rising.load(std::memory_order_acquire)) |
+                               (changed & ~next & masks.falling.load(std::memory_order_acquire));
+        if (fired) dispatch(port_index, fired, next, timestamp_ns);
+    }
+
+    void dispatch(uint32_t port_index, uint32_t fired, uint32_t level, uint64_t timestamp_ns);
+
+    static size_t mappingSize(uint32_t port_count) {
+        return sizeof(PinStateHeader) + sizeof(PortState) * port_count;
+    }
+
+    PinStateHeader* _header = nullptr;
+    PortState* _ports       = nullptr;
+    size_t _mapped_size     = 0;
+    uint32_t _port_count    = 0;
+    uint32_t _pins_per_port = 0;
+    uint32_t _pin_mask      = 0;
+    std::unique_ptr<uint8_t[]> _heap_storage; // Used when mmap is unavailable
+    std::unique_ptr<InterruptMasks[]> _interrupt_masks;  // Process-local, one per port
+    std::unique_ptr<InterruptHandler[]> _interrupt_handlers; // Process-local, one per pin
+};
+
+/**
+ * @brief Process-wide block used by the functional API and NativeGpio().
+ *
+ * Opened on first use with the default geometry (one 32-pin anonymous port)
+ * unless open_default_block() was called before. The first call should happen
+ * before other threads start using GPIO.
+ */
+PinStateBlock& default_block();
+
+/**
+ * @brief Re-opens the process-wide block with the given geometry / shm name.
+ * @note Must be called before any NativeGpio using the default block is created.
+ */
+base::status open_default_block(const PinStateBlockConfig& config);
+
+static_assert(sizeof(PortState) == 64, "PortState must occupy exactly one cache line");
+#ifdef FLEXHAL_INTERNAL_CPP17
+static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+              "Shared pin state requires address-free (lock-free) atomics");
+#endif
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_PINSTATEBLOCK_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_PINSTATEBLOCK_IPP
+
+#include <new>
+#include "flexhal/internal/platform/native/utils/time.hpp"
+#include "flexhal/utils/heap.hpp"
+
+#if __has_include(<sys/mman.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+ #define FLEXHAL_INTERNAL_NATIVE_GPIO_USE_MMAP 1
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+ #include <errno.h>
+ #include <time.h>
+#else
+ #define FLEXHAL_INTERNAL_NATIVE_GPIO_USE_MMAP 0
+#endif
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+PinStateBlock::~PinStateBlock() {
+    close();
+}
+
+uint64_t PinStateBlock::now_ns() {
+    // Same clock as flexhal::utils::time::nanos64(), so change timestamps can be
+    // compared with application timestamps directly.
+    return flexhal::internal::platform::native::utils::time::nanos64();
+}
+
+base::status PinStateBlock::open(const PinStateBlockConfig& config) {
+    if (isOpen()) {
+        return base::status::busy;
+    }
+    FLEXHAL_HEAP_SCOPE("gpio");
+    if (config.port_count == 0 || config.pins_per_port == 0 || config.pins_per_port > 32) {
+        return base::status::param;
+    }
+
+    const size_t size = mappingSize(config.port_count);
+    void* mem         = nullptr;
+    bool creator      = true;
+
+#if FLEXHAL_INTERNAL_NATIVE_GPIO_USE_MMAP
+    if (config.shm_name == nullptr) {
+        mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    } else {
+        int fd = shm_open(config.shm_name, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0 && errno == EEXIST) {
+            creator = false;
+            fd      = shm_open(config.shm_name, O_RDWR, 0600);
+        }
+        if (fd < 0) {
+            return base::status::io;
+        }
+        if (creator) {
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                ::close(fd);
+                shm_unlink(config.shm_name);
+                return base::status::io;
+            }
+        } else {
+            struct stat st;
+            if (fstat(fd, &st) != 0) {
+                ::close(fd);
+                return base::status::io;
+            }
+            if (st.st_size == 0) {
+                ::close(fd);
+                return base::status::busy; // Creator has not called ftruncate() yet
+            }
+            if (static_cast<size_t>(st.st_size) != size) {
+                ::close(fd);
+                return base::status::param; // Geometry differs from the existing block
+            }
+        }
+        mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd); // The mapping keeps the object alive
+    }
+    if (mem == MAP_FAILED) {
+        return base::status::io;
+    }
+#else
+    if (config.shm_name != nullptr) {
+        return base::status::unsupported;
+    }
+    _heap_storage.reset(new (std::nothrow) uint8_t[size + alignof(PinStateHeader)]);
+    if (!_heap_storage) {
+        return base::status::no_memory;
+    }
+    uintptr_t addr = reinterpret_cast<uintptr_t>(_heap_storage.get());
+    addr           = (addr + alignof(PinStateHeader) - 1) & ~(uintptr_t)(alignof(PinStateHeader) - 1);
+    mem            = reinterpret_cast<void*>(addr);
+#endif
+
+    auto* header = reinterpret_cast<PinStateHeader*>(mem);
+    auto* ports  = reinterpret_cast<PortState*>(reinterpret_cast<uint8_t*>(mem) + sizeof(PinStateHeader));
+
+    if (creator) {
+        // Fresh mappings are zero-filled; construct the atomics in place and publish the magic last.
+        for (uint32_t i = 0; i < config.port_count; ++i) {
+            PortState* p = new (&ports[i]) PortState();
+            p->level.store(0, std::memory_order_relaxed);
+            p->output.store(0, std::memory_order_relaxed);
+            p->pull_up.store(0, std::memory_order_relaxed);
+            p->pull_down.store(0, std::memory_order_relaxed);
+            p->timestamp_ns.store(0, std::memory_order_relaxed);
+            p->change_count.store(0, std::memory_order_relaxed);
+        }
+        new (header) PinStateHeader();
+        header->version       = VERSION;
+        header->port_count    = config.port_count;
+        header->pins_per_port = config.pins_per_port;
+        header->magic.store(MAGIC, std::memory_order_release);
+    } else if (header->magic.load(std::memory_order_acquire) != MAGIC) {
+#if FLEXHAL_INTERNAL_NATIVE_GPIO_USE_MMAP
+        munmap(mem, size);
+#endif
+        return base::status::busy; // Creator has not finished initializing
+    } else if (header->version != VERSION || header->port_count != config.port_count ||
+               header->pins_per_port != config.pins_per_port) {
+#if FLEXHAL_INTERNAL_NATIVE_GPIO_USE_MMAP
+        munmap(mem, size);
+#endif
+        return base::status::param;
+    }
+
+    _header        = header;
+    _ports         = ports;
+    _mapped_size   = size;
+    _port_count    = config.port_count;
+    _pins_per_port = config.pins_per_port;
+    _pin_mask      = (config.pins_per_port >= 32) ? 0xFFFFFFFFu : ((1u << config.pins_per_port) - 1u);
+
+    _interrupt_masks.reset(new InterruptMasks[config.port_count]);
+    _interrupt_handlers.reset(new InterruptHandler[config.port_count * config.pins_per_port]());
+    for (uint32_t i = 0; i < config.port_count; ++i) {
+        _interrupt_masks[i].rising.store(0, std::memory_order_relaxed);
+        _interrupt_masks[i].falling.store(0, std::memory_order_relaxed);
+    }
+    return base::status::ok;
+}
+
+void PinStateBlock::close() {
+    if (!isOpen()) {
+        return;
+    }
+#if FLEXHAL_INTERNAL_NATIVE_GPIO_USE_MMAP
+    munmap(_header, _mapped_size);
+#else
+    _heap_storage.reset();
+#endif
+    _header        = nullptr;
+    _ports         = nullptr;
+    _mapped_size   = 0;
+    _port_count    = 0;
+    _pins_per_port = 0;
+    _pin_mask      = 0;
+    _interrupt_masks.reset();
+    _interrupt_handlers.reset();
+}
+
+base::status PinStateBlock::attachInterrupt(uint32_t port_index, uint32_t pin_index, flexhal::hal::gpio::PinEdge edge,
+                                            flexhal::hal::gpio::InterruptCallback callback, void* context) {
+    if (port_index >= _port_count || pin_index >= _pins_per_port || callback == nullptr) {
+        return base::status::param;
+    }
+    const uint32_t bit     = 1u << pin_index;
+    InterruptMasks& masks  = _interrupt_masks[port_index];
+    masks.rising.fetch_and(~bit, std::memory_order_acq_rel);
+    masks.falling.fetch_and(~bit, std::memory_order_acq_rel);
+    _interrupt_handlers[port_index * _pins_per_port + pin_index] = InterruptHandler{callback, context};
+    // Publishing the mask bit (release) makes the handler visible to notify().
+    if (edge != flexhal::hal::gpio::PinEdge::Falling) {
+        masks.rising.fetch_or(bit, std::memory_order_release);
+    }
+    if (edge != flexhal::hal::gpio::PinEdge::Rising) {
+        masks.falling.fetch_or(bit, std::memory_order_release);
+    }
+    return base::status::ok;
+}
+
+base::status PinStateBlock::detachInterrupt(uint32_t port_index, uint32_t pin_index) {
+    if (port_index >= _port_count || pin_index >= _pins_per_port) {
+        return base::status::param;
+    }
+    const uint32_t bit = 1u << pin_index;
+    _interrupt_masks[port_index].rising.fetch_and(~bit, std::memory_order_acq_rel);
+    _interrupt_masks[port_index].falling.fetch_and(~bit, std::memory_order_acq_rel);
+    return base::status::ok;
+}
+
+void PinStateBlock::dispatch(uint32_t port_index, uint32_t fired, uint32_t level, uint64_t timestamp_ns) {
+    const InterruptHandler* handlers = &_interrupt_handlers[port_index * _pins_per_port];
+    while (fired) {
+        const uint32_t pin = static_cast<uint32_t>(__builtin_ctz(fired));
+        fired &= fired - 1;
+        const flexhal::hal::gpio::PinEvent event{timestamp_ns, static_cast<uint16_t>(port_index),
+                                                 static_cast<uint16_t>(pin), static_cast<uint8_t>((level >> pin) & 1u)};
+        handlers[pin].callback(handlers[pin].context, event);
+    }
+}
+
+void PinStateBlock::setConfig(uint32_t port_index, uint32_t mask, const flexhal::hal::gpio::PinConfig& config) {
+    PortState& p = _ports[port_index];
+    if (config.dir == flexhal::hal::gpio::PinDir::Input) {
+        p.output.fetch_and(~mask, std::memory_order_relaxed);
+    } else {
+        p.output.fetch_or(mask, std::memory_order_relaxed);
+    }
+    if (config.pull == flexhal::hal::gpio::PinPull::Up) {
+        p.pull_up.fetch_or(mask, std::memory_order_relaxed);
+    } else {
+        p.pull_up.fetch_and(~mask, std::memory_order_relaxed);
+    }
+    if (config.pull == flexhal::hal::gpio::PinPull::Down) {
+        p.pull_down.fetch_or(mask, std::memory_order_relaxed);
+    } else {
+        p.pull_down.fetch_and(~mask, std::memory_order_relaxed);
+    }
+}
+
+static PinStateBlock& default_block_storage() {
+    static PinStateBlock block;
+    return block;
+}
+
+PinStateBlock& default_block() {
+    PinStateBlock& block = default_block_storage();
+    if (!block.isOpen()) {
+        block.open();
+    }
+    return block;
+}
+
+base::status open_default_block(const PinStateBlockConfig& config) {
+    PinStateBlock& block = default_block_storage();
+    block.close();
+    return block.open(config);
+}
+
+base::status PinStateBlock::unlink(const char* shm_name) {
+#if FLEXHAL_INTERNAL_NATIVE_GPIO_USE_MMAP
+    if (shm_name == nullptr) {
+        return base::status::param;
+    }
+    return (shm_unlink(shm_name) == 0) ? base::status::ok : base::status::not_found;
+#else
+    (void)shm_name;
+    return base::status::unsupported;
+#endif
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_PINSTATEBLOCK_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdio>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/gpio/PortCapture.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+/**
+ * @brief Writes a PortCapture as a Value Change Dump (IEEE 1364 VCD) stream.
+ *
+ * One 1-bit wire per captured pin, in a scope named after the port, with a
+ * 1 us timescale. The file opens in GTKWave, PulseView, Surfer and similar
+ * waveform viewers.
+ *
+ * @param out Open output stream.
+ * @param capture A stopped capture.
+ * @param pin_names Optional names indexed by pin number (nullptr entries or
+ *                  a nullptr array fall back to "p<n>").
+ * @return ok, or io if writing failed.
+ */
+base::status write_vcd(FILE* out, const flexhal::hal::gpio::PortCapture& capture,
+                       const char* const* pin_names = nullptr);
+
+/**
+ * @brief Same as write_vcd(FILE*, ...), creating or truncating the file at path.
+ * @return ok, or io if the file cannot be written.
+ */
+base::status write_vcd(const char* path, const flexhal::hal::gpio::PortCapture& capture,
+                       const char* const* pin_names = nullptr);
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_VCDWRITER_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_VCDWRITER_IPP
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace gpio {
+
+namespace {
+// VCD identifiers are printable ASCII; one character per pin is enough for 32 pins.
+inline char vcd_id(uint32_t pin) {
+    return static_cast<char>('!' + pin);
+}
+} // namespace
+
+base::status write_vcd(FILE* out, const flexhal::hal::gpio::PortCapture& capture, const char* const* pin_names) {
+    const uint32_t mask                           = capture.getMask();
+    const flexhal::hal::gpio::CaptureRecord* recs = capture.getRecords();
+    const size_t count                            = capture.getRecordCount();
+
+    fprintf(out, "$version FlexHAL PortCapture $end\n");
+    fprintf(out, "$timescale 1us $end\n");
+    fprintf(out, "$scope module port%u $end\n", static_cast<unsigned>(capture.getPortIndex()));
+    for (uint32_t pin = 0; pin < 32; ++pin) {
+        if (!(mask & (1u << pin))) continue;
+        if (pin_names != nullptr && pin_names[pin] != nullptr) {
+            fprintf(out, "$var wire 1 %c %s $end\n", vcd_id(pin), pin_names[pin]);
+        } else {
+            fprintf(out, "$var wire 1 %c p%u $end\n", vcd_id(pin), static_cast<unsigned>(pin));
+        }
+    }
+    fprintf(out, "$upscope $end\n$enddefinitions $end\n");
+
+    uint32_t previous = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t changed = (i == 0) ? mask : (recs[i].value ^ previous) & mask;
+        fprintf(out, "#%lu\n", static_cast<unsigned long>(recs[i].time_us));
+        if (i == 0) fprintf(out, "$dumpvars\n");
+        for (uint32_t bits = changed; bits != 0; bits &= bits - 1) {
+            const uint32_t pin = static_cast<uint32_t>(__builtin_ctz(bits));
+            fprintf(out, "%c%c\n", (recs[i].value >> pin) & 1u ? '1' : '0', vcd_id(pin));
+        }
+        if (i == 0) fprintf(out, "$end\n");
+        previous = recs[i].value;
+    }
+    // Final timestamp so viewers show the last run with its full length.
+    const uint32_t end = capture.getDuration_us();
+    if (count == 0 || end > recs[count - 1].time_us) {
+        fprintf(out, "#%lu\n", static_cast<unsigned long>(end));
+    }
+    return ferror(out) ? base::status::io : base::status::ok;
+}
+
+base::status write_vcd(const char* path, const flexhal::hal::gpio::PortCapture& capture, const char* const* pin_names) {
+    FILE* out = fopen(path, "w");
+    if (out == nullptr) {
+        return base::status::io;
+    }
+    base::status result = write_vcd(out, capture, pin_names);
+    if (fclose(out) != 0 && result == base::status::ok) {
+        result = base::status::io;
+    }
+    return result;
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_GPIO_VCDWRITER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,5 @@
+#pragma once
+
+// Include all headers from the i2c implementation subdirectory
+#include "i2c/I2cSimDevice.hpp"
+#include "i2c/NativeI2c.hpp"
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace i2c {
+
+/**
+ * @brief A simulated target attached to a NativeI2c bus.
+ */
+class I2cSimDevice {
+public:
+    virtual ~I2cSimDevice() = default;
+
+    /**
+     * @brief The device's address was sent after a START or repeated START.
+     * @return true to acknowledge, false to NACK the address.
+     */
+    virtual bool start(bool read) {
+        (void)read;
+        return true;
+    }
+
+    /**
+     * @brief Bytes written by the master.
+     * @return false to NACK them.
+     */
+    virtual bool write(const uint8_t* data, size_t length) = 0;
+
+    /**
+     * @brief Bytes read by the master.
+     */
+    virtual void read(uint8_t* data, size_t length) = 0;
+
+    /**
+     * @brief STOP condition.
+     */
+    virtual void stop() {
+    }
+};
+
+/**
+ * @brief Scriptable register-map device, as most I2C sensors are.
+ *
+ * The first byte written after the address sets the register pointer and
+ * the following bytes are stored from there; reads return registers from
+ * the pointer. The pointer auto-increments (wrapping at the end of the map)
+ * unless disabled. Hooks can compute register values on read or react to
+ * writes, to script sensor behaviour; setNack() simulates an absent device.
+ */
+class I2cRegisterDevice : public I2cSimDevice {
+public:
+    /// Value returned for a read of reg; value is the stored register content.
+    using ReadHook = uint8_t (*)(void* context, uint8_t reg, uint8_t value);
+    /// Called after value was stored into reg.
+    using WriteHook = void (*)(void* context, uint8_t reg, uint8_t value);
+
+    explicit I2cRegisterDevice(size_t register_count = 256);
+
+    bool start(bool read) override;
+    bool write(const uint8_t* data, size_t length) override;
+    void read(uint8_t* data, size_t length) override;
+
+    uint8_t getRegister(uint8_t reg) const {
+        return _registers[reg % _registers.size()];
+    }
+
+    void setRegister(uint8_t reg, uint8_t value) {
+        _registers[reg % _registers.size()] = value;
+    }
+
+    void setReadHook(ReadHook hook, void* context) {
+        _read_hook    = hook;
+        _read_context = context;
+    }
+
+    void setWriteHook(WriteHook hook, void* context) {
+        _write_hook    = hook;
+        _write_context = context;
+    }
+
+    void setAutoIncrement(bool enable) {
+        _auto_increment = enable;
+    }
+
+    void setNack(bool nack) {
+        _nack = nack;
+    }
+
+    /**
+     * @brief Address phases acknowledged so far.
+     */
+    uint32_t getAccessCount() const {
+        return _accesses;
+    }
+
+private:
+    void advance();
+
+    std::vector<uint8_t> _registers;
+    ReadHook _read_hook;
+    WriteHook _write_hook;
+    void* _read_context;
+    void* _write_context;
+    uint32_t _pointer;
+    uint32_t _accesses;
+    bool _pointer_pending; // Next written byte is the register pointer
+    bool _auto_increment;
+    bool _nack;
+};
+
+} // namespace i2c
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_I2C_I2CSIMDEVICE_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_I2C_I2CSIMDEVICE_IPP
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace i2c {
+
+I2cRegisterDevice::I2cRegisterDevice(size_t register_count)
+    : _registers(register_count ? register_count : 1, 0),
+      _read_hook(nullptr),
+      _write_hook(nullptr),
+      _read_context(nullptr),
+      _write_context(nullptr),
+      _pointer(0),
+      _accesses(0),
+      _pointer_pending(false),
+      _auto_increment(true),
+      _nack(false)
+{
+}
+
+bool I2cRegisterDevice::start(bool read) {
+    if (_nack) return false;
+    ++_accesses;
+    _pointer_pending = !read;
+    return true;
+}
+
+void I2cRegisterDevice::advance() {
+    if (_auto_increment) {
+        _pointer = (_pointer + 1) % _registers.size();
+    }
+}
+
+bool I2cRegisterDevice::write(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        if (_pointer_pending) {
+            _pointer         = data[i] % _registers.size();
+            _pointer_pending = false;
+            continue;
+        }
+        _registers[_pointer] = data[i];
+        if (_write_hook) _write_hook(_write_context, static_cast<uint8_t>(_pointer), data[i]);
+        advance();
+    }
+    return true;
+}
+
+void I2cRegisterDevice::read(uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        const uint8_t value = _registers[_pointer];
+        data[i] = _read_hook ? _read_hook(_read_context, static_cast<uint8_t>(_pointer), value) : value;
+        advance();
+    }
+}
+
+} // namespace i2c
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_I2C_I2CSIMDEVICE_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
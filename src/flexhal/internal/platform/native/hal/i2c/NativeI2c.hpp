@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/i2c.hpp"
+#include "I2cSimDevice.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace i2c {
+
+/**
+ * @brief Simulated I2C master with I2cSimDevices attached by address.
+ *
+ * Unattached addresses NACK. The bus occupancy of every message is
+ * accounted in bit times at the configured clock (9 per byte including the
+ * ACK, 1 per START / repeated START, 2 per STOP including the bus-free time
+ * before the next START), so getBusTime_ns() shows what a schedule would
+ * cost on a real bus; setSimulateClock(true) also makes each message take
+ * that long in wall-clock time.
+ */
+class NativeI2c : public flexhal::hal::i2c::I2cBus {
+public:
+    explicit NativeI2c(uint32_t clock_hz = 400000);
+
+    NativeI2c(const NativeI2c&)            = delete;
+    NativeI2c& operator=(const NativeI2c&) = delete;
+
+    /**
+     * @brief Attaches device at a 7-bit address (replacing any previous one).
+     * @return status::ok, or status::param for an invalid address.
+     */
+    base::status attachDevice(uint16_t address, I2cSimDevice& device);
+
+    void detachDevice(uint16_t address);
+
+    void setSimulateClock(bool simulate) {
+        _simulate_clock = simulate;
+    }
+
+    /**
+     * @brief Simulated bus occupancy since construction or the last resetBusTime().
+     */
+    uint64_t getBusTime_ns() const {
+        return _bus_time_ns;
+    }
+
+    void resetBusTime() {
+        _bus_time_ns = 0;
+    }
+
+protected:
+    base::status transferMessage(uint16_t address, const uint8_t* write, size_t write_length, uint8_t* read,
+                                 size_t read_length, bool stop) override;
+
+private:
+    I2cSimDevice* _devices[128];
+    uint32_t _clock_hz;
+    uint64_t _bus_time_ns;
+    bool _simulate_clock;
+};
+
+} // namespace i2c
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_I2C_NATIVEI2C_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_I2C_NATIVEI2C_IPP
+
+#include "flexhal/utils/time.hpp"
+#include "flexhal/utils/trace.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace i2c {
+
+NativeI2c::NativeI2c(uint32_t clock_hz)
+    : _devices(), _clock_hz(clock_hz ? clock_hz : 100000), _bus_time_ns(0), _simulate_clock(false)
+{
+}
+
+base::status NativeI2c::attachDevice(uint16_t address, I2cSimDevice& device) {
+    if (address > 0x7F) {
+        return base::status::param;
+    }
+    _devices[address] = &device;
+    return base::status::ok;
+}
+
+void NativeI2c::detachDevice(uint16_t address) {
+    if (address <= 0x7F) {
+        _devices[address] = nullptr;
+    }
+}
+
+base::status NativeI2c::transferMessage(uint16_t address, const uint8_t* write, size_t write_length, uint8_t* read,
+                                        size_t read_length, bool stop) {
+    FLEXHAL_TRACE_SCOPE("i2c.transfer");
+    const uint64_t start = _simulate_clock ? flexhal::utils::time::nanos64() : 0;
+    I2cSimDevice* device = _devices[address & 0x7F];
+    base::status result  = base::status::ok;
+    uint64_t bits        = 1; // START or repeated START
+
+    if (write_length > 0 || read_length == 0) {
+        bits += 9;
+        if (device == nullptr || !device->start(false)) {
+            result = base::status::not_found;
+        } else {
+            bits += 9u * write_length;
+            if (write_length > 0 && !device->write(write, write_length)) {
+                result = base::status::io;
+            }
+        }
+    }
+    if (result == base::status::ok && read_length > 0) {
+        if (write_length > 0) bits += 1; // Repeated START between the phases
+        bits += 9;
+        if (device == nullptr || !device->start(true)) {
+            result = base::status::not_found;
+        } else {
+            bits += 9u * read_length;
+            device->read(read, read_length);
+        }
+    }
+    if (stop || result != base::status::ok) {
+        bits += 2;
+        if (device != nullptr) device->stop();
+    }
+
+    const uint64_t duration = bits * 1000000000u / _clock_hz;
+    _bus_time_ns += duration;
+    if (_simulate_clock) {
+        while (flexhal::utils::time::nanos64() - start < duration) {
+        }
+    }
+    return result;
+}
+
+} // namespace i2c
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_I2C_NATIVEI2C_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,5 @@
+#pragma once
+
+// Include all headers from the spi implementation subdirectory
+#include "spi/SpiSimDevice.hpp"
+#include "spi/NativeSpi.hpp"
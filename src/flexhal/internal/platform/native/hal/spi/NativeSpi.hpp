@@ -0,0 +1,294 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/spi.hpp"
+#include "SpiSimDevice.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace spi {
+
+/**
+ * @brief Simulated SPI master.
+ *
+ * Each device can be attached to a SpiSimDevice; transactions for devices
+ * without one are looped back (MISO = MOSI). CS pins are driven like on
+ * hardware, so they show up in a PinStateBlock or PortCapture.
+ *
+ * In threaded mode (the default) a worker thread plays the role of the DMA
+ * controller: submit() only links the descriptor into the queue and the
+ * worker executes it and runs the callback. Otherwise the queue is executed
+ * by poll() on the caller's thread, which measures the bare per-transaction
+ * cost of the driver.
+ *
+ * The bus is infinitely fast unless setSimulateClock(true) makes every
+ * transaction last its length at the device's clock_hz.
+ */
+class NativeSpi : public flexhal::hal::spi::ISpi {
+public:
+    explicit NativeSpi(bool threaded = true);
+    ~NativeSpi() override;
+
+    NativeSpi(const NativeSpi&)            = delete;
+    NativeSpi& operator=(const NativeSpi&) = delete;
+
+    // --- ISpi Interface Implementation ---
+    base::status submit(flexhal::hal::spi::SpiTransaction& transaction) override;
+    void poll() override;
+    bool isIdle() const override;
+    // --- End ISpi Interface ---
+
+    /**
+     * @brief Routes the transactions of device to sim (replacing any previous one).
+     *        Call while the bus is idle.
+     */
+    void attachDevice(const flexhal::hal::spi::SpiDevice& device, SpiSimDevice& sim);
+
+    void setSimulateClock(bool simulate) {
+        _simulate_clock = simulate;
+    }
+
+    uint64_t getTransactionCount() const {
+        return _transactions.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getByteCount() const {
+        return _bytes.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Frames so far, i.e. times a device was selected (keep_cs chains count once).
+     */
+    uint32_t getFrameCount() const {
+        return _frames.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Attachment {
+        const flexhal::hal::spi::SpiDevice* device;
+        SpiSimDevice* sim;
+    };
+
+    SpiSimDevice* findSim(const flexhal::hal::spi::SpiDevice* device) const;
+    void select(const flexhal::hal::spi::SpiDevice* device);
+    void deselect();
+    void execute(flexhal::hal::spi::SpiTransaction& transaction);
+    void drain(std::unique_lock<std::mutex>& lock);
+
+    std::vector<Attachment> _attachments;
+    const flexhal::hal::spi::SpiDevice* _selected;
+    SpiSimDevice* _selected_sim;
+    bool _threaded;
+    bool _simulate_clock;
+
+    flexhal::hal::spi::SpiQueue _queue;
+    mutable std::mutex _mutex;
+    std::condition_variable _wake;
+    std::thread _thread;
+    bool _stop;
+    bool _draining; // A thread is executing transactions outside the lock
+
+    std::atomic<uint32_t> _pending;
+    std::atomic<uint64_t> _transactions;
+    std::atomic<uint64_t> _bytes;
+    std::atomic<uint32_t> _frames;
+};
+
+} // namespace spi
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_SPI_NATIVESPI_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_SPI_NATIVESPI_IPP
+
+#include <cstring>
+
+#include "flexhal/utils/heap.hpp"
+#include "flexhal/utils/time.hpp"
+#include "flexhal/utils/trace.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace spi {
+
+using flexhal::hal::spi::SpiDevice;
+using flexhal::hal::spi::SpiTransaction;
+
+NativeSpi::NativeSpi(bool threaded)
+    : _selected(nullptr),
+      _selected_sim(nullptr),
+      _threaded(threaded),
+      _simulate_clock(false),
+      _stop(false),
+      _draining(false),
+      _pending(0),
+      _transactions(0),
+      _bytes(0),
+      _frames(0)
+{
+    if (_threaded) {
+        _thread = std::thread([this]() {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (!_stop) {
+                _wake.wait(lock, [this]() { return _stop || !_queue.empty(); });
+                drain(lock);
+            }
+        });
+    }
+}
+
+NativeSpi::~NativeSpi() {
+    if (_threaded) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_one();
+        _thread.join();
+    }
+    deselect();
+}
+
+void NativeSpi::attachDevice(const SpiDevice& device, SpiSimDevice& sim) {
+    for (Attachment& attachment : _attachments) {
+        if (attachment.device == &device) {
+            attachment.sim = &sim;
+            return;
+        }
+    }
+    FLEXHAL_HEAP_SCOPE("spi");
+    _attachments.push_back(Attachment{&device, &sim});
+}
+
+SpiSimDevice* NativeSpi::findSim(const SpiDevice* device) const {
+    for (const Attachment& attachment : _attachments) {
+        if (attachment.device == device) return attachment.sim;
+    }
+    return nullptr;
+}
+
+base::status NativeSpi::submit(SpiTransaction& transaction) {
+    FLEXHAL_TRACE_SCOPE("spi.submit");
+    if (transaction.device == nullptr || transaction.length == 0) {
+        return base::status::param;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (transaction.result.load(std::memory_order_relaxed) == base::status::pending) {
+            return base::status::busy;
+        }
+        transaction.result.store(base::status::pending, std::memory_order_relaxed);
+        _pending.fetch_add(1, std::memory_order_relaxed);
+        _queue.push(transaction);
+    }
+    if (_threaded) {
+        _wake.notify_one();
+    }
+    return base::status::ok;
+}
+
+void NativeSpi::poll() {
+    if (_threaded) {
+        // Waiting callers spin on poll(): let the worker have the CPU.
+        if (!isIdle()) std::this_thread::yield();
+        return;
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_draining) drain(lock); // Not re-entered from a callback
+}
+
+bool NativeSpi::isIdle() const {
+    return _pending.load(std::memory_order_acquire) == 0;
+}
+
+// Executes queued transactions with the lock released around each one.
+void NativeSpi::drain(std::unique_lock<std::mutex>& lock) {
+    _draining = true;
+    while (SpiTransaction* transaction = _queue.pop()) {
+        lock.unlock();
+        execute(*transaction);
+        lock.lock();
+    }
+    _draining = false;
+}
+
+void NativeSpi::select(const SpiDevice* device) {
+    if (_selected == device) return;
+    deselect();
+    _frames.fetch_add(1, std::memory_order_relaxed);
+    _selected     = device;
+    _selected_sim = findSim(device);
+    if (device->cs != nullptr) device->cs->digitalWrite(device->cs_active_high);
+    if (_selected_sim != nullptr) _selected_sim->select();
+}
+
+void NativeSpi::deselect() {
+    if (_selected == nullptr) return;
+    if (_selected_sim != nullptr) _selected_sim->deselect();
+    if (_selected->cs != nullptr) _selected->cs->digitalWrite(!_selected->cs_active_high);
+    _selected     = nullptr;
+    _selected_sim = nullptr;
+}
+
+void NativeSpi::execute(SpiTransaction& transaction) {
+    const SpiDevice* device = transaction.device;
+    const uint64_t start    = _simulate_clock ? flexhal::utils::time::nanos64() : 0;
+
+    select(device);
+    if (_selected_sim != nullptr) {
+        _selected_sim->exchange(transaction.tx, transaction.rx, transaction.length);
+    } else if (transaction.rx != nullptr) {
+        if (transaction.tx != nullptr) {
+            memmove(transaction.rx, transaction.tx, transaction.length);
+        } else {
+            memset(transaction.rx, device->fill, transaction.length);
+        }
+    }
+    if (_simulate_clock && device->clock_hz != 0) {
+        const uint64_t duration = static_cast<uint64_t>(transaction.length) * 8u * 1000000000u / device->clock_hz;
+        while (flexhal::utils::time::nanos64() - start < duration) {
+        }
+    }
+    if (!(transaction.flags & SpiTransaction::keep_cs)) {
+        deselect();
+    }
+
+    _transactions.fetch_add(1, std::memory_order_relaxed);
+    _bytes.fetch_add(transaction.length, std::memory_order_relaxed);
+    if (transaction.callback != nullptr) {
+        transaction.callback(transaction.context, transaction, base::status::ok);
+    }
+    // The descriptor belongs to the caller again from here on.
+    transaction.result.store(base::status::ok, std::memory_order_release);
+    _pending.fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace spi
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_SPI_NATIVESPI_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
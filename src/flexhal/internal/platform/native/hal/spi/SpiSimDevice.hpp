@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace spi {
+
+/**
+ * @brief A simulated peripheral attached to a NativeSpi bus.
+ *
+ * select() / deselect() follow the device's chip select, so a frame spread
+ * over several keep_cs transactions is seen as one exchange sequence.
+ */
+class SpiSimDevice {
+public:
+    virtual ~SpiSimDevice() = default;
+
+    virtual void select() {
+    }
+
+    virtual void deselect() {
+    }
+
+    /**
+     * @brief Clocks length bytes.
+     * @param mosi Bytes from the master, or nullptr if it only sends fill bytes.
+     * @param miso Where to put the reply, or nullptr if the master discards it.
+     */
+    virtual void exchange(const uint8_t* mosi, uint8_t* miso, size_t length) = 0;
+};
+
+/**
+ * @brief Serial memory in the style of 25xx EEPROM / SPI NOR parts.
+ *
+ * Commands (first byte after CS falls): 0x03 READ and 0x02 WRITE with a
+ * 24-bit address, 0x9F JEDEC ID. Addresses wrap at the end of the memory.
+ * There is no write-enable latch and writes are instantaneous.
+ */
+class SpiMemoryDevice : public SpiSimDevice {
+public:
+    static constexpr uint8_t cmd_write = 0x02;
+    static constexpr uint8_t cmd_read  = 0x03;
+    static constexpr uint8_t cmd_jedec = 0x9F;
+
+    /**
+     * @param size Memory size in bytes, initially filled with 0xFF (erased).
+     */
+    explicit SpiMemoryDevice(size_t size);
+
+    void select() override;
+    void exchange(const uint8_t* mosi, uint8_t* miso, size_t length) override;
+
+    uint8_t* data() {
+        return _memory.data();
+    }
+
+    size_t size() const {
+        return _memory.size();
+    }
+
+private:
+    std::vector<uint8_t> _memory;
+    uint32_t _address;
+    uint8_t _command;
+    uint8_t _position; // Bytes of the current frame seen so far (saturates)
+};
+
+} // namespace spi
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_SPI_SPISIMDEVICE_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_SPI_SPISIMDEVICE_IPP
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace spi {
+
+SpiMemoryDevice::SpiMemoryDevice(size_t size)
+    : _memory(size ? size : 1, 0xFF), _address(0), _command(0), _position(0)
+{
+}
+
+void SpiMemoryDevice::select() {
+    _command  = 0;
+    _address  = 0;
+    _position = 0;
+}
+
+void SpiMemoryDevice::exchange(const uint8_t* mosi, uint8_t* miso, size_t length) {
+    static const uint8_t jedec_id[3] = {0xEF, 0x40, 0x18};
+    for (size_t i = 0; i < length; ++i) {
+        const uint8_t in = mosi ? mosi[i] : 0xFF;
+        uint8_t out      = 0xFF;
+        if (_position == 0) {
+            _command = in;
+        } else if (_command == cmd_jedec) {
+            out = (_position <= 3) ? jedec_id[_position - 1] : 0xFF;
+        } else if (_position <= 3) {
+            _address = (_address << 8) | in;
+        } else if (_command == cmd_read) {
+            out = _memory[_address++ % _memory.size()];
+        } else if (_command == cmd_write) {
+            _memory[_address++ % _memory.size()] = in;
+        }
+        if (_position < 0xFF) ++_position;
+        if (miso != nullptr) miso[i] = out;
+    }
+}
+
+} // namespace spi
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_SPI_SPISIMDEVICE_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
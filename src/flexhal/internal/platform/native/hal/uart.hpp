@@ -0,0 +1,4 @@
+#pragma once
+
+// Include all headers from the uart implementation subdirectory
+#include "uart/NativeUart.hpp"
@@ -0,0 +1,328 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/uart.hpp"
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace uart {
+
+/**
+ * @brief UART backed by a file descriptor: one end of a socketpair, the
+ *        master side of a pseudo-terminal, or any descriptor attached.
+ *
+ * With openSocketPair() or openPty() the other end is available as
+ * getPeerFd(), so tests (or a terminal program, through getPtyName())
+ * can play the remote side. The descriptor is non-blocking.
+ *
+ * In threaded mode a worker thread pumps the rings (waking on descriptor
+ * readiness, and at least every millisecond for queued writes) and poll()
+ * does nothing; otherwise poll() pumps on the caller's thread.
+ *
+ * Only POSIX hosts are supported; elsewhere open*() return status::unsupported.
+ */
+class NativeUart : public flexhal::hal::uart::BufferedUart {
+public:
+    explicit NativeUart(size_t rx_capacity = 1024, size_t tx_capacity = 1024, bool threaded = false);
+    ~NativeUart() override;
+
+    NativeUart(const NativeUart&)            = delete;
+    NativeUart& operator=(const NativeUart&) = delete;
+
+    /**
+     * @brief Connects the UART to a new socketpair.
+     * @return status::ok, status::busy if already open, or status::io.
+     */
+    base::status openSocketPair();
+
+    /**
+     * @brief Connects the UART to a new pseudo-terminal in raw mode.
+     * @return status::ok, status::busy if already open, or status::io.
+     */
+    base::status openPty();
+
+    /**
+     * @brief Uses an existing descriptor (e.g. an opened serial device).
+     * @param owned Close it in close().
+     * @return status::ok, status::busy if already open, or status::param.
+     */
+    base::status attachFd(int fd, bool owned);
+
+    void close();
+
+    bool isOpen() const {
+        return _fd >= 0;
+    }
+
+    /**
+     * @brief The remote end of the socketpair or pseudo-terminal (-1 if none).
+     */
+    int getPeerFd() const {
+        return _peer_fd;
+    }
+
+    /**
+     * @brief Path of the pseudo-terminal's slave device ("" if not a pty).
+     */
+    const char* getPtyName() const {
+        return _pty_name;
+    }
+
+    /**
+     * @brief True after the remote end has been closed.
+     */
+    bool isHangup() const {
+        return _hangup.load(std::memory_order_relaxed);
+    }
+
+    void poll() override;
+
+protected:
+    size_t receive(uint8_t* data, size_t length) override;
+    size_t transmit(const uint8_t* data, size_t length) override;
+
+private:
+    base::status start(int fd, int peer_fd, bool owned);
+    void run();
+
+    int _fd;
+    int _peer_fd;
+    bool _owned;
+    bool _threaded;
+    char _pty_name[64];
+    std::atomic<bool> _hangup;
+    std::atomic<bool> _running;
+    std::thread _thread;
+};
+
+} // namespace uart
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_UART_NATIVEUART_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_UART_NATIVEUART_IPP
+
+#if __has_include(<sys/socket.h>) && __has_include(<poll.h>) && __has_include(<termios.h>) && \
+    __has_include(<unistd.h>)
+ #define FLEXHAL_INTERNAL_NATIVE_UART_POSIX 1
+ #include <errno.h>
+ #include <fcntl.h>
+ #include <poll.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <sys/socket.h>
+ #include <termios.h>
+ #include <unistd.h>
+#else
+ #define FLEXHAL_INTERNAL_NATIVE_UART_POSIX 0
+#endif
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace hal {
+namespace uart {
+
+NativeUart::NativeUart(size_t rx_capacity, size_t tx_capacity, bool threaded)
+    : BufferedUart(rx_capacity, tx_capacity),
+      _fd(-1),
+      _peer_fd(-1),
+      _owned(false),
+      _threaded(threaded),
+      _pty_name(),
+      _hangup(false),
+      _running(false)
+{
+}
+
+NativeUart::~NativeUart() {
+    close();
+}
+
+base::status NativeUart::openSocketPair() {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+    if (isOpen()) {
+        return base::status::busy;
+    }
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        return base::status::io;
+    }
+    return start(fds[0], fds[1], true);
+#else
+    return base::status::unsupported;
+#endif
+}
+
+base::status NativeUart::openPty() {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+    if (isOpen()) {
+        return base::status::busy;
+    }
+    const int master = ::posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0) {
+        return base::status::io;
+    }
+    const char* name = nullptr;
+    if (::grantpt(master) != 0 || ::unlockpt(master) != 0 || (name = ::ptsname(master)) == nullptr) {
+        ::close(master);
+        return base::status::io;
+    }
+    strncpy(_pty_name, name, sizeof(_pty_name) - 1);
+    _pty_name[sizeof(_pty_name) - 1] = '\0';
+
+    // Keep the slave open as the peer: raw mode (no echo or line editing), and
+    // the master does not see a hangup while no terminal program is attached.
+    const int slave = ::open(_pty_name, O_RDWR | O_NOCTTY);
+    struct termios attributes;
+    if (slave < 0 || ::tcgetattr(slave, &attributes) != 0) {
+        if (slave >= 0) ::close(slave);
+        ::close(master);
+        _pty_name[0] = '\0';
+        return base::status::io;
+    }
+    ::cfmakeraw(&attributes);
+    ::tcsetattr(slave, TCSANOW, &attributes);
+    return start(master, slave, true);
+#else
+    return base::status::unsupported;
+#endif
+}
+
+base::status NativeUart::attachFd(int fd, bool owned) {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+    if (isOpen()) {
+        return base::status::busy;
+    }
+    if (fd < 0) {
+        return base::status::param;
+    }
+    return start(fd, -1, owned);
+#else
+    (void)fd;
+    (void)owned;
+    return base::status::unsupported;
+#endif
+}
+
+base::status NativeUart::start(int fd, int peer_fd, bool owned) {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+    _fd      = fd;
+    _peer_fd = peer_fd;
+    _owned   = owned;
+    _hangup.store(false, std::memory_order_relaxed);
+    if (_threaded) {
+        _running.store(true, std::memory_order_release);
+        _thread = std::thread([this]() { run(); });
+    }
+    return base::status::ok;
+#else
+    (void)fd;
+    (void)peer_fd;
+    (void)owned;
+    return base::status::unsupported;
+#endif
+}
+
+void NativeUart::close() {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+    if (_running.exchange(false) && _thread.joinable()) {
+        _thread.join();
+    }
+    if (_fd >= 0 && _owned) ::close(_fd);
+    if (_peer_fd >= 0) ::close(_peer_fd);
+#endif
+    _fd          = -1;
+    _peer_fd     = -1;
+    _pty_name[0] = '\0';
+}
+
+void NativeUart::poll() {
+    if (!_threaded && isOpen()) {
+        pump();
+    }
+}
+
+void NativeUart::run() {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+    while (_running.load(std::memory_order_acquire)) {
+        if (pump()) continue;
+        struct pollfd descriptor;
+        descriptor.fd      = _fd;
+        descriptor.events  = static_cast<short>(POLLIN | (isWriteIdle() ? 0 : POLLOUT));
+        descriptor.revents = 0;
+        ::poll(&descriptor, 1, 1);
+        if (descriptor.revents & (POLLHUP | POLLERR)) {
+            // Keep the loop slow after a hangup instead of spinning on the event.
+            _hangup.store(true, std::memory_order_relaxed);
+            ::usleep(1000);
+        }
+    }
+#endif
+}
+
+size_t NativeUart::receive(uint8_t* data, size_t length) {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+    const ssize_t count = ::read(_fd, data, length);
+    if (count > 0) {
+        return static_cast<size_t>(count);
+    }
+    if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        _hangup.store(true, std::memory_order_relaxed); // EOF, or EIO on a pty without slave
+    }
+    return 0;
+#else
+    (void)data;
+    (void)length;
+    return 0;
+#endif
+}
+
+size_t NativeUart::transmit(const uint8_t* data, size_t length) {
+#if FLEXHAL_INTERNAL_NATIVE_UART_POSIX
+#ifdef MSG_NOSIGNAL
+    // send() avoids SIGPIPE on a closed socket; other descriptors fall back to write().
+    ssize_t count = ::send(_fd, data, length, MSG_NOSIGNAL);
+    if (count < 0 && errno == ENOTSOCK) count = ::write(_fd, data, length);
+#else
+    ssize_t count = ::write(_fd, data, length);
+#endif
+    if (count > 0) {
+        return static_cast<size_t>(count);
+    }
+    if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        _hangup.store(true, std::memory_order_relaxed);
+    }
+    return 0;
+#else
+    (void)data;
+    (void)length;
+    return 0;
+#endif
+}
+
+} // namespace uart
+} // namespace hal
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_HAL_UART_NATIVEUART_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
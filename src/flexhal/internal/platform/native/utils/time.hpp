@@ -0,0 +1,308 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <time.h>
+
+#include "flexhal/base/status.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && __has_include(<x86intrin.h>) && __has_include(<cpuid.h>)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define FLEXHAL_INTERNAL_NATIVE_TIME_HAS_TSC 1
+#else
+#define FLEXHAL_INTERNAL_NATIVE_TIME_HAS_TSC 0
+#endif
+
+/**
+ * @brief Set to 0 to keep ticks() on the OS clock even when an invariant TSC is available.
+ */
+#ifndef FLEXHAL_NATIVE_TIME_USE_TSC
+#define FLEXHAL_NATIVE_TIME_USE_TSC FLEXHAL_INTERNAL_NATIVE_TIME_HAS_TSC
+#endif
+
+#if defined(CLOCK_MONOTONIC_RAW)
+#define FLEXHAL_INTERNAL_NATIVE_TIME_CLOCK CLOCK_MONOTONIC_RAW
+#elif defined(CLOCK_MONOTONIC)
+#define FLEXHAL_INTERNAL_NATIVE_TIME_CLOCK CLOCK_MONOTONIC
+#endif
+
+#ifndef FLEXHAL_INTERNAL_FLEXHAL_UTILS_TIME
+#define FLEXHAL_INTERNAL_FLEXHAL_UTILS_TIME flexhal::internal::platform::native::utils::time
+#endif
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace utils {
+namespace time {
+
+  /**
+   * @brief Monotonic time in nanoseconds since an arbitrary epoch (does not wrap).
+   *
+   * Reads CLOCK_MONOTONIC_RAW (not slewed by NTP) directly, which is a vDSO
+   * call on Linux and macOS.
+   */
+  inline uint64_t nanos64() {
+#if defined(FLEXHAL_INTERNAL_NATIVE_TIME_CLOCK)
+    struct timespec ts;
+    clock_gettime(FLEXHAL_INTERNAL_NATIVE_TIME_CLOCK, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch() / std::chrono::nanoseconds(1));
+#endif
+  }
+
+  /**
+   * @brief Monotonic time in microseconds (does not wrap).
+   */
+  inline uint64_t micros64() {
+    return nanos64() / 1000u;
+  }
+
+  inline uint32_t millis() {
+    return static_cast<uint32_t>(nanos64() / 1000000u);
+  }
+
+  inline uint32_t micros() {
+    return static_cast<uint32_t>(micros64());
+  }
+
+  namespace detail {
+
+    /**
+     * @brief Source behind ticks(), selected and calibrated once per process.
+     */
+    struct TickSource {
+      bool use_tsc;    ///< ticks() reads the TSC instead of nanos64().
+      uint64_t mult;   ///< ns = (ticks * mult) >> 32 when use_tsc.
+    };
+
+#if FLEXHAL_NATIVE_TIME_USE_TSC
+    // The TSC is only usable as a clock when it is invariant (constant rate
+    // across P-states and sleep states): CPUID 0x80000007 EDX bit 8.
+    inline bool has_invariant_tsc() {
+      unsigned int eax, ebx, ecx, edx;
+      if (!__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) || eax < 0x80000007u) return false;
+      __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+      return (edx & (1u << 8)) != 0;
+    }
+
+    // Measures the TSC rate against nanos64() over ~5 ms.
+    inline TickSource calibrate() {
+      if (!has_invariant_tsc()) return TickSource{false, 0};
+      const uint64_t ns0 = nanos64();
+      const uint64_t c0  = __rdtsc();
+      uint64_t ns1;
+      do {
+        ns1 = nanos64();
+      } while (ns1 - ns0 < 5000000u);
+      const uint64_t c1 = __rdtsc();
+      if (c1 <= c0) return TickSource{false, 0};
+      return TickSource{true, ((ns1 - ns0) << 32) / (c1 - c0)};
+    }
+#else
+    inline TickSource calibrate() {
+      return TickSource{false, 0};
+    }
+#endif
+
+    inline const TickSource& tick_source() {
+      static const TickSource source = calibrate();
+      return source;
+    }
+
+  } // namespace detail
+
+  /**
+   * @brief Raw timestamp in the cheapest monotonic unit available.
+   *
+   * The invariant TSC on x86-64 (calibrated on first use), otherwise
+   * nanoseconds. Convert differences with ticks_to_ns().
+   */
+  inline uint64_t ticks() {
+#if FLEXHAL_NATIVE_TIME_USE_TSC
+    if (detail::tick_source().use_tsc) return __rdtsc();
+#endif
+    return nanos64();
+  }
+
+  /**
+   * @brief Converts a ticks() value or difference to nanoseconds.
+   */
+  inline uint64_t ticks_to_ns(uint64_t ticks) {
+#if FLEXHAL_NATIVE_TIME_USE_TSC
+    const detail::TickSource& source = detail::tick_source();
+    if (source.use_tsc) {
+      return static_cast<uint64_t>((static_cast<unsigned __int128>(ticks) * source.mult) >> 32);
+    }
+#endif
+    return ticks;
+  }
+
+  /**
+   * @brief Fine-grained counter for timing short intervals: the low 32 bits of
+   *        ticks(). Subtract two readings as uint32_t (valid up to one wrap,
+   *        ~1 s with a 4 GHz TSC) and convert with cycles_to_ns().
+   */
+  inline uint32_t cycles() {
+    return static_cast<uint32_t>(ticks());
+  }
+
+  /**
+   * @brief Converts a cycles() difference (or a sum of them) to nanoseconds.
+   */
+  inline uint64_t cycles_to_ns(uint64_t cycles) {
+    return ticks_to_ns(cycles);
+  }
+
+  namespace detail {
+
+    /**
+     * @brief Initial spin threshold. Define FLEXHAL_NATIVE_TIME_SPIN_THRESHOLD_US to
+     *        skip the startup calibration and use a fixed value.
+     */
+#ifdef FLEXHAL_NATIVE_TIME_SPIN_THRESHOLD_US
+    constexpr uint32_t initial_spin_threshold_ns = FLEXHAL_NATIVE_TIME_SPIN_THRESHOLD_US * 1000u;
+#else
+    constexpr uint32_t initial_spin_threshold_ns = 0; // 0 = calibrate on first delay
+#endif
+
+    inline std::atomic<uint32_t>& spin_threshold_ns() {
+      static std::atomic<uint32_t> threshold(initial_spin_threshold_ns);
+      return threshold;
+    }
+
+    inline void cpu_relax() {
+#if FLEXHAL_INTERNAL_NATIVE_TIME_HAS_TSC
+      _mm_pause();
+#endif
+    }
+
+    inline void sleep_then_spin_until(uint64_t deadline_ns, uint32_t threshold_ns) {
+      uint64_t now = nanos64();
+      if (deadline_ns > now + threshold_ns) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(deadline_ns - now - threshold_ns));
+      }
+      while (nanos64() < deadline_ns) {
+        cpu_relax();
+      }
+    }
+
+  } // namespace detail
+
+  /**
+   * @brief Measures how far sleeps overshoot on this host and sets the spin threshold.
+   *
+   * Runs a few dozen short sleeps (a few milliseconds in total) and uses a
+   * high percentile of the observed overshoot plus a margin. Runs once at
+   * program start unless FLEXHAL_NATIVE_TIME_SPIN_THRESHOLD_US is defined;
+   * call it again if the host load changes.
+   * @return The new threshold in microseconds.
+   */
+  inline uint32_t calibrate_delay(uint32_t samples = 32) {
+    constexpr uint64_t probe_ns = 50000; // 50 us sleeps
+    uint64_t overshoot[64];
+    if (samples > 64) samples = 64;
+    if (samples < 4) samples = 4;
+    for (uint32_t i = 0; i < samples; ++i) {
+      const uint64_t start = nanos64();
+      std::this_thread::sleep_for(std::chrono::nanoseconds(probe_ns));
+      const uint64_t elapsed = nanos64() - start;
+      overshoot[i] = (elapsed > probe_ns) ? elapsed - probe_ns : 0;
+    }
+    std::sort(overshoot, overshoot + samples);
+    // 90th percentile, +25% and +10 us of margin, kept within [20 us, 2 ms].
+    uint64_t threshold = overshoot[(samples * 9) / 10] * 5 / 4 + 10000;
+    threshold = std::min<uint64_t>(std::max<uint64_t>(threshold, 20000), 2000000);
+    detail::spin_threshold_ns().store(static_cast<uint32_t>(threshold), std::memory_order_relaxed);
+    return static_cast<uint32_t>(threshold / 1000);
+  }
+
+  /**
+   * @brief Sets the part of a delay that delay_us() busy-waits instead of sleeping.
+   *
+   * Delays shorter than the threshold spin entirely; longer ones sleep for
+   * (delay - threshold) and spin the rest against nanos64(). It should be a
+   * little above the scheduler's typical sleep overshoot, which is what
+   * calibrate_delay() measures. 0 requests a new calibration on the next delay.
+   */
+  inline void set_delay_spin_threshold_us(uint32_t us) {
+    detail::spin_threshold_ns().store(us * 1000u, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Current spin threshold in microseconds (calibrates on first use).
+   */
+  inline uint32_t get_delay_spin_threshold_us() {
+    uint32_t threshold = detail::spin_threshold_ns().load(std::memory_order_relaxed);
+    if (threshold == 0) {
+      return calibrate_delay();
+    }
+    return threshold / 1000u;
+  }
+
+  inline base::status delay_ms(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    return base::status::ok;
+  }
+
+  /**
+   * @brief Waits for us microseconds: sleeps for the coarse part, spins the rest.
+   *
+   * Jitter is bounded by the clock read cost rather than the scheduler, at
+   * the price of keeping a core busy for up to the spin threshold.
+   */
+  inline base::status delay_us(uint32_t us) {
+    const uint64_t deadline = nanos64() + static_cast<uint64_t>(us) * 1000u;
+    const uint32_t threshold_ns = get_delay_spin_threshold_us() * 1000u;
+    detail::sleep_then_spin_until(deadline, threshold_ns);
+    return base::status::ok;
+  }
+
+} // namespace time
+} // namespace utils
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_PLATFORM_NATIVE_UTILS_TIME_IPP
+#define FLEXHAL_INTERNAL_PLATFORM_NATIVE_UTILS_TIME_IPP
+
+namespace flexhal {
+namespace internal {
+namespace platform {
+namespace native {
+namespace utils {
+namespace time {
+namespace detail {
+
+namespace {
+// Startup calibration, so that the first delay_us() does not pay for it.
+struct DelayCalibration {
+  DelayCalibration() {
+    if (spin_threshold_ns().load(std::memory_order_relaxed) == 0) {
+      calibrate_delay();
+    }
+  }
+} delay_calibration;
+} // namespace
+
+} // namespace detail
+} // namespace time
+} // namespace utils
+} // namespace native
+} // namespace platform
+} // namespace internal
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_PLATFORM_NATIVE_UTILS_TIME_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -2,3 +2,8 @@
 
 #include "utils/logger.hpp"
 #include "utils/time.hpp"
+#include "utils/timer.hpp"
+#include "utils/task.hpp"
+#include "utils/heap.hpp"
+#include "utils/memory.hpp"
+#include "utils/trace.hpp"
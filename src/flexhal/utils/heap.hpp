@@ -0,0 +1,7 @@
+#pragma once
+
+// Heap allocation accounting.
+// Counts C++ heap allocations per subsystem (FLEXHAL_HEAP_SCOPE) and reports
+// those made after mark_init_complete(). Building with
+// FLEXHAL_NO_HEAP_AFTER_INIT installs the operator new hook that feeds it.
+#include "heap/AllocationTracker.hpp"
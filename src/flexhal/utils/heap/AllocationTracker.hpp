@@ -0,0 +1,428 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Subsystems with their own allocation counters (later ones share the last slot).
+ */
+#ifndef FLEXHAL_HEAP_SUBSYSTEMS
+#define FLEXHAL_HEAP_SUBSYSTEMS 16
+#endif
+
+namespace flexhal {
+namespace utils {
+namespace heap {
+
+/**
+ * @brief Allocation counters of one subsystem.
+ */
+struct SubsystemStats {
+    const char* name;     ///< Name given to FLEXHAL_HEAP_SCOPE ("other" for unscoped allocations).
+    uint32_t allocations; ///< All allocations.
+    uint32_t after_init;  ///< Allocations after mark_init_complete().
+    uint64_t bytes;       ///< Bytes requested in total.
+};
+
+/**
+ * @brief Called for each allocation after mark_init_complete().
+ *
+ * Runs inside operator new, so it must not allocate (nested allocations
+ * are counted but do not call the handler again).
+ */
+using ViolationHandler = void (*)(const char* subsystem, size_t size);
+
+/**
+ * @brief Attributes the allocations made by the current thread during its
+ *        lifetime to subsystem (a string literal). Scopes nest.
+ */
+class HeapScope {
+public:
+    explicit HeapScope(const char* subsystem);
+    ~HeapScope();
+
+    HeapScope(const HeapScope&)            = delete;
+    HeapScope& operator=(const HeapScope&) = delete;
+
+private:
+    const char* _previous;
+};
+
+#define FLEXHAL_INTERNAL_HEAP_CONCAT2(a, b) a##b
+#define FLEXHAL_INTERNAL_HEAP_CONCAT(a, b) FLEXHAL_INTERNAL_HEAP_CONCAT2(a, b)
+
+/**
+ * @brief Attributes the allocations of the enclosing block to subsystem.
+ */
+#define FLEXHAL_HEAP_SCOPE(subsystem) \
+    ::flexhal::utils::heap::HeapScope FLEXHAL_INTERNAL_HEAP_CONCAT(flexhal_heap_scope_, __LINE__)(subsystem)
+
+/**
+ * @brief Marks the end of initialization: every later allocation is a
+ *        violation, reported to the violation handler.
+ */
+void mark_init_complete();
+
+bool is_init_complete();
+
+/**
+ * @brief Replaces the violation handler (nullptr restores the default one,
+ *        which logs an error through FLEXHAL_LOGE).
+ */
+void set_violation_handler(ViolationHandler handler);
+
+/**
+ * @brief Records one allocation of size bytes.
+ *
+ * Called by the operator new hook of FLEXHAL_NO_HEAP_AFTER_INIT builds.
+ * Builds that hook allocation differently (e.g. a wrapped malloc) call it
+ * themselves.
+ */
+void track_allocation(size_t size);
+
+/**
+ * @brief Records one deallocation.
+ */
+void track_free();
+
+uint32_t get_allocation_count();
+
+uint32_t get_post_init_allocation_count();
+
+uint32_t get_free_count();
+
+/**
+ * @brief Number of subsystems seen so far (valid indexes for get_subsystem_stats()).
+ */
+size_t get_subsystem_count();
+
+/**
+ * @return false if index is out of range.
+ */
+bool get_subsystem_stats(size_t index, SubsystemStats& stats);
+
+/**
+ * @brief Counters of the subsystem with this name (all zero if it never allocated).
+ */
+SubsystemStats get_subsystem_stats(const char* name);
+
+/**
+ * @brief Clears the counters and the init-complete mark.
+ */
+void reset();
+
+} // namespace heap
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_HEAP_ALLOCATIONTRACKER_IPP
+#define FLEXHAL_INTERNAL_UTILS_HEAP_ALLOCATIONTRACKER_IPP
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "flexhal/utils/logger.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace heap {
+
+namespace {
+
+struct Slot {
+    std::atomic<const char*> name;
+    std::atomic<uint32_t> allocations;
+    std::atomic<uint32_t> after_init;
+    std::atomic<uint64_t> bytes;
+};
+
+// Everything here is constant-initialized, so allocations made by other
+// static constructors are counted correctly whatever the init order.
+Slot slots[FLEXHAL_HEAP_SUBSYSTEMS];
+std::atomic<size_t> slot_count{0};
+std::atomic<bool> init_complete{false};
+std::atomic<uint32_t> total_allocations{0};
+std::atomic<uint32_t> post_init_allocations{0};
+std::atomic<uint32_t> total_frees{0};
+std::atomic<ViolationHandler> violation_handler{nullptr};
+thread_local const char* current_subsystem = nullptr;
+thread_local bool in_handler               = false;
+
+// Log directly rather than through FLEXHAL_LOGE: logger.hpp can reach this
+// file (via AsyncLogger) before it has defined its macros.
+void log_violation(const char* subsystem, size_t size) {
+    logger::Log.error("HEAP", "%u-byte allocation after init (%s)", static_cast<unsigned>(size), subsystem);
+}
+
+bool same_name(const char* a, const char* b) {
+    return a == b || strcmp(a, b) == 0;
+}
+
+// Slots are claimed once and never released, so lookups need no lock. Two
+// threads claiming a slot for the same new name at once may split its counts.
+Slot& find_slot(const char* name) {
+    const size_t count = slot_count.load(std::memory_order_acquire);
+    const size_t used  = count < FLEXHAL_HEAP_SUBSYSTEMS ? count : FLEXHAL_HEAP_SUBSYSTEMS;
+    for (size_t i = 0; i < used; ++i) {
+        const char* slot_name = slots[i].name.load(std::memory_order_acquire);
+        if (slot_name != nullptr && same_name(slot_name, name)) return slots[i];
+    }
+    const size_t index = slot_count.fetch_add(1, std::memory_order_acq_rel);
+    if (index >= FLEXHAL_HEAP_SUBSYSTEMS) {
+        slot_count.store(FLEXHAL_HEAP_SUBSYSTEMS, std::memory_order_relaxed);
+        return slots[FLEXHAL_HEAP_SUBSYSTEMS - 1];
+    }
+    slots[index].name.store(name, std::memory_order_release);
+    return slots[index];
+}
+
+} // namespace
+
+HeapScope::HeapScope(const char* subsystem) : _previous(current_subsystem)
+{
+    current_subsystem = subsystem;
+}
+
+HeapScope::~HeapScope() {
+    current_subsystem = _previous;
+}
+
+void mark_init_complete() {
+    init_complete.store(true, std::memory_order_release);
+}
+
+bool is_init_complete() {
+    return init_complete.load(std::memory_order_acquire);
+}
+
+void set_violation_handler(ViolationHandler handler) {
+    violation_handler.store(handler, std::memory_order_release);
+}
+
+void track_allocation(size_t size) {
+    const char* subsystem = current_subsystem != nullptr ? current_subsystem : "other";
+    Slot& slot            = find_slot(subsystem);
+    slot.allocations.fetch_add(1, std::memory_order_relaxed);
+    slot.bytes.fetch_add(size, std::memory_order_relaxed);
+    total_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (!init_complete.load(std::memory_order_acquire)) {
+        return;
+    }
+    slot.after_init.fetch_add(1, std::memory_order_relaxed);
+    post_init_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (in_handler) {
+        return; // The handler itself allocated
+    }
+    in_handler                     = true;
+    const ViolationHandler handler = violation_handler.load(std::memory_order_acquire);
+    (handler != nullptr ? handler : log_violation)(subsystem, size);
+    in_handler = false;
+#if defined(FLEXHAL_NO_HEAP_AFTER_INIT_ABORT)
+    abort();
+#endif
+}
+
+void track_free() {
+    total_frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t get_allocation_count() {
+    return total_allocations.load(std::memory_order_relaxed);
+}
+
+uint32_t get_post_init_allocation_count() {
+    return post_init_allocations.load(std::memory_order_relaxed);
+}
+
+uint32_t get_free_count() {
+    return total_frees.load(std::memory_order_relaxed);
+}
+
+size_t get_subsystem_count() {
+    const size_t count = slot_count.load(std::memory_order_acquire);
+    return count < FLEXHAL_HEAP_SUBSYSTEMS ? count : FLEXHAL_HEAP_SUBSYSTEMS;
+}
+
+bool get_subsystem_stats(size_t index, SubsystemStats& stats) {
+    if (index >= get_subsystem_count()) {
+        return false;
+    }
+    const Slot& slot   = slots[index];
+    stats.name         = slot.name.load(std::memory_order_acquire);
+    stats.allocations  = slot.allocations.load(std::memory_order_relaxed);
+    stats.after_init   = slot.after_init.load(std::memory_order_relaxed);
+    stats.bytes        = slot.bytes.load(std::memory_order_relaxed);
+    return stats.name != nullptr;
+}
+
+SubsystemStats get_subsystem_stats(const char* name) {
+    SubsystemStats stats{name, 0, 0, 0};
+    for (size_t i = 0; i < get_subsystem_count(); ++i) {
+        SubsystemStats candidate;
+        if (get_subsystem_stats(i, candidate) && same_name(candidate.name, name)) {
+            return candidate;
+        }
+    }
+    return stats;
+}
+
+void reset() {
+    init_complete.store(false, std::memory_order_release);
+    for (size_t i = 0; i < FLEXHAL_HEAP_SUBSYSTEMS; ++i) {
+        slots[i].allocations.store(0, std::memory_order_relaxed);
+        slots[i].after_init.store(0, std::memory_order_relaxed);
+        slots[i].bytes.store(0, std::memory_order_relaxed);
+    }
+    total_allocations.store(0, std::memory_order_relaxed);
+    post_init_allocations.store(0, std::memory_order_relaxed);
+    total_frees.store(0, std::memory_order_relaxed);
+}
+
+} // namespace heap
+} // namespace utils
+} // namespace flexhal
+
+// --- Allocation hook ---
+// Replaces the global operator new / delete of the whole program.
+#if defined(FLEXHAL_NO_HEAP_AFTER_INIT)
+
+// Kept out of line so GCC does not see malloc() paired with operator delete
+// (-Wmismatched-new-delete) in the callers.
+#if defined(__GNUC__)
+#define FLEXHAL_INTERNAL_HEAP_NOINLINE __attribute__((noinline))
+#else
+#define FLEXHAL_INTERNAL_HEAP_NOINLINE
+#endif
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new(size_t size) {
+    flexhal::utils::heap::track_allocation(size);
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new[](size_t size) {
+    flexhal::utils::heap::track_allocation(size);
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    flexhal::utils::heap::track_allocation(size);
+    return malloc(size ? size : 1);
+}
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    flexhal::utils::heap::track_allocation(size);
+    return malloc(size ? size : 1);
+}
+
+void operator delete(void* p) noexcept {
+    if (p != nullptr) flexhal::utils::heap::track_free();
+    free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    if (p != nullptr) flexhal::utils::heap::track_free();
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    if (p != nullptr) flexhal::utils::heap::track_free();
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    if (p != nullptr) flexhal::utils::heap::track_free();
+    free(p);
+}
+
+// Over-aligned types (alignas above the default new alignment, e.g. the
+// alignas(64) members of AsyncLogger and ByteRing) use these overloads.
+#if defined(__cpp_aligned_new)
+
+namespace flexhal {
+namespace utils {
+namespace heap {
+namespace detail {
+
+// Over-allocates with malloc() and keeps its pointer just below the aligned block.
+inline void* aligned_malloc(size_t size, std::align_val_t alignment) {
+    const size_t align = static_cast<size_t>(alignment);
+    void* raw          = malloc(size + align + sizeof(void*));
+    if (raw == nullptr) return nullptr;
+    const uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + sizeof(void*) + align - 1) & ~(align - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<void*>(aligned);
+}
+
+inline void aligned_free(void* p) {
+    if (p != nullptr) {
+        track_free();
+        free(static_cast<void**>(p)[-1]);
+    }
+}
+
+} // namespace detail
+} // namespace heap
+} // namespace utils
+} // namespace flexhal
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new(size_t size, std::align_val_t alignment) {
+    flexhal::utils::heap::track_allocation(size);
+    if (void* p = flexhal::utils::heap::detail::aligned_malloc(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new[](size_t size, std::align_val_t alignment) {
+    flexhal::utils::heap::track_allocation(size);
+    if (void* p = flexhal::utils::heap::detail::aligned_malloc(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new(size_t size, std::align_val_t alignment,
+                                                  const std::nothrow_t&) noexcept {
+    flexhal::utils::heap::track_allocation(size);
+    return flexhal::utils::heap::detail::aligned_malloc(size, alignment);
+}
+
+FLEXHAL_INTERNAL_HEAP_NOINLINE void* operator new[](size_t size, std::align_val_t alignment,
+                                                    const std::nothrow_t&) noexcept {
+    flexhal::utils::heap::track_allocation(size);
+    return flexhal::utils::heap::detail::aligned_malloc(size, alignment);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    flexhal::utils::heap::detail::aligned_free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    flexhal::utils::heap::detail::aligned_free(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept {
+    flexhal::utils::heap::detail::aligned_free(p);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept {
+    flexhal::utils::heap::detail::aligned_free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    flexhal::utils::heap::detail::aligned_free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    flexhal::utils::heap::detail::aligned_free(p);
+}
+
+#endif // __cpp_aligned_new
+
+#endif // FLEXHAL_NO_HEAP_AFTER_INIT
+
+#endif // FLEXHAL_INTERNAL_UTILS_HEAP_ALLOCATIONTRACKER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
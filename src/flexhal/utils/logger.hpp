@@ -1,5 +1,9 @@
 #pragma once
 
+#include <stdint.h>
+
+#include "flexhal/base/status.hpp"
+
 namespace flexhal {
 namespace utils {
 namespace logger {
@@ -8,6 +12,7 @@ namespace logger {
 
 class ILogger;
 class LogProxy;
+class TagLevelTable;
 
 // --- Log Level Enum ---
 /**
@@ -29,6 +34,9 @@ extern ILogger* _active_logger;
 // Default log level
 extern LogLevel _default_log_level;
 
+// Per-tag log level overrides
+extern TagLevelTable _tag_levels;
+
 /**
  * @brief Sets the global logger instance.
  * @param logger Pointer to the ILogger implementation to use.
@@ -47,6 +55,45 @@ void setLogLevel(LogLevel level);
  */
 LogLevel getLogLevel();
 
+/**
+ * @brief Overrides the log level for one tag.
+ *
+ * Messages with this tag are filtered against the given level instead of
+ * the global one, e.g. to enable DEBUG for "GPIO" only. Tags are matched
+ * by content (string_id()), so a tag built at run time works as well; the
+ * check hashes the tag only while at least one override is set.
+ * @param tag The tag string.
+ * @param level The level to use for this tag.
+ * @return status::ok, or status::no_memory if the override table is full.
+ */
+base::status setTagLogLevel(const char* tag, LogLevel level);
+
+/**
+ * @brief Removes the override for one tag (it follows the global level again).
+ */
+void clearTagLogLevel(const char* tag);
+
+/**
+ * @brief Removes all per-tag overrides.
+ */
+void clearTagLogLevels();
+
+/**
+ * @brief Gets the effective log level for a tag (its override, or the global level).
+ */
+LogLevel getTagLogLevel(const char* tag);
+
+/**
+ * @brief 32-bit FNV-1a hash of a string, usable at compile time.
+ *
+ * Used to identify tag and format strings by content (per-tag levels,
+ * BinaryLogger). A host decoder computes the same value.
+ */
+constexpr uint32_t string_id(const char* str, uint32_t hash = 2166136261u) {
+    return (*str == '\0') ? hash
+                          : string_id(str + 1, (hash ^ static_cast<uint8_t>(*str)) * 16777619u);
+}
+
 // --- Global Log Proxy Instance Declaration ---
 
 // Global instance of the log proxy
@@ -61,7 +108,73 @@ extern LogProxy Log;
 
 // Include headers from subdirectories
 #include "logger/ILogger.hpp"
+#include "logger/TagLevelTable.hpp"
 #include "logger/LogProxy.hpp"
+#include "logger/args.hpp"
+#include "logger/AsyncLogger.hpp"
+#include "logger/BinaryLogger.hpp"
+
+// --- Compile-time level threshold ---
+// Numeric values of LogLevel, usable in #if.
+#define FLEXHAL_LOG_LEVEL_NONE    0
+#define FLEXHAL_LOG_LEVEL_ERROR   1
+#define FLEXHAL_LOG_LEVEL_WARN    2
+#define FLEXHAL_LOG_LEVEL_INFO    3
+#define FLEXHAL_LOG_LEVEL_DEBUG   4
+#define FLEXHAL_LOG_LEVEL_VERBOSE 5
+
+/**
+ * @brief Most verbose level compiled into FLEXHAL_LOGx call sites.
+ *
+ * Define it before including FlexHAL (e.g., `-DFLEXHAL_LOG_MIN_LEVEL=FLEXHAL_LOG_LEVEL_INFO`)
+ * to remove DEBUG/VERBOSE calls entirely: their arguments are not evaluated
+ * and no code is emitted. The runtime level (setLogLevel) still applies to
+ * the levels that remain.
+ */
+#ifndef FLEXHAL_LOG_MIN_LEVEL
+#define FLEXHAL_LOG_MIN_LEVEL FLEXHAL_LOG_LEVEL_VERBOSE
+#endif
+
+// Arguments are evaluated only if the level passes both the compile-time and the runtime
+// filter. LogProxy::write() skips the level check, so the tag is looked up only once.
+#define FLEXHAL_INTERNAL_LOG_CALL(level, tag, ...)                                                   \
+    do {                                                                                             \
+        const char* flexhal_log_tag_ = (tag);                                                        \
+        if (::flexhal::utils::logger::LogProxy::isEnabled(::flexhal::utils::logger::LogLevel::level, \
+                                                          flexhal_log_tag_))                         \
+            ::flexhal::utils::logger::LogProxy::write(::flexhal::utils::logger::LogLevel::level,     \
+                                                      flexhal_log_tag_, __VA_ARGS__);                \
+    } while (0)
+
+#if FLEXHAL_LOG_MIN_LEVEL >= FLEXHAL_LOG_LEVEL_ERROR
+#define FLEXHAL_LOGE(tag, ...) FLEXHAL_INTERNAL_LOG_CALL(ERROR, tag, __VA_ARGS__)
+#else
+#define FLEXHAL_LOGE(tag, ...) ((void)0)
+#endif
+
+#if FLEXHAL_LOG_MIN_LEVEL >= FLEXHAL_LOG_LEVEL_WARN
+#define FLEXHAL_LOGW(tag, ...) FLEXHAL_INTERNAL_LOG_CALL(WARN, tag, __VA_ARGS__)
+#else
+#define FLEXHAL_LOGW(tag, ...) ((void)0)
+#endif
+
+#if FLEXHAL_LOG_MIN_LEVEL >= FLEXHAL_LOG_LEVEL_INFO
+#define FLEXHAL_LOGI(tag, ...) FLEXHAL_INTERNAL_LOG_CALL(INFO, tag, __VA_ARGS__)
+#else
+#define FLEXHAL_LOGI(tag, ...) ((void)0)
+#endif
+
+#if FLEXHAL_LOG_MIN_LEVEL >= FLEXHAL_LOG_LEVEL_DEBUG
+#define FLEXHAL_LOGD(tag, ...) FLEXHAL_INTERNAL_LOG_CALL(DEBUG, tag, __VA_ARGS__)
+#else
+#define FLEXHAL_LOGD(tag, ...) ((void)0)
+#endif
+
+#if FLEXHAL_LOG_MIN_LEVEL >= FLEXHAL_LOG_LEVEL_VERBOSE
+#define FLEXHAL_LOGV(tag, ...) FLEXHAL_INTERNAL_LOG_CALL(VERBOSE, tag, __VA_ARGS__)
+#else
+#define FLEXHAL_LOGV(tag, ...) ((void)0)
+#endif
 
 // --- Implementation (definitions) ---
 // This section is included only once in the entire project (e.g., in FlexHAL.cpp)
@@ -72,6 +185,7 @@ namespace flexhal { namespace utils { namespace logger {
 // --- Global Logger Variable Definitions ---
 ILogger* _active_logger = nullptr; // Initialize to null, must be set via setLogger
 LogLevel _default_log_level = LogLevel::INFO; // Default to INFO level if not changed
+TagLevelTable _tag_levels; // Per-tag overrides, empty by default
 
 // --- Global Log Proxy Instance Definition ---
 LogProxy Log; // Define the global Log instance used for Log.info(), etc.
@@ -89,6 +203,22 @@ LogLevel getLogLevel() {
     return _default_log_level;
 }
 
+base::status setTagLogLevel(const char* tag, LogLevel level) {
+    return _tag_levels.set(tag, level);
+}
+
+void clearTagLogLevel(const char* tag) {
+    _tag_levels.clear(tag);
+}
+
+void clearTagLogLevels() {
+    _tag_levels.clearAll();
+}
+
+LogLevel getTagLogLevel(const char* tag) {
+    return _tag_levels.lookup(tag, _default_log_level);
+}
+
 } } } // namespace flexhal::utils::logger
 
 #endif // FLEXHAL_INTERNAL_IMPLEMENTATION
@@ -0,0 +1,295 @@
+#pragma once
+
+#include "../logger.hpp"
+#include "ILogger.hpp"
+#include "args.hpp"
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#if defined(__has_include)
+#if __has_include(<thread>)
+#define FLEXHAL_INTERNAL_ASYNC_LOGGER_THREAD 1
+#include <thread>
+#endif
+#endif
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+
+/**
+ * @brief Logger that defers formatting and output to a drain step.
+ *
+ * log() only copies the level, tag and format pointers and the raw arguments
+ * (see args::pack()) into a preallocated lock-free ring; it never formats,
+ * allocates or blocks. Entries are formatted and forwarded to the sink logger
+ * by drain() / flush(), called either from a background thread
+ * (startDrainThread()) or from the application's idle loop via Log.flush().
+ *
+ * Any number of threads may log concurrently. When the ring is full the entry
+ * is dropped and counted (getDroppedCount()).
+ *
+ * The tag and format strings are stored by pointer and must outlive the
+ * entry (string literals in practice). `%s` arguments are copied.
+ */
+class AsyncLogger : public ILogger {
+public:
+    /// Bytes reserved per entry for packed arguments. Longer argument lists are truncated.
+    static constexpr size_t ARG_BYTES = 96;
+
+    /**
+     * @brief Constructs the logger and allocates its ring.
+     * @param sink Logger that receives the formatted messages.
+     * @param capacity Number of ring entries, rounded up to a power of two.
+     */
+    explicit AsyncLogger(ILogger& sink, size_t capacity = 64);
+    ~AsyncLogger() override;
+
+    AsyncLogger(const AsyncLogger&)            = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    // --- ILogger Interface Implementation ---
+    void log(LogLevel level, const char* tag, const char* format, std::va_list args) override;
+
+    /**
+     * @brief Drains every queued entry on the calling thread.
+     */
+    void flush() override;
+    // --- End ILogger Interface ---
+
+    /**
+     * @brief Formats and forwards up to max_entries queued entries.
+     * @return Number of entries written to the sink.
+     */
+    size_t drain(size_t max_entries = SIZE_MAX);
+
+    /**
+     * @brief Number of messages dropped because the ring was full.
+     */
+    uint32_t getDroppedCount() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of messages accepted into the ring since construction.
+     */
+    uint32_t getQueuedCount() const {
+        return _queued.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Ring capacity in entries.
+     */
+    size_t getCapacity() const {
+        return _mask + 1;
+    }
+
+#if FLEXHAL_INTERNAL_ASYNC_LOGGER_THREAD
+    /**
+     * @brief Starts a background thread that drains the ring.
+     * @param idle_sleep_us Sleep between polls when the ring is empty.
+     * @return status::ok, or status::busy if the thread is already running.
+     */
+    base::status startDrainThread(uint32_t idle_sleep_us = 1000);
+
+    /**
+     * @brief Stops the drain thread after writing out the remaining entries.
+     */
+    void stopDrainThread();
+#endif
+
+private:
+    struct Entry {
+        LogLevel level;
+        const char* tag;
+        const char* format;
+        uint16_t arg_size;
+        uint8_t args[ARG_BYTES];
+    };
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Entry entry;
+    };
+
+    bool pop(Entry& out);
+    static void forward(ILogger& sink, LogLevel level, const char* tag, const char* format, ...);
+
+    ILogger& _sink;
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask;
+    alignas(64) std::atomic<size_t> _enqueue_pos;
+    alignas(64) std::atomic<size_t> _dequeue_pos;
+    std::atomic<uint32_t> _dropped;
+    std::atomic<uint32_t> _queued;
+
+#if FLEXHAL_INTERNAL_ASYNC_LOGGER_THREAD
+    std::thread _thread;
+    std::atomic<bool> _running;
+#endif
+};
+
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_LOGGER_ASYNCLOGGER_IPP
+#define FLEXHAL_INTERNAL_UTILS_LOGGER_ASYNCLOGGER_IPP
+
+#if FLEXHAL_INTERNAL_ASYNC_LOGGER_THREAD
+#include <chrono>
+#endif
+
+#include "flexhal/utils/heap.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+
+namespace {
+size_t round_up_pow2(size_t value) {
+    size_t result = 2;
+    while (result < value) result <<= 1;
+    return result;
+}
+} // namespace
+
+// The ring is Dmitry Vyukov's bounded MPMC queue: each cell carries a sequence
+// number that tells producers and consumers whether it is free or filled for
+// the current lap, so neither side needs a lock.
+AsyncLogger::AsyncLogger(ILogger& sink, size_t capacity)
+    : _sink(sink),
+      _mask(round_up_pow2(capacity) - 1),
+      _enqueue_pos(0),
+      _dequeue_pos(0),
+      _dropped(0),
+      _queued(0)
+#if FLEXHAL_INTERNAL_ASYNC_LOGGER_THREAD
+      , _running(false)
+#endif
+{
+    FLEXHAL_HEAP_SCOPE("logger");
+    _cells.reset(new Cell[_mask + 1]);
+    for (size_t i = 0; i <= _mask; ++i) {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+AsyncLogger::~AsyncLogger() {
+#if FLEXHAL_INTERNAL_ASYNC_LOGGER_THREAD
+    stopDrainThread();
+#endif
+    flush();
+}
+
+void AsyncLogger::log(LogLevel level, const char* tag, const char* format, std::va_list args) {
+    Cell* cell;
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        cell          = &_cells[pos & _mask];
+        size_t seq    = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    Entry& entry = cell->entry;
+    entry.level  = level;
+    entry.tag    = tag;
+    entry.format = format;
+    std::va_list copy;
+    va_copy(copy, args);
+    entry.arg_size = static_cast<uint16_t>(args::pack(entry.args, ARG_BYTES, format, copy));
+    va_end(copy);
+
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    _queued.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool AsyncLogger::pop(Entry& out) {
+    Cell* cell;
+    size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        cell          = &_cells[pos & _mask];
+        size_t seq    = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false; // Empty
+        } else {
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    out = cell->entry;
+    cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::forward(ILogger& sink, LogLevel level, const char* tag, const char* format, ...) {
+    std::va_list list;
+    va_start(list, format);
+    sink.log(level, tag, format, list);
+    va_end(list);
+}
+
+size_t AsyncLogger::drain(size_t max_entries) {
+    size_t count = 0;
+    Entry entry;
+    char text[256];
+    while (count < max_entries && pop(entry)) {
+        args::format(text, sizeof(text), entry.format, entry.args, entry.arg_size);
+        forward(_sink, entry.level, entry.tag, "%s", text);
+        ++count;
+    }
+    return count;
+}
+
+void AsyncLogger::flush() {
+    drain();
+    _sink.flush();
+}
+
+#if FLEXHAL_INTERNAL_ASYNC_LOGGER_THREAD
+base::status AsyncLogger::startDrainThread(uint32_t idle_sleep_us) {
+    bool expected = false;
+    if (!_running.compare_exchange_strong(expected, true)) {
+        return base::status::busy;
+    }
+    _thread = std::thread([this, idle_sleep_us]() {
+        while (_running.load(std::memory_order_acquire)) {
+            if (drain() == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(idle_sleep_us));
+            }
+        }
+    });
+    return base::status::ok;
+}
+
+void AsyncLogger::stopDrainThread() {
+    if (_running.exchange(false) && _thread.joinable()) {
+        _thread.join();
+    }
+    flush();
+}
+#endif
+
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_LOGGER_ASYNCLOGGER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
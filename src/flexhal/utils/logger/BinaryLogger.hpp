@@ -0,0 +1,231 @@
+#pragma once
+
+#include "../logger.hpp"
+#include "ILogger.hpp"
+#include "args.hpp"
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Number of distinct tag and format strings a BinaryLogger remembers
+ *        as defined (a power of two). Strings seen after the table is full
+ *        are counted (getOverflowCount()) instead of defined, so the decoder
+ *        shows their messages by ID.
+ */
+#ifndef FLEXHAL_BINARY_LOG_STRINGS
+#define FLEXHAL_BINARY_LOG_STRINGS 128
+#endif
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+
+/**
+ * @brief Compile-time string ID of a literal (forces constant evaluation).
+ */
+#define FLEXHAL_LOG_ID(str) \
+    (std::integral_constant<uint32_t, ::flexhal::utils::logger::string_id(str)>::value)
+
+/**
+ * @brief Logger that emits compact binary records instead of text.
+ *
+ * The hot path writes only a fixed header plus the raw argument bytes
+ * (args::pack()); no printf formatting happens on the target. Format and tag
+ * strings are sent once, as definition records, the first time each
+ * string_id() is seen; afterwards they are referenced by that ID. Strings are
+ * identified by content, so tags built at run time in a reused buffer work.
+ *
+ * Stream layout (all integers little-endian):
+ *
+ * - Definition: `0xD1` | id (u32) | length (u16) | bytes (no NUL)
+ * - Message:    `0xD2` | format id (u32) | level (u8) | tag id (u32) |
+ *               timestamp in us (u32) | argument length (u16) | argument bytes
+ *
+ * Install it with setLogger() so existing Log.info(...) call sites switch to
+ * binary output unchanged. Decode on the host with tools/log_decode.py.
+ */
+class BinaryLogger : public ILogger {
+public:
+    /**
+     * @brief Output callback. Records are written in order; one record may
+     *        span consecutive calls (a definition is header then string).
+     */
+    using WriteFn = void (*)(const uint8_t* data, size_t size, void* context);
+
+    static constexpr uint8_t RECORD_DEFINITION = 0xD1;
+    static constexpr uint8_t RECORD_MESSAGE    = 0xD2;
+
+    /// Bytes reserved for packed arguments per message.
+    static constexpr size_t ARG_BYTES = 96;
+
+    /// Number of string IDs remembered as already defined.
+    static constexpr size_t TABLE_SIZE = FLEXHAL_BINARY_LOG_STRINGS;
+    static_assert((TABLE_SIZE & (TABLE_SIZE - 1)) == 0, "FLEXHAL_BINARY_LOG_STRINGS must be a power of two");
+
+    BinaryLogger(WriteFn write, void* context = nullptr);
+
+    // --- ILogger Interface Implementation ---
+    void log(LogLevel level, const char* tag, const char* format, std::va_list args) override;
+    // --- End ILogger Interface ---
+
+    /**
+     * @brief Emits the definition record for a string ahead of time.
+     *
+     * Useful during initialization so that the first real log call carries
+     * no definition overhead.
+     * @return The string's ID.
+     */
+    uint32_t registerString(const char* str);
+
+    /**
+     * @brief Forgets all sent definitions so they are emitted again.
+     *
+     * Call when a decoder attaches to a stream that is already running.
+     */
+    void resendDefinitions();
+
+    /**
+     * @brief Number of messages written since construction.
+     */
+    uint32_t getMessageCount() const {
+        return _messages;
+    }
+
+    /**
+     * @brief Number of times a string was not defined because the table was
+     *        full. Raise FLEXHAL_BINARY_LOG_STRINGS if this is not 0.
+     */
+    uint32_t getOverflowCount() const {
+        return _overflow;
+    }
+
+private:
+    uint32_t lookup(const char* str);
+
+    WriteFn _write;
+    void* _context;
+    uint32_t _sent[TABLE_SIZE]; // IDs already defined; 0 marks an empty slot
+    bool _zero_sent;            // Whether the string whose ID is 0 has been defined
+    uint32_t _messages;
+    uint32_t _overflow;
+    std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+};
+
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_LOGGER_BINARYLOGGER_IPP
+#define FLEXHAL_INTERNAL_UTILS_LOGGER_BINARYLOGGER_IPP
+
+#include <string.h>
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+
+BinaryLogger::BinaryLogger(WriteFn write, void* context)
+    : _write(write), _context(context), _sent(), _zero_sent(false), _messages(0), _overflow(0)
+{
+}
+
+// Returns the ID for str, emitting its definition the first time that ID is
+// seen. The table is keyed by the content hash (open addressing, linear
+// probing): hashing is one pass over the string, as args::pack() already does
+// for the format. Caller holds _lock.
+uint32_t BinaryLogger::lookup(const char* str) {
+    if (str == nullptr) str = "";
+    const uint32_t id = string_id(str);
+
+    uint32_t* slot = nullptr;
+    if (id == 0) {
+        if (_zero_sent) return id;
+    } else {
+        size_t index = id & (TABLE_SIZE - 1);
+        for (size_t probe = 0; probe < TABLE_SIZE && slot == nullptr; ++probe) {
+            if (_sent[index] == id) return id;
+            if (_sent[index] == 0) slot = &_sent[index];
+            index = (index + 1) & (TABLE_SIZE - 1);
+        }
+        if (slot == nullptr) {
+            // Full: re-sending the definition on every call would undo the binary format
+            ++_overflow;
+            return id;
+        }
+    }
+
+    size_t length = strlen(str);
+    if (length > 0xFFFF) length = 0xFFFF;
+
+    uint8_t header[7];
+    header[0] = RECORD_DEFINITION;
+    memcpy(header + 1, &id, 4);
+    const uint16_t length16 = static_cast<uint16_t>(length);
+    memcpy(header + 5, &length16, 2);
+    _write(header, sizeof(header), _context);
+    _write(reinterpret_cast<const uint8_t*>(str), length, _context);
+
+    if (slot != nullptr) {
+        *slot = id;
+    } else {
+        _zero_sent = true;
+    }
+    return id;
+}
+
+void BinaryLogger::log(LogLevel level, const char* tag, const char* format, std::va_list args) {
+    uint8_t record[16 + ARG_BYTES];
+    std::va_list copy;
+    va_copy(copy, args);
+    const uint16_t arg_size = static_cast<uint16_t>(args::pack(record + 16, ARG_BYTES, format, copy));
+    va_end(copy);
+    const uint32_t timestamp = flexhal::utils::time::micros();
+
+    while (_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    const uint32_t format_id = lookup(format);
+    const uint32_t tag_id    = lookup(tag);
+
+    record[0] = RECORD_MESSAGE;
+    memcpy(record + 1, &format_id, 4);
+    record[5] = static_cast<uint8_t>(level);
+    memcpy(record + 6, &tag_id, 4);
+    memcpy(record + 10, &timestamp, 4);
+    memcpy(record + 14, &arg_size, 2);
+    _write(record, 16 + arg_size, _context);
+    ++_messages;
+    _lock.clear(std::memory_order_release);
+}
+
+uint32_t BinaryLogger::registerString(const char* str) {
+    while (_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    const uint32_t id = lookup(str);
+    _lock.clear(std::memory_order_release);
+    return id;
+}
+
+void BinaryLogger::resendDefinitions() {
+    while (_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    for (size_t i = 0; i < TABLE_SIZE; ++i) {
+        _sent[i] = 0;
+    }
+    _zero_sent = false;
+    _lock.clear(std::memory_order_release);
+}
+
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_LOGGER_BINARYLOGGER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
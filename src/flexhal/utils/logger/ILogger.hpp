@@ -39,6 +39,14 @@ public:
      */
     virtual void log(LogLevel level, const char* tag, const char* format, std::va_list args) = 0;
 
+    /**
+     * @brief Writes out any buffered messages.
+     *
+     * Synchronous loggers have nothing to do here. Buffering loggers
+     * (e.g., AsyncLogger) format and emit their pending entries.
+     */
+    virtual void flush() {}
+
     // Note: Level management (setLevel/getLevel) is intentionally omitted here.
     // It's assumed to be handled either by the specific implementation
     // or by a global mechanism (now in logger_globals.hpp).
@@ -2,6 +2,7 @@
 
 #include "../logger.hpp" // Needs LogLevel, ILogger*, _active_logger, _default_log_level
 #include "ILogger.hpp"
+#include "TagLevelTable.hpp"
 
 #include <cstdarg>    // For va_start, va_end
 
@@ -17,19 +18,49 @@ namespace logger {
  */
 class LogProxy {
 private:
-    // Helper function to check level and call logger
-    // This avoids repeating the check in every public method
+    // Helper function to call the active logger.
+    // Callers check isEnabled() first so that disabled calls skip va_start entirely.
     static void log_internal(LogLevel level, const char* tag, const char* format, va_list args) {
-        if (_active_logger && level != LogLevel::NONE && level <= _default_log_level) {
-             _active_logger->log(level, tag, format, args);
-        }
+        _active_logger->log(level, tag, format, args);
     }
 
 public:
+    /**
+     * @brief Checks whether a message of the given level and tag would be written.
+     *
+     * Uses the tag's override if one is set (setTagLogLevel), otherwise the
+     * global level. This is the runtime filter only; the compile-time
+     * threshold (FLEXHAL_LOG_MIN_LEVEL) is applied by the FLEXHAL_LOGx macros.
+     */
+    static bool isEnabled(LogLevel level, const char* tag = nullptr) {
+        if (!_active_logger || level == LogLevel::NONE) {
+            return false;
+        }
+        const LogLevel threshold = _tag_levels.empty() ? _default_log_level
+                                                       : _tag_levels.lookup(tag, _default_log_level);
+        return level <= threshold;
+    }
+
+    /**
+     * @brief Writes a message without checking the level.
+     *
+     * The FLEXHAL_LOGx macros call this after their own isEnabled() check, so
+     * the tag is looked up once per call. Check isEnabled() first when calling
+     * it directly.
+     */
+    static void write(LogLevel level, const char* tag, const char* format, ...) {
+        if (!_active_logger) return; // setLogger(nullptr) may have run since the check
+        va_list args_list;
+        va_start(args_list, format);
+        log_internal(level, tag, format, args_list);
+        va_end(args_list);
+    }
+
     // Removed the templated log function as va_start doesn't work easily with templates this way.
     // Instead, each public function will handle va_start/va_end.
 
     void error(const char* tag, const char* format, ...) {
+        if (!isEnabled(LogLevel::ERROR, tag)) return;
         va_list args_list;
         va_start(args_list, format);
         log_internal(LogLevel::ERROR, tag, format, args_list);
@@ -37,6 +68,7 @@ public:
     }
 
     void warn(const char* tag, const char* format, ...) {
+        if (!isEnabled(LogLevel::WARN, tag)) return;
         va_list args_list;
         va_start(args_list, format);
         log_internal(LogLevel::WARN, tag, format, args_list);
@@ -44,6 +76,7 @@ public:
     }
 
     void info(const char* tag, const char* format, ...) {
+        if (!isEnabled(LogLevel::INFO, tag)) return;
         va_list args_list;
         va_start(args_list, format);
         log_internal(LogLevel::INFO, tag, format, args_list);
@@ -51,6 +84,7 @@ public:
     }
 
     void debug(const char* tag, const char* format, ...) {
+        if (!isEnabled(LogLevel::DEBUG, tag)) return;
         va_list args_list;
         va_start(args_list, format);
         log_internal(LogLevel::DEBUG, tag, format, args_list);
@@ -58,11 +92,21 @@ public:
     }
 
     void verbose(const char* tag, const char* format, ...) {
+        if (!isEnabled(LogLevel::VERBOSE, tag)) return;
         va_list args_list;
         va_start(args_list, format);
         log_internal(LogLevel::VERBOSE, tag, format, args_list);
         va_end(args_list);
     }
+
+    /**
+     * @brief Flushes the active logger (drains AsyncLogger; call from an idle hook).
+     */
+    void flush() {
+        if (_active_logger) {
+            _active_logger->flush();
+        }
+    }
 };
 
 } // namespace logger
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "../logger.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+
+/**
+ * @brief Fixed-size table of per-tag log level overrides.
+ *
+ * Slots hold overrides only and are keyed by string_id() of the tag (open
+ * addressing, linear probing), so tags match by content: a tag built at run
+ * time matches an override set with a literal, and logging with any number of
+ * distinct tag pointers never takes a slot. Two tags whose 32-bit IDs collide
+ * share an override.
+ *
+ * lookup() is lock-free; set()/clear() serialize on a spin flag. A lookup()
+ * that races set()/clear() of the same tag may see either level.
+ */
+class TagLevelTable {
+public:
+    /// Number of slots (power of two), i.e. the maximum number of overrides.
+    static constexpr size_t TABLE_SIZE = 64;
+
+    TagLevelTable();
+
+    /**
+     * @brief Sets the override for every tag string equal to tag.
+     * @return status::ok, or status::no_memory if the table is full.
+     */
+    base::status set(const char* tag, LogLevel level);
+
+    /**
+     * @brief Removes the override for tag and frees its slot.
+     */
+    void clear(const char* tag);
+
+    /**
+     * @brief Removes every override.
+     */
+    void clearAll();
+
+    /**
+     * @brief Returns the level for tag, or fallback if it has no override.
+     */
+    LogLevel lookup(const char* tag, LogLevel fallback) const;
+
+    /**
+     * @brief True when no override is set (the caller can skip lookup()).
+     */
+    bool empty() const {
+        return _override_count.load(std::memory_order_relaxed) == 0;
+    }
+
+private:
+    static constexpr int8_t USE_GLOBAL = -1;
+
+    struct Slot {
+        std::atomic<uint32_t> hash;
+        std::atomic<int8_t> level; // USE_GLOBAL once cleared; the slot can then be reused
+        std::atomic<bool> used;    // Ever held an override; an unused slot ends a probe sequence
+    };
+
+    static size_t slot_of(uint32_t hash) {
+        return hash & (TABLE_SIZE - 1);
+    }
+
+    void lock();
+    void unlock();
+    Slot* find(uint32_t hash, Slot** free_slot);
+
+    Slot _slots[TABLE_SIZE];
+    std::atomic<uint32_t> _override_count;
+    std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+};
+
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_LOGGER_TAGLEVELTABLE_IPP
+#define FLEXHAL_INTERNAL_UTILS_LOGGER_TAGLEVELTABLE_IPP
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+
+TagLevelTable::TagLevelTable() : _override_count(0)
+{
+    for (size_t i = 0; i < TABLE_SIZE; ++i) {
+        _slots[i].hash.store(0, std::memory_order_relaxed);
+        _slots[i].level.store(USE_GLOBAL, std::memory_order_relaxed);
+        _slots[i].used.store(false, std::memory_order_relaxed);
+    }
+}
+
+void TagLevelTable::lock() {
+    while (_lock.test_and_set(std::memory_order_acquire)) {
+    }
+}
+
+void TagLevelTable::unlock() {
+    _lock.clear(std::memory_order_release);
+}
+
+// Caller holds the lock. Returns the slot holding hash (set or cleared), or
+// nullptr; free_slot receives the first slot of the probe sequence that can
+// take a new override (nullptr if the table is full).
+TagLevelTable::Slot* TagLevelTable::find(uint32_t hash, Slot** free_slot) {
+    *free_slot   = nullptr;
+    size_t index = slot_of(hash);
+    for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+        Slot& slot = _slots[index];
+        if (!slot.used.load(std::memory_order_relaxed)) {
+            if (*free_slot == nullptr) *free_slot = &slot;
+            return nullptr;
+        }
+        if (slot.hash.load(std::memory_order_relaxed) == hash) return &slot;
+        if (*free_slot == nullptr && slot.level.load(std::memory_order_relaxed) == USE_GLOBAL) {
+            *free_slot = &slot;
+        }
+        index = (index + 1) & (TABLE_SIZE - 1);
+    }
+    return nullptr;
+}
+
+base::status TagLevelTable::set(const char* tag, LogLevel level) {
+    if (tag == nullptr) return base::status::param;
+    const uint32_t hash = string_id(tag);
+    const int8_t value  = static_cast<int8_t>(level);
+
+    lock();
+    Slot* free_slot = nullptr;
+    Slot* slot      = find(hash, &free_slot);
+    if (slot == nullptr) {
+        if (free_slot == nullptr) {
+            unlock();
+            return base::status::no_memory;
+        }
+        // The level is still USE_GLOBAL here, so a racing lookup() of the
+        // previous tag falls back to the global level. Publish used last.
+        slot = free_slot;
+        slot->hash.store(hash, std::memory_order_relaxed);
+        slot->used.store(true, std::memory_order_release);
+    }
+    if (slot->level.load(std::memory_order_relaxed) == USE_GLOBAL) {
+        _override_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    slot->level.store(value, std::memory_order_release);
+    unlock();
+    return base::status::ok;
+}
+
+void TagLevelTable::clear(const char* tag) {
+    if (tag == nullptr) return;
+
+    lock();
+    Slot* free_slot = nullptr;
+    Slot* slot      = find(string_id(tag), &free_slot);
+    if (slot != nullptr && slot->level.load(std::memory_order_relaxed) != USE_GLOBAL) {
+        slot->level.store(USE_GLOBAL, std::memory_order_relaxed);
+        _override_count.fetch_sub(1, std::memory_order_relaxed);
+    }
+    unlock();
+}
+
+void TagLevelTable::clearAll() {
+    lock();
+    for (size_t i = 0; i < TABLE_SIZE; ++i) {
+        _slots[i].level.store(USE_GLOBAL, std::memory_order_relaxed);
+    }
+    _override_count.store(0, std::memory_order_relaxed);
+    unlock();
+}
+
+LogLevel TagLevelTable::lookup(const char* tag, LogLevel fallback) const {
+    if (tag == nullptr) return fallback;
+
+    const uint32_t hash = string_id(tag);
+    size_t index        = slot_of(hash);
+    for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+        const Slot& slot = _slots[index];
+        if (!slot.used.load(std::memory_order_acquire)) break;
+        if (slot.hash.load(std::memory_order_relaxed) == hash) {
+            const int8_t level = slot.level.load(std::memory_order_acquire);
+            return (level == USE_GLOBAL) ? fallback : static_cast<LogLevel>(level);
+        }
+        index = (index + 1) & (TABLE_SIZE - 1);
+    }
+    return fallback;
+}
+
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_LOGGER_TAGLEVELTABLE_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
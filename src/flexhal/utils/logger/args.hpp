@@ -0,0 +1,381 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+/**
+ * @brief Capture printf-style arguments as raw bytes and format them later.
+ *
+ * pack() walks the format string only to learn the type of each argument and
+ * copies the values into a byte buffer; no conversion to text takes place.
+ * The layout is implied by the format string, so the same format is needed to
+ * read the buffer back (format() here, or a host-side decoder):
+ *
+ * - `*` width / precision and integer conversions without `l`/`ll`/`j`/`z`/`t`: 4 bytes
+ * - integer conversions with `l`, `ll`, `j`, `z`, `t`: 8 bytes, widened from the
+ *   argument's own type (`long` and `size_t` are 32-bit on ESP32)
+ * - `%c` / `%lc`: 4 bytes
+ * - floating-point conversions: 8 bytes (IEEE-754 double; `%Lf` is narrowed
+ *   from `long double`)
+ * - `%p`: 8 bytes
+ * - `%s`: the string bytes followed by a NUL (truncated if the buffer runs out)
+ * - `%n` is not supported and consumes its argument without storing anything
+ *
+ * All values are stored little-endian.
+ */
+namespace args {
+
+/**
+ * @brief Packs the arguments described by format into buffer.
+ * @param buffer Destination buffer.
+ * @param capacity Size of buffer in bytes.
+ * @param format printf-style format string.
+ * @param list Arguments matching format. Consumed by this call.
+ * @return Number of bytes written. Arguments that do not fit are dropped.
+ */
+size_t pack(uint8_t* buffer, size_t capacity, const char* format, std::va_list list);
+
+/**
+ * @brief Formats packed arguments into text.
+ * @param out Destination buffer (always NUL-terminated when out_size > 0).
+ * @param out_size Size of out in bytes.
+ * @param format The format string that was passed to pack().
+ * @param packed Packed argument bytes.
+ * @param packed_size Number of valid bytes in packed.
+ * @return Number of characters written (excluding the NUL).
+ */
+size_t format(char* out, size_t out_size, const char* format, const uint8_t* packed, size_t packed_size);
+
+} // namespace args
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_LOGGER_ARGS_IPP
+#define FLEXHAL_INTERNAL_UTILS_LOGGER_ARGS_IPP
+
+#include <stdio.h>
+#include <string.h>
+
+#include <type_traits>
+
+namespace flexhal {
+namespace utils {
+namespace logger {
+namespace args {
+
+namespace {
+
+// Argument classes, derived from the conversion specifier and length modifier.
+enum class ArgKind : uint8_t {
+    None,    // "%%" or unknown conversion
+    Int32,
+    Int64,
+    Double,
+    Pointer,
+    String,
+    Skip,    // "%n"
+};
+
+// Length modifiers that change the type va_arg() has to read.
+enum class Length : uint8_t {
+    None,       // Also "h" / "hh": promoted to int
+    Long,       // "l"
+    LongLong,   // "ll"
+    IntMax,     // "j"
+    Size,       // "z"
+    PtrDiff,    // "t"
+    LongDouble, // "L"
+};
+
+struct Spec {
+    const char* begin = nullptr; // Points at '%'
+    const char* end   = nullptr; // One past the conversion character
+    uint8_t stars     = 0;       // Number of '*' (width / precision from arguments)
+    ArgKind kind      = ArgKind::None;
+    Length length     = Length::None;
+    bool is_signed    = true;
+};
+
+// Parses one conversion specification starting at '%'.
+const char* parse_spec(const char* p, Spec& spec) {
+    spec       = Spec();
+    spec.begin = p++;
+    if (*p == '%') {
+        spec.end = p + 1;
+        return spec.end;
+    }
+    while (*p && strchr("-+ #0", *p)) ++p;             // flags
+    if (*p == '*') { ++spec.stars; ++p; }
+    while (*p >= '0' && *p <= '9') ++p;                 // width
+    if (*p == '.') {
+        ++p;
+        if (*p == '*') { ++spec.stars; ++p; }
+        while (*p >= '0' && *p <= '9') ++p;             // precision
+    }
+    if (*p == 'h') { ++p; if (*p == 'h') ++p; }
+    else if (*p == 'l') { ++p; spec.length = Length::Long; if (*p == 'l') { ++p; spec.length = Length::LongLong; } }
+    else if (*p == 'j') { ++p; spec.length = Length::IntMax; }
+    else if (*p == 'z') { ++p; spec.length = Length::Size; }
+    else if (*p == 't') { ++p; spec.length = Length::PtrDiff; }
+    else if (*p == 'L') { ++p; spec.length = Length::LongDouble; }
+    const bool wide = spec.length != Length::None && spec.length != Length::LongDouble;
+
+    switch (*p) {
+        case 'c': // "%lc" takes a wint_t, which is int-sized
+            spec.kind = ArgKind::Int32;
+            break;
+        case 'd': case 'i':
+            spec.kind = wide ? ArgKind::Int64 : ArgKind::Int32;
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            spec.kind      = wide ? ArgKind::Int64 : ArgKind::Int32;
+            spec.is_signed = false;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            spec.kind = ArgKind::Double;
+            break;
+        case 'p':
+            spec.kind = ArgKind::Pointer;
+            break;
+        case 's':
+            spec.kind = ArgKind::String;
+            break;
+        case 'n':
+            spec.kind = ArgKind::Skip;
+            break;
+        case '\0':
+            spec.end = p;
+            return p;
+        default:
+            break;
+    }
+    spec.end = p + 1;
+    return spec.end;
+}
+
+template <typename T>
+bool put(uint8_t* buffer, size_t capacity, size_t& used, T value) {
+    if (used + sizeof(T) > capacity) return false;
+    memcpy(buffer + used, &value, sizeof(T));
+    used += sizeof(T);
+    return true;
+}
+
+template <typename T>
+bool get(const uint8_t* packed, size_t packed_size, size_t& used, T& value) {
+    if (used + sizeof(T) > packed_size) return false;
+    memcpy(&value, packed + used, sizeof(T));
+    used += sizeof(T);
+    return true;
+}
+
+// snprintf with 0-2 leading '*' arguments.
+template <typename T>
+int emit(char* out, size_t size, const char* spec, const int32_t* star, uint8_t stars, T value) {
+    switch (stars) {
+        case 0:  return snprintf(out, size, spec, value);
+        case 1:  return snprintf(out, size, spec, star[0], value);
+        default: return snprintf(out, size, spec, star[0], star[1], value);
+    }
+}
+
+} // namespace
+
+size_t pack(uint8_t* buffer, size_t capacity, const char* format, std::va_list list) {
+    size_t used = 0;
+    if (format == nullptr) return 0;
+
+    for (const char* p = format; *p;) {
+        if (*p != '%') { ++p; continue; }
+        Spec spec;
+        p = parse_spec(p, spec);
+        for (uint8_t i = 0; i < spec.stars; ++i) {
+            if (!put<int32_t>(buffer, capacity, used, va_arg(list, int))) return used;
+        }
+        bool ok = true;
+        switch (spec.kind) {
+            case ArgKind::Int32:
+                ok = put<int32_t>(buffer, capacity, used, va_arg(list, int));
+                break;
+            case ArgKind::Int64: {
+                // Read the argument at its own width, then widen it to the 8 stored bytes.
+                int64_t value;
+                switch (spec.length) {
+                    case Length::Long:
+                        value = spec.is_signed ? static_cast<int64_t>(va_arg(list, long))
+                                               : static_cast<int64_t>(va_arg(list, unsigned long));
+                        break;
+                    case Length::IntMax:
+                        value = spec.is_signed ? static_cast<int64_t>(va_arg(list, intmax_t))
+                                               : static_cast<int64_t>(va_arg(list, uintmax_t));
+                        break;
+                    case Length::Size:
+                        value = spec.is_signed ? static_cast<int64_t>(va_arg(list, std::make_signed<size_t>::type))
+                                               : static_cast<int64_t>(va_arg(list, size_t));
+                        break;
+                    case Length::PtrDiff:
+                        value = spec.is_signed ? static_cast<int64_t>(va_arg(list, ptrdiff_t))
+                                               : static_cast<int64_t>(va_arg(list, std::make_unsigned<ptrdiff_t>::type));
+                        break;
+                    default:
+                        value = spec.is_signed ? static_cast<int64_t>(va_arg(list, long long))
+                                               : static_cast<int64_t>(va_arg(list, unsigned long long));
+                        break;
+                }
+                ok = put<int64_t>(buffer, capacity, used, value);
+                break;
+            }
+            case ArgKind::Double:
+                ok = put<double>(buffer, capacity, used,
+                                 spec.length == Length::LongDouble ? static_cast<double>(va_arg(list, long double))
+                                                                   : va_arg(list, double));
+                break;
+            case ArgKind::Pointer:
+                ok = put<uint64_t>(buffer, capacity, used, reinterpret_cast<uintptr_t>(va_arg(list, void*)));
+                break;
+            case ArgKind::String: {
+                const char* str = va_arg(list, const char*);
+                if (str == nullptr) str = "(null)";
+                if (used >= capacity) return used;
+                size_t room = capacity - used - 1; // Keep one byte for the NUL
+                size_t len  = strlen(str);
+                if (len > room) len = room;
+                memcpy(buffer + used, str, len);
+                used += len;
+                buffer[used++] = '\0';
+                break;
+            }
+            case ArgKind::Skip:
+                (void)va_arg(list, void*);
+                break;
+            case ArgKind::None:
+                break;
+        }
+        if (!ok) return used;
+    }
+    return used;
+}
+
+size_t format(char* out, size_t out_size, const char* format, const uint8_t* packed, size_t packed_size) {
+    if (out == nullptr || out_size == 0) return 0;
+    size_t pos  = 0;
+    size_t used = 0;
+    out[0]      = '\0';
+    if (format == nullptr) return 0;
+
+    auto append = [&](const char* text, size_t len) {
+        if (pos + 1 >= out_size) return;
+        if (len > out_size - 1 - pos) len = out_size - 1 - pos;
+        memcpy(out + pos, text, len);
+        pos += len;
+        out[pos] = '\0';
+    };
+
+    for (const char* p = format; *p && pos + 1 < out_size;) {
+        if (*p != '%') {
+            const char* next = strchr(p, '%');
+            size_t len       = next ? static_cast<size_t>(next - p) : strlen(p);
+            append(p, len);
+            p += len;
+            continue;
+        }
+        Spec spec;
+        p = parse_spec(p, spec);
+        if (spec.kind == ArgKind::None) {
+            if (spec.end - spec.begin == 2 && spec.begin[1] == '%') append("%", 1);
+            else append(spec.begin, static_cast<size_t>(spec.end - spec.begin));
+            continue;
+        }
+        if (spec.kind == ArgKind::Skip) continue;
+
+        // Copy the specification so it can be handed to snprintf on its own.
+        char spec_text[24];
+        size_t spec_len = static_cast<size_t>(spec.end - spec.begin);
+        if (spec_len >= sizeof(spec_text)) return pos;
+        memcpy(spec_text, spec.begin, spec_len);
+        spec_text[spec_len] = '\0';
+
+        int32_t star[2] = {0, 0};
+        for (uint8_t i = 0; i < spec.stars; ++i) {
+            if (!get(packed, packed_size, used, star[i])) return pos;
+        }
+
+        // Normalize the length modifier to match the stored width.
+        if (spec.kind == ArgKind::Int64 || spec.kind == ArgKind::Double) {
+            char conv    = spec_text[spec_len - 1];
+            size_t head  = spec_len - 1;
+            while (head > 0 && strchr("hlLjzt", spec_text[head - 1])) --head;
+            const char* mod = (spec.kind == ArgKind::Int64) ? "ll" : "";
+            size_t mod_len  = strlen(mod);
+            if (head + mod_len + 2 > sizeof(spec_text)) return pos;
+            memcpy(spec_text + head, mod, mod_len);
+            spec_text[head + mod_len]     = conv;
+            spec_text[head + mod_len + 1] = '\0';
+        }
+
+        char* dest   = out + pos;
+        size_t avail = out_size - pos;
+        int written  = 0;
+        switch (spec.kind) {
+            case ArgKind::Int32: {
+                int32_t v;
+                if (!get(packed, packed_size, used, v)) return pos;
+                written = spec.is_signed ? emit(dest, avail, spec_text, star, spec.stars, static_cast<int>(v))
+                                         : emit(dest, avail, spec_text, star, spec.stars, static_cast<unsigned>(v));
+                break;
+            }
+            case ArgKind::Int64: {
+                int64_t v;
+                if (!get(packed, packed_size, used, v)) return pos;
+                written = spec.is_signed
+                              ? emit(dest, avail, spec_text, star, spec.stars, static_cast<long long>(v))
+                              : emit(dest, avail, spec_text, star, spec.stars, static_cast<unsigned long long>(v));
+                break;
+            }
+            case ArgKind::Double: {
+                double v;
+                if (!get(packed, packed_size, used, v)) return pos;
+                written = emit(dest, avail, spec_text, star, spec.stars, v);
+                break;
+            }
+            case ArgKind::Pointer: {
+                uint64_t v;
+                if (!get(packed, packed_size, used, v)) return pos;
+                written = emit(dest, avail, spec_text, star, spec.stars,
+                               reinterpret_cast<void*>(static_cast<uintptr_t>(v)));
+                break;
+            }
+            case ArgKind::String: {
+                if (used >= packed_size) return pos;
+                const char* str = reinterpret_cast<const char*>(packed + used);
+                size_t len      = strnlen(str, packed_size - used);
+                if (used + len >= packed_size) return pos; // Missing terminator
+                used += len + 1;
+                written = emit(dest, avail, spec_text, star, spec.stars, str);
+                break;
+            }
+            default:
+                break;
+        }
+        if (written > 0) {
+            pos += (static_cast<size_t>(written) < avail) ? static_cast<size_t>(written) : avail - 1;
+        }
+    }
+    return pos;
+}
+
+} // namespace args
+} // namespace logger
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_LOGGER_ARGS_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
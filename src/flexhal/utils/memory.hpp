@@ -0,0 +1,9 @@
+#pragma once
+
+// Fixed-size allocators for object graphs.
+// Arena hands out contiguous memory from one buffer (released all at once),
+// ObjectPool keeps a fixed number of slots for one type. Both report
+// MemoryStats (usage, high-water mark, fragmentation).
+#include "memory/MemoryStats.hpp"
+#include "memory/Arena.hpp"
+#include "memory/ObjectPool.hpp"
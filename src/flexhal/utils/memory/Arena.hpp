@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "MemoryStats.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace memory {
+
+/**
+ * @brief Bump allocator over a fixed buffer, for object graphs built once.
+ *
+ * Related objects (a GPIO with its ports and pins, a bus with its devices)
+ * constructed into one arena sit next to each other in memory and cost no
+ * per-object heap header. Memory is only given back all at once by reset();
+ * objects created with create() must be destroyed by their owner first
+ * (destroy() runs the destructor only). Not thread-safe: build the graph
+ * from one thread, typically during initialization.
+ */
+class Arena {
+public:
+    /**
+     * @param buffer Storage used by the arena; must outlive it. nullptr makes an empty arena.
+     * @param size Size of buffer in bytes.
+     */
+    Arena(void* buffer, size_t size);
+
+    Arena(const Arena&)            = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @return size bytes aligned to alignment (a power of two), or nullptr if they do not fit.
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Uninitialized storage for count objects of type T, contiguous.
+     */
+    template <class T>
+    T* allocateArray(size_t count) {
+        if (count > SIZE_MAX / sizeof(T)) {
+            ++_failed;
+            return nullptr;
+        }
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * @brief Constructs a T in the arena.
+     * @return The object, or nullptr if the arena is full.
+     */
+    template <class T, class... Args>
+    T* create(Args&&... args) {
+        void* p = allocate(sizeof(T), alignof(T));
+        return p != nullptr ? new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /**
+     * @brief Runs the destructor of an object made by create(); its memory stays used until reset().
+     */
+    template <class T>
+    static void destroy(T* object) {
+        if (object != nullptr) object->~T();
+    }
+
+    /**
+     * @brief Makes the whole buffer available again. Keeps the high-water mark.
+     */
+    void reset();
+
+    bool owns(const void* p) const;
+
+    size_t getCapacity() const {
+        return _capacity;
+    }
+
+    size_t getUsed() const {
+        return _used;
+    }
+
+    size_t getRemaining() const {
+        return _capacity - _used;
+    }
+
+    size_t getHighWater() const {
+        return _high_water;
+    }
+
+    /**
+     * @brief Byte counts; fragmentation is the share of used bytes lost to alignment padding.
+     */
+    MemoryStats getStats() const;
+
+private:
+    uint8_t* _buffer;
+    size_t _capacity;
+    size_t _used;
+    size_t _high_water;
+    size_t _padding;
+    uint32_t _allocations;
+    uint32_t _failed;
+};
+
+/**
+ * @brief Arena with its own storage of Size bytes (static or on the stack,
+ *        depending on where it is declared).
+ */
+template <size_t Size>
+class StaticArena : public Arena {
+public:
+    StaticArena() : Arena(_storage, Size) {}
+
+private:
+    alignas(std::max_align_t) uint8_t _storage[Size];
+};
+
+} // namespace memory
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_MEMORY_ARENA_IPP
+#define FLEXHAL_INTERNAL_UTILS_MEMORY_ARENA_IPP
+
+namespace flexhal {
+namespace utils {
+namespace memory {
+
+Arena::Arena(void* buffer, size_t size)
+    : _buffer(static_cast<uint8_t*>(buffer)),
+      _capacity(buffer != nullptr ? size : 0),
+      _used(0),
+      _high_water(0),
+      _padding(0),
+      _allocations(0),
+      _failed(0)
+{
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    const uintptr_t current = reinterpret_cast<uintptr_t>(_buffer + _used);
+    const size_t padding    = static_cast<size_t>((alignment - (current & (alignment - 1))) & (alignment - 1));
+    if (padding > _capacity - _used || size > _capacity - _used - padding) {
+        ++_failed;
+        return nullptr;
+    }
+    void* p = _buffer + _used + padding;
+    _used += padding + size;
+    _padding += padding;
+    ++_allocations;
+    if (_used > _high_water) _high_water = _used;
+    return p;
+}
+
+void Arena::reset() {
+    _used    = 0;
+    _padding = 0;
+}
+
+bool Arena::owns(const void* p) const {
+    const uint8_t* byte = static_cast<const uint8_t*>(p);
+    return _buffer != nullptr && byte >= _buffer && byte < _buffer + _capacity;
+}
+
+MemoryStats Arena::getStats() const {
+    MemoryStats stats;
+    stats.capacity      = _capacity;
+    stats.used          = _used;
+    stats.high_water    = _high_water;
+    stats.allocations   = _allocations;
+    stats.failed        = _failed;
+    stats.fragmentation = _used != 0 ? static_cast<float>(_padding) / static_cast<float>(_used) : 0.0f;
+    return stats;
+}
+
+} // namespace memory
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_MEMORY_ARENA_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
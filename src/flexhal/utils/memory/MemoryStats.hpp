@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flexhal {
+namespace utils {
+namespace memory {
+
+/**
+ * @brief Usage of an Arena (in bytes) or an ObjectPool (in slots).
+ */
+struct MemoryStats {
+    size_t capacity;      ///< Total bytes or slots.
+    size_t used;          ///< Currently used.
+    size_t high_water;    ///< Largest value of used so far.
+    uint32_t allocations; ///< Successful allocations.
+    uint32_t failed;      ///< Allocations that did not fit.
+    float fragmentation;  ///< 0 (compact) to 1; see the allocator for its exact meaning.
+};
+
+} // namespace memory
+} // namespace utils
+} // namespace flexhal
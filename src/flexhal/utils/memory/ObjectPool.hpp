@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "MemoryStats.hpp"
+
+// ESP-IDF (including Arduino-ESP32): the pool lock is a FreeRTOS critical section, which
+// masks interrupts on this core and spins against the other core, so ISRs may use the pool.
+#if defined(ESP_PLATFORM) && defined(__has_include)
+#if __has_include(<freertos/FreeRTOS.h>)
+#include <freertos/FreeRTOS.h>
+#define FLEXHAL_INTERNAL_MEMORY_POOL_CRITICAL 1
+#endif
+#endif
+#ifndef FLEXHAL_INTERNAL_MEMORY_POOL_CRITICAL
+#define FLEXHAL_INTERNAL_MEMORY_POOL_CRITICAL 0
+#endif
+
+namespace flexhal {
+namespace utils {
+namespace memory {
+
+/**
+ * @brief Fixed pool of Capacity slots for objects of type T.
+ *
+ * The storage is part of the pool, so creating an object never touches the
+ * heap and all objects of one kind (e.g. the devices of a bus driver) stay in
+ * one block. Free slots are handed out lowest address first until the pool
+ * has been filled once, then most recently freed first. create()/destroy()
+ * may be called from any thread. On ESP-IDF the bookkeeping runs in a
+ * critical section, so ISRs may call them too; elsewhere it is guarded by a
+ * spin flag, so do not call them from a signal handler or an interrupt that
+ * can preempt another user of the same pool.
+ */
+template <class T, size_t Capacity>
+class ObjectPool {
+    static_assert(Capacity > 0, "ObjectPool needs at least one slot");
+
+public:
+    ObjectPool() : _free(nullptr), _used(0), _high_water(0), _allocations(0), _failed(0)
+    {
+        for (size_t i = Capacity; i > 0; --i) {
+            _slots[i - 1].next = _free;
+            _free              = &_slots[i - 1];
+        }
+    }
+
+    /**
+     * @brief Objects still alive are not destroyed; destroy them first.
+     */
+    ~ObjectPool() = default;
+
+    ObjectPool(const ObjectPool&)            = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /**
+     * @return The new object, or nullptr if every slot is in use.
+     */
+    template <class... Args>
+    T* create(Args&&... args) {
+        lock();
+        Slot* slot = _free;
+        if (slot != nullptr) {
+            _free = slot->next;
+            slot->live = true;
+            ++_used;
+            ++_allocations;
+            if (_used > _high_water) _high_water = _used;
+        } else {
+            ++_failed;
+        }
+        unlock();
+        return slot != nullptr ? new (slot->bytes) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /**
+     * @brief Destroys an object made by create() and frees its slot.
+     */
+    void destroy(T* object) {
+        if (object == nullptr) return;
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(reinterpret_cast<unsigned char*>(object) - offsetof(Slot, bytes));
+        lock();
+        slot->live = false;
+        slot->next = _free;
+        _free      = slot;
+        --_used;
+        unlock();
+    }
+
+    bool owns(const T* object) const {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(object);
+        return p >= reinterpret_cast<const unsigned char*>(_slots) &&
+               p < reinterpret_cast<const unsigned char*>(_slots + Capacity);
+    }
+
+    size_t getCapacity() const {
+        return Capacity;
+    }
+
+    size_t getUsed() const {
+        lock();
+        const size_t used = _used;
+        unlock();
+        return used;
+    }
+
+    size_t getHighWater() const {
+        lock();
+        const size_t high_water = _high_water;
+        unlock();
+        return high_water;
+    }
+
+    /**
+     * @brief Slot counts; fragmentation is the share of free slots among
+     *        those below the highest live one (0 when the live objects are
+     *        packed at the start of the pool).
+     */
+    MemoryStats getStats() const {
+        lock();
+        MemoryStats stats;
+        stats.capacity    = Capacity;
+        stats.used        = _used;
+        stats.high_water  = _high_water;
+        stats.allocations = _allocations;
+        stats.failed      = _failed;
+        size_t span       = 0;
+        for (size_t i = Capacity; i > 0; --i) {
+            if (_slots[i - 1].live) {
+                span = i;
+                break;
+            }
+        }
+        unlock();
+        stats.fragmentation = span != 0 ? static_cast<float>(span - stats.used) / static_cast<float>(span) : 0.0f;
+        return stats;
+    }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+        Slot* next;
+        bool live = false;
+    };
+
+#if FLEXHAL_INTERNAL_MEMORY_POOL_CRITICAL
+    void lock() const {
+        portENTER_CRITICAL_SAFE(&_lock);
+    }
+
+    void unlock() const {
+        portEXIT_CRITICAL_SAFE(&_lock);
+    }
+#else
+    void lock() const {
+        while (_lock.test_and_set(std::memory_order_acquire)) {
+        }
+    }
+
+    void unlock() const {
+        _lock.clear(std::memory_order_release);
+    }
+#endif
+
+    Slot _slots[Capacity];
+    Slot* _free;
+    size_t _used;
+    size_t _high_water;
+    uint32_t _allocations;
+    uint32_t _failed;
+#if FLEXHAL_INTERNAL_MEMORY_POOL_CRITICAL
+    mutable portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+#else
+    mutable std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+#endif
+};
+
+} // namespace memory
+} // namespace utils
+} // namespace flexhal
@@ -0,0 +1,9 @@
+#pragma once
+
+// Cooperative coroutine tasks (C++20 only; nothing is declared otherwise).
+// Task coroutines take their frames from a fixed FramePool and are driven by
+// an Executor from the application loop: co_await sleep_for(us),
+// sleep_until(t), yield_now() or pin.edge(PinEdge::Rising) instead of blocking.
+#include "task/FramePool.hpp"
+#include "task/Task.hpp"
+#include "task/Executor.hpp"
@@ -0,0 +1,524 @@
+#pragma once
+
+#include "Task.hpp"
+
+#if FLEXHAL_INTERNAL_TASK
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/hal/gpio.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace task {
+
+struct EdgeAwaiter;
+struct PollAwaiter;
+
+/**
+ * @brief Single-threaded cooperative scheduler for Task coroutines.
+ *
+ * Tasks run until they co_await one of the awaitables below, at which point
+ * the executor parks them: in a ready queue (yield_now), a min-heap keyed
+ * by deadline (sleep_for / sleep_until), a list of pins polled for edges
+ * (`co_await pin.edge(...)`) or a list of conditions polled until they hold
+ * (poll_until(), e.g. completion of a driver transaction). run() resumes whatever is due and, when nothing
+ * is, sleeps through utils::time until the earliest deadline, so many device
+ * state machines can share one core without busy waiting.
+ *
+ * All queues are fixed arrays sized for FramePool::BLOCK_COUNT coroutines; nothing
+ * is allocated after construction. spawn(), runOnce() and run() must be called
+ * from one thread; stop() may be called from anywhere.
+ *
+ * Pin edges and poll_until() conditions are checked at least every
+ * setPinPollInterval_us() while a task waits on one, so pulses shorter than
+ * the interval may be missed.
+ */
+class Executor {
+public:
+    static constexpr size_t CAPACITY = FramePool::BLOCK_COUNT;
+
+    Executor();
+
+    /**
+     * @brief Destroys the frames of tasks that have not finished.
+     */
+    ~Executor();
+
+    Executor(const Executor&)            = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    /**
+     * @brief Takes ownership of a task and schedules it to start on the next runOnce().
+     * @return status::ok, or status::no_memory if the task is invalid (its frame
+     *         could not be allocated) or the task table is full.
+     */
+    base::status spawn(Task&& task);
+
+    /**
+     * @brief Resumes every task that is due now, without waiting.
+     * @return The number of tasks resumed.
+     */
+    size_t runOnce();
+
+    /**
+     * @brief Runs until every task has finished or stop() is called,
+     *        idling between deadlines.
+     */
+    void run();
+
+    /**
+     * @brief Makes run() return after the tasks being resumed suspend.
+     */
+    void stop() {
+        _stop.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Microseconds until runOnce() has something to resume:
+     *        0 if a task is ready, UINT64_MAX if no task is waiting for anything.
+     */
+    uint64_t getTimeUntilNext_us() const;
+
+    size_t getTaskCount() const {
+        return _task_count;
+    }
+
+    void setPinPollInterval_us(uint32_t us) {
+        _pin_poll_us = us ? us : 1;
+    }
+
+    uint32_t getPinPollInterval_us() const {
+        return _pin_poll_us;
+    }
+
+    /**
+     * @brief Executor whose runOnce() is executing on this thread, or nullptr.
+     */
+    static Executor* current();
+
+    // Used by the awaitables.
+    void schedule(std::coroutine_handle<> handle);
+    void scheduleAt(uint64_t deadline_us, std::coroutine_handle<> handle);
+    void waitEdge(EdgeAwaiter& awaiter);
+    void waitUntil(PollAwaiter& awaiter);
+    void finish(Task::handle_type handle);
+
+private:
+    struct Sleeper {
+        uint64_t deadline_us;
+        uint32_t sequence; // FIFO order among equal deadlines
+        std::coroutine_handle<> handle;
+
+        bool before(const Sleeper& other) const {
+            return deadline_us != other.deadline_us ? deadline_us < other.deadline_us
+                                                    : static_cast<int32_t>(sequence - other.sequence) < 0;
+        }
+    };
+
+    void pushSleeper(const Sleeper& sleeper);
+    Sleeper popSleeper();
+    void pollEdges();
+    void pollConditions();
+    void idle(uint64_t wait_us);
+
+    std::coroutine_handle<> _tasks[CAPACITY];
+    size_t _task_count;
+
+    std::coroutine_handle<> _ready[CAPACITY];
+    size_t _ready_head;
+    size_t _ready_count;
+
+    Sleeper _sleepers[CAPACITY];
+    size_t _sleeper_count;
+    uint32_t _sequence;
+
+    EdgeAwaiter* _edges[CAPACITY];
+    size_t _edge_count;
+    uint32_t _pin_poll_us;
+
+    PollAwaiter* _polls[CAPACITY];
+    size_t _poll_count;
+
+    std::atomic<bool> _stop;
+};
+
+/**
+ * @brief Awaitable returned by yield_now().
+ */
+struct YieldAwaiter {
+    bool await_ready() const noexcept {
+        return false;
+    }
+    void await_suspend(std::coroutine_handle<> handle) const;
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Awaitable returned by sleep_for() / sleep_until().
+ */
+struct SleepAwaiter {
+    uint64_t deadline_us;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+    void await_suspend(std::coroutine_handle<> handle) const;
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Awaitable for `co_await pin.edge(edge)`.
+ *
+ * Resumes with the pin level after the edge, or with the negative error
+ * returned by digitalRead() if the pin cannot be read.
+ */
+struct EdgeAwaiter {
+    hal::gpio::IPin* pin;
+    hal::gpio::PinEdge edge;
+    int last;
+    std::coroutine_handle<> handle;
+
+    bool await_ready() noexcept {
+        last = pin->digitalRead();
+        return last < 0;
+    }
+    void await_suspend(std::coroutine_handle<> awaiting);
+    int await_resume() const noexcept {
+        return last;
+    }
+};
+
+/**
+ * @brief Awaitable returned by poll_until().
+ */
+struct PollAwaiter {
+    bool (*ready)(void* context);
+    void* context;
+    std::coroutine_handle<> handle;
+
+    bool await_ready() const noexcept {
+        return ready(context);
+    }
+    void await_suspend(std::coroutine_handle<> awaiting);
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Lets the other ready tasks run before continuing.
+ */
+inline YieldAwaiter yield_now() {
+    return YieldAwaiter{};
+}
+
+/**
+ * @brief Suspends the calling task for at least us microseconds.
+ */
+SleepAwaiter sleep_for(uint32_t us);
+
+/**
+ * @brief Suspends the calling task until utils::time::micros64() reaches deadline_us.
+ *        Use for periodic work without accumulating drift.
+ */
+inline SleepAwaiter sleep_until(uint64_t deadline_us) {
+    return SleepAwaiter{deadline_us};
+}
+
+/**
+ * @brief Suspends the calling task until ready(context) returns true.
+ *
+ * ready is called from the executor thread, so it can test state completed
+ * by an interrupt, another thread or a driver (an atomic flag, a status).
+ */
+inline PollAwaiter poll_until(bool (*ready)(void* context), void* context) {
+    return PollAwaiter{ready, context, nullptr};
+}
+
+} // namespace task
+} // namespace utils
+
+namespace hal {
+namespace gpio {
+
+// Found by argument-dependent lookup, which makes `co_await pin.edge(...)` work.
+inline utils::task::EdgeAwaiter operator co_await(PinEdgeWait wait) noexcept {
+    return utils::task::EdgeAwaiter{wait.pin, wait.edge, 0, nullptr};
+}
+
+} // namespace gpio
+} // namespace hal
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_TASK_EXECUTOR_IPP
+#define FLEXHAL_INTERNAL_UTILS_TASK_EXECUTOR_IPP
+
+#include <cassert>
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace task {
+
+namespace {
+thread_local Executor* current_executor = nullptr;
+} // namespace
+
+std::coroutine_handle<> Task::FinalAwaiter::await_suspend(handle_type handle) noexcept {
+    promise_type& promise = handle.promise();
+    if (promise.continuation) {
+        return promise.continuation;
+    }
+    if (promise.executor != nullptr) {
+        promise.executor->finish(handle);
+    }
+    return std::noop_coroutine();
+}
+
+Executor::Executor()
+    : _task_count(0),
+      _ready_head(0),
+      _ready_count(0),
+      _sleeper_count(0),
+      _sequence(0),
+      _edge_count(0),
+      _pin_poll_us(100),
+      _poll_count(0),
+      _stop(false)
+{
+}
+
+Executor::~Executor() {
+    // Destroying a top-level frame also destroys the sub-task it is awaiting.
+    for (size_t i = 0; i < CAPACITY; ++i) {
+        if (_tasks[i]) {
+            _tasks[i].destroy();
+        }
+    }
+}
+
+Executor* Executor::current() {
+    return current_executor;
+}
+
+base::status Executor::spawn(Task&& task) {
+    if (!task.valid() || _task_count >= CAPACITY) {
+        return base::status::no_memory;
+    }
+    uint32_t slot = 0;
+    while (_tasks[slot]) {
+        ++slot;
+    }
+    Task::handle_type handle   = task.release();
+    handle.promise().executor = this;
+    handle.promise().slot     = slot;
+    _tasks[slot]              = handle;
+    ++_task_count;
+    schedule(handle);
+    return base::status::ok;
+}
+
+void Executor::finish(Task::handle_type handle) {
+    const uint32_t slot = handle.promise().slot;
+    _tasks[slot]        = nullptr;
+    --_task_count;
+    handle.destroy();
+}
+
+void Executor::schedule(std::coroutine_handle<> handle) {
+    // Every suspended coroutine is in at most one queue, so CAPACITY is never exceeded.
+    assert(_ready_count < CAPACITY);
+    _ready[(_ready_head + _ready_count) % CAPACITY] = handle;
+    ++_ready_count;
+}
+
+void Executor::scheduleAt(uint64_t deadline_us, std::coroutine_handle<> handle) {
+    pushSleeper(Sleeper{deadline_us, _sequence++, handle});
+}
+
+void Executor::waitEdge(EdgeAwaiter& awaiter) {
+    assert(_edge_count < CAPACITY);
+    _edges[_edge_count++] = &awaiter;
+}
+
+void Executor::waitUntil(PollAwaiter& awaiter) {
+    assert(_poll_count < CAPACITY);
+    _polls[_poll_count++] = &awaiter;
+}
+
+void Executor::pushSleeper(const Sleeper& sleeper) {
+    assert(_sleeper_count < CAPACITY);
+    size_t i = _sleeper_count++;
+    while (i > 0) {
+        const size_t parent = (i - 1) / 2;
+        if (!sleeper.before(_sleepers[parent])) break;
+        _sleepers[i] = _sleepers[parent];
+        i            = parent;
+    }
+    _sleepers[i] = sleeper;
+}
+
+Executor::Sleeper Executor::popSleeper() {
+    const Sleeper top  = _sleepers[0];
+    const Sleeper last = _sleepers[--_sleeper_count];
+    size_t i           = 0;
+    for (;;) {
+        size_t child = i * 2 + 1;
+        if (child >= _sleeper_count) break;
+        if (child + 1 < _sleeper_count && _sleepers[child + 1].before(_sleepers[child])) {
+            ++child;
+        }
+        if (!_sleepers[child].before(last)) break;
+        _sleepers[i] = _sleepers[child];
+        i            = child;
+    }
+    _sleepers[i] = last;
+    return top;
+}
+
+void Executor::pollEdges() {
+    using hal::gpio::PinEdge;
+    size_t i = 0;
+    while (i < _edge_count) {
+        EdgeAwaiter& awaiter = *_edges[i];
+        const int level      = awaiter.pin->digitalRead();
+        bool fired;
+        if (level < 0) {
+            fired = true;
+        } else if (awaiter.edge == PinEdge::Rising) {
+            fired = awaiter.last == 0 && level != 0;
+        } else if (awaiter.edge == PinEdge::Falling) {
+            fired = awaiter.last != 0 && level == 0;
+        } else {
+            fired = awaiter.last != level;
+        }
+        awaiter.last = level;
+        if (fired) {
+            schedule(awaiter.handle);
+            _edges[i] = _edges[--_edge_count];
+        } else {
+            ++i;
+        }
+    }
+}
+
+void Executor::pollConditions() {
+    size_t i = 0;
+    while (i < _poll_count) {
+        PollAwaiter& awaiter = *_polls[i];
+        if (awaiter.ready(awaiter.context)) {
+            schedule(awaiter.handle);
+            _polls[i] = _polls[--_poll_count];
+        } else {
+            ++i;
+        }
+    }
+}
+
+size_t Executor::runOnce() {
+    Executor* previous = current_executor;
+    current_executor   = this;
+
+    if (_sleeper_count > 0) {
+        const uint64_t now = flexhal::utils::time::micros64();
+        while (_sleeper_count > 0 && _sleepers[0].deadline_us <= now) {
+            schedule(popSleeper().handle);
+        }
+    }
+    if (_edge_count > 0) {
+        pollEdges();
+    }
+    if (_poll_count > 0) {
+        pollConditions();
+    }
+
+    // Only the tasks ready now; the ones they make ready run on the next call.
+    const size_t count = _ready_count;
+    for (size_t i = 0; i < count; ++i) {
+        std::coroutine_handle<> handle = _ready[_ready_head];
+        _ready_head                    = (_ready_head + 1) % CAPACITY;
+        --_ready_count;
+        handle.resume();
+    }
+
+    current_executor = previous;
+    return count;
+}
+
+uint64_t Executor::getTimeUntilNext_us() const {
+    if (_ready_count > 0) return 0;
+    uint64_t wait = UINT64_MAX;
+    if (_sleeper_count > 0) {
+        const uint64_t now = flexhal::utils::time::micros64();
+        wait = (_sleepers[0].deadline_us > now) ? _sleepers[0].deadline_us - now : 0;
+    }
+    if ((_edge_count > 0 || _poll_count > 0) && wait > _pin_poll_us) {
+        wait = _pin_poll_us;
+    }
+    return wait;
+}
+
+// Sleeps in whole milliseconds through delay_ms() (which yields the CPU to the
+// OS / RTOS) and leaves the last stretch to delay_us() for an accurate wake-up.
+void Executor::idle(uint64_t wait_us) {
+    if (wait_us >= 2000) {
+        flexhal::utils::time::delay_ms(static_cast<uint32_t>(wait_us / 1000 - 1));
+    } else {
+        flexhal::utils::time::delay_us(static_cast<uint32_t>(wait_us));
+    }
+}
+
+void Executor::run() {
+    _stop.store(false, std::memory_order_relaxed);
+    while (_task_count > 0 && !_stop.load(std::memory_order_relaxed)) {
+        if (runOnce() > 0) continue;
+        const uint64_t wait = getTimeUntilNext_us();
+        if (wait == UINT64_MAX) break; // nothing left that could resume a task
+        if (wait > 0) idle(wait);
+    }
+}
+
+void YieldAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+    Executor* executor = Executor::current();
+    assert(executor != nullptr);
+    executor->schedule(handle);
+}
+
+void SleepAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+    Executor* executor = Executor::current();
+    assert(executor != nullptr);
+    executor->scheduleAt(deadline_us, handle);
+}
+
+void EdgeAwaiter::await_suspend(std::coroutine_handle<> awaiting) {
+    Executor* executor = Executor::current();
+    assert(executor != nullptr);
+    handle = awaiting;
+    executor->waitEdge(*this);
+}
+
+void PollAwaiter::await_suspend(std::coroutine_handle<> awaiting) {
+    Executor* executor = Executor::current();
+    assert(executor != nullptr);
+    handle = awaiting;
+    executor->waitUntil(*this);
+}
+
+SleepAwaiter sleep_for(uint32_t us) {
+    return SleepAwaiter{flexhal::utils::time::micros64() + us};
+}
+
+} // namespace task
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_TASK_EXECUTOR_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
+
+#endif // FLEXHAL_INTERNAL_TASK
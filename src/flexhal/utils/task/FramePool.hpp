@@ -0,0 +1,172 @@
+#pragma once
+
+#include "flexhal/base/cpp.hpp"
+
+#if defined(FLEXHAL_INTERNAL_CPP20) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define FLEXHAL_INTERNAL_TASK 1
+#endif
+#endif
+
+#if FLEXHAL_INTERNAL_TASK
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Size in bytes of one coroutine frame block. A coroutine whose frame
+ *        is larger cannot be started (its Task is invalid).
+ */
+#ifndef FLEXHAL_TASK_FRAME_SIZE
+#define FLEXHAL_TASK_FRAME_SIZE 512
+#endif
+
+/**
+ * @brief Number of coroutine frames that can exist at the same time
+ *        (spawned tasks plus the sub-tasks they are awaiting).
+ */
+#ifndef FLEXHAL_TASK_FRAME_COUNT
+#define FLEXHAL_TASK_FRAME_COUNT 16
+#endif
+
+namespace flexhal {
+namespace utils {
+namespace task {
+
+/**
+ * @brief Fixed pool of equally sized blocks that backs every Task frame.
+ *
+ * The storage is static, so starting a coroutine never touches the heap; when
+ * the pool is exhausted or a frame does not fit in a block, the coroutine is
+ * not created and its Task is invalid. allocate()/release() may be called
+ * from any thread.
+ */
+class FramePool {
+public:
+    static constexpr size_t BLOCK_SIZE =
+        (FLEXHAL_TASK_FRAME_SIZE + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+    static constexpr size_t BLOCK_COUNT = FLEXHAL_TASK_FRAME_COUNT;
+
+    static FramePool& instance();
+
+    FramePool(const FramePool&)            = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    /**
+     * @return A block of BLOCK_SIZE bytes, or nullptr if size does not fit or no block is free.
+     */
+    void* allocate(size_t size);
+
+    void release(void* block);
+
+    size_t getFreeCount() const;
+
+    size_t getCapacity() const {
+        return BLOCK_COUNT;
+    }
+
+    /**
+     * @brief Number of allocations that failed since startup (pool exhausted or frame too large).
+     */
+    uint32_t getFailedCount() const {
+        return _failed.load(std::memory_order_relaxed);
+    }
+
+private:
+    FramePool();
+
+    void lock() const;
+    void unlock() const;
+
+    union Block {
+        Block* next;
+        alignas(std::max_align_t) unsigned char bytes[BLOCK_SIZE];
+    };
+
+    Block _blocks[BLOCK_COUNT];
+    Block* _free;
+    size_t _free_count;
+    std::atomic<uint32_t> _failed;
+    mutable std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+};
+
+} // namespace task
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_TASK_FRAMEPOOL_IPP
+#define FLEXHAL_INTERNAL_UTILS_TASK_FRAMEPOOL_IPP
+
+namespace flexhal {
+namespace utils {
+namespace task {
+
+FramePool& FramePool::instance() {
+    // Function-local so that coroutines started from static constructors find it initialized.
+    static FramePool pool;
+    return pool;
+}
+
+FramePool::FramePool() : _free(nullptr), _free_count(BLOCK_COUNT), _failed(0)
+{
+    for (size_t i = BLOCK_COUNT; i > 0; --i) {
+        _blocks[i - 1].next = _free;
+        _free               = &_blocks[i - 1];
+    }
+}
+
+void FramePool::lock() const {
+    while (_lock.test_and_set(std::memory_order_acquire)) {
+    }
+}
+
+void FramePool::unlock() const {
+    _lock.clear(std::memory_order_release);
+}
+
+void* FramePool::allocate(size_t size) {
+    Block* block = nullptr;
+    if (size <= BLOCK_SIZE) {
+        lock();
+        block = _free;
+        if (block != nullptr) {
+            _free = block->next;
+            --_free_count;
+        }
+        unlock();
+    }
+    if (block == nullptr) {
+        _failed.fetch_add(1, std::memory_order_relaxed);
+    }
+    return block;
+}
+
+void FramePool::release(void* p) {
+    if (p == nullptr) return;
+    Block* block = static_cast<Block*>(p);
+    lock();
+    block->next = _free;
+    _free       = block;
+    ++_free_count;
+    unlock();
+}
+
+size_t FramePool::getFreeCount() const {
+    lock();
+    const size_t count = _free_count;
+    unlock();
+    return count;
+}
+
+} // namespace task
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_TASK_FRAMEPOOL_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
+
+#endif // FLEXHAL_INTERNAL_TASK
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "FramePool.hpp"
+
+#if FLEXHAL_INTERNAL_TASK
+
+#include <coroutine>
+#include <exception>
+
+#include "flexhal/base/status.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace task {
+
+class Executor;
+
+/**
+ * @brief Coroutine type for cooperative tasks run by an Executor.
+ *
+ * A function returning Task and using co_await becomes a coroutine whose
+ * frame comes from the FramePool. It starts suspended: hand it to
+ * Executor::spawn(), or `co_await` it from another Task to run it as a
+ * sub-routine (the awaiting task resumes when it returns, and the
+ * co_await yields status::ok, or status::no_memory if the sub-task could
+ * not be created).
+ *
+ * A Task that failed to allocate its frame is invalid (valid() == false).
+ */
+class Task {
+public:
+    struct promise_type;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+        std::coroutine_handle<> await_suspend(handle_type handle) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type {
+        std::coroutine_handle<> continuation; ///< Task awaiting this one, if any.
+        Executor* executor = nullptr;         ///< Set when spawned as a top-level task.
+        uint32_t slot      = 0;               ///< Index in the executor's task table.
+
+        static void* operator new(size_t size) noexcept {
+            return FramePool::instance().allocate(size);
+        }
+        static void operator delete(void* frame) noexcept {
+            FramePool::instance().release(frame);
+        }
+        static Task get_return_object_on_allocation_failure() noexcept {
+            return Task();
+        }
+
+        Task get_return_object() noexcept {
+            return Task(handle_type::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+        FinalAwaiter final_suspend() const noexcept {
+            return {};
+        }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+    };
+
+    struct Awaiter {
+        handle_type handle;
+
+        bool await_ready() const noexcept {
+            return !handle || handle.done();
+        }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+        base::status await_resume() const noexcept {
+            return handle ? base::status::ok : base::status::no_memory;
+        }
+    };
+
+    Task() = default;
+    explicit Task(handle_type handle) : _handle(handle) {}
+    ~Task() {
+        if (_handle) _handle.destroy();
+    }
+
+    Task(Task&& other) noexcept : _handle(other._handle) {
+        other._handle = nullptr;
+    }
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (_handle) _handle.destroy();
+            _handle       = other._handle;
+            other._handle = nullptr;
+        }
+        return *this;
+    }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    bool valid() const {
+        return static_cast<bool>(_handle);
+    }
+
+    bool done() const {
+        return !_handle || _handle.done();
+    }
+
+    /**
+     * @brief Gives up ownership of the frame (used by Executor::spawn()).
+     */
+    handle_type release() {
+        handle_type handle = _handle;
+        _handle            = nullptr;
+        return handle;
+    }
+
+    Awaiter operator co_await() && noexcept {
+        return Awaiter{_handle};
+    }
+
+private:
+    handle_type _handle;
+};
+
+} // namespace task
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_TASK
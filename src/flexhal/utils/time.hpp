@@ -3,7 +3,7 @@
 #include "flexhal/base/status.hpp"
 
 #ifndef FLEXHAL_INTERNAL_FLEXHAL_UTILS_TIME
-#include "../../../FlexHAL.hpp"
+#include "../../FlexHAL.hpp"
 #endif
 
 #ifdef FLEXHAL_INTERNAL_FLEXHAL_UTILS_TIME
@@ -0,0 +1,7 @@
+#pragma once
+
+// Software timers driven by utils::time.
+// TimerWheel is polled from the application loop (e.g., Arduino loop());
+// TimerThread drives a wheel from a dedicated thread where <thread> is available.
+#include "timer/TimerWheel.hpp"
+#include "timer/TimerThread.hpp"
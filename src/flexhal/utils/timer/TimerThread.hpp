@@ -0,0 +1,143 @@
+#pragma once
+
+#include "TimerWheel.hpp"
+
+#if defined(__has_include)
+#if __has_include(<thread>)
+#define FLEXHAL_INTERNAL_TIMER_THREAD 1
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+#endif
+
+#if FLEXHAL_INTERNAL_TIMER_THREAD
+
+namespace flexhal {
+namespace utils {
+namespace timer {
+
+/**
+ * @brief Drives a TimerWheel from a dedicated thread.
+ *
+ * The thread polls the wheel and sleeps until the next occupied slot, or
+ * indefinitely while no timer is active. Starting a timer wakes it (through
+ * TimerWheel::setWakeCallback()) so that it recomputes the deadline; an idle
+ * thread does not wake up every tick. Callbacks run on this thread.
+ *
+ * The wheel's wake callback belongs to the thread while it runs.
+ */
+class TimerThread {
+public:
+    explicit TimerThread(TimerWheel& wheel);
+    ~TimerThread();
+
+    TimerThread(const TimerThread&)            = delete;
+    TimerThread& operator=(const TimerThread&) = delete;
+
+    /**
+     * @brief Starts the thread.
+     * @return status::ok, or status::busy if it is already running.
+     */
+    base::status start();
+
+    /**
+     * @brief Stops the thread and waits for it to exit.
+     */
+    void stop();
+
+    bool isRunning() const {
+        return _running.load(std::memory_order_relaxed);
+    }
+
+private:
+    static void wake(void* context);
+    void run();
+
+    TimerWheel& _wheel;
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    bool _woken; // A timer was added since the last deadline was computed
+};
+
+} // namespace timer
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_TIMER_TIMERTHREAD_IPP
+#define FLEXHAL_INTERNAL_UTILS_TIMER_TIMERTHREAD_IPP
+
+#include <chrono>
+
+namespace flexhal {
+namespace utils {
+namespace timer {
+
+TimerThread::TimerThread(TimerWheel& wheel) : _wheel(wheel), _running(false), _woken(false)
+{
+}
+
+TimerThread::~TimerThread() {
+    stop();
+}
+
+base::status TimerThread::start() {
+    bool expected = false;
+    if (!_running.compare_exchange_strong(expected, true)) {
+        return base::status::busy;
+    }
+    _wheel.setWakeCallback(wake, this);
+    _thread = std::thread([this]() { run(); });
+    return base::status::ok;
+}
+
+void TimerThread::stop() {
+    if (_running.exchange(false) && _thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex); // Not between the thread's check and its wait
+        }
+        _wake.notify_one();
+        _thread.join();
+        _wheel.setWakeCallback(nullptr);
+    }
+}
+
+void TimerThread::wake(void* context) {
+    TimerThread* self = static_cast<TimerThread*>(context);
+    {
+        std::lock_guard<std::mutex> lock(self->_mutex);
+        self->_woken = true;
+    }
+    self->_wake.notify_one();
+}
+
+void TimerThread::run() {
+    const auto woken = [this] { return _woken || !_running.load(std::memory_order_acquire); };
+    while (_running.load(std::memory_order_acquire)) {
+        _wheel.poll();
+        const uint64_t sleep_us = _wheel.getTimeUntilNext_us();
+        // A timer added after this point sets _woken under the mutex, so it is not missed
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (sleep_us == UINT64_MAX) {
+            _wake.wait(lock, woken);
+        } else if (sleep_us > 0) {
+            _wake.wait_for(lock, std::chrono::microseconds(sleep_us), woken);
+        }
+        _woken = false;
+    }
+}
+
+} // namespace timer
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_TIMER_TIMERTHREAD_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
+
+#endif // FLEXHAL_INTERNAL_TIMER_THREAD
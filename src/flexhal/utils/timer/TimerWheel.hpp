@@ -0,0 +1,451 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "flexhal/base/status.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace timer {
+
+/**
+ * @brief Handle of a timer started on a TimerWheel.
+ *
+ * The generation makes stale handles harmless: once a timer has fired (one-shot)
+ * or been cancelled, its handle no longer refers to the reused node.
+ */
+struct TimerId {
+    uint32_t index      = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool valid() const {
+        return index != UINT32_MAX;
+    }
+};
+
+/**
+ * @brief Hierarchical timing wheel with a fixed pool of timer nodes.
+ *
+ * Time is counted in ticks of tick_us microseconds. Four levels of 64 slots
+ * cover 2^24 ticks directly (about 4.6 hours at 1 ms); longer timers are
+ * parked in the outermost level and re-cascaded. Each slot is an intrusive
+ * doubly linked list and each level keeps a 64-bit occupancy bitmap, so
+ * start() and cancel() are O(1) and advancing skips empty slots.
+ *
+ * All nodes are allocated by the constructor; start() fails (returns an
+ * invalid TimerId) when the pool is exhausted instead of allocating.
+ *
+ * Callbacks run from poll() / advance() on the calling thread, outside the
+ * wheel's internal lock, so they may start or cancel timers (including their own).
+ * start()/cancel() may be called from any thread; poll()/advance() from one
+ * thread at a time (the application loop, or a TimerThread).
+ */
+class TimerWheel {
+public:
+    using Callback = void (*)(void* context);
+
+    /**
+     * @brief Called by start()/startPeriodic() after adding a timer, with the
+     *        wheel's internal lock held; it must only signal a driver.
+     */
+    using WakeCallback = void (*)(void* context);
+
+    static constexpr uint32_t LEVELS     = 4;
+    static constexpr uint32_t SLOT_BITS  = 6;
+    static constexpr uint32_t SLOTS      = 1u << SLOT_BITS;
+
+    /**
+     * @brief Creates a wheel whose tick 0 is the current utils::time::micros64().
+     * @param capacity Maximum number of simultaneously active timers.
+     * @param tick_us Tick length in microseconds (timer resolution).
+     */
+    explicit TimerWheel(uint32_t capacity, uint32_t tick_us = 1000);
+
+    TimerWheel(const TimerWheel&)            = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Starts a one-shot timer.
+     * @param delay_us Delay, rounded up to whole ticks (at least one tick).
+     * @return Handle, or an invalid TimerId if no node is free.
+     */
+    TimerId start(uint32_t delay_us, Callback callback, void* context = nullptr);
+
+    /**
+     * @brief Starts a periodic timer. The first expiry is one period from now.
+     * @return Handle, or an invalid TimerId if no node is free.
+     */
+    TimerId startPeriodic(uint32_t period_us, Callback callback, void* context = nullptr);
+
+    /**
+     * @brief Stops a timer.
+     * @return status::ok, or status::not_found if it already fired or was cancelled.
+     */
+    base::status cancel(TimerId id);
+
+    /**
+     * @brief True while the timer is pending.
+     */
+    bool isActive(TimerId id) const;
+
+    /**
+     * @brief Advances to the current utils::time::micros64() and runs due callbacks.
+     * @return Number of callbacks run.
+     */
+    size_t poll();
+
+    /**
+     * @brief Advances the wheel by the given number of ticks and runs due callbacks.
+     * @return Number of callbacks run.
+     */
+    size_t advance(uint64_t ticks);
+
+    /**
+     * @brief Sets the function that tells a sleeping driver a timer was added,
+     *        so it can recompute getTimeUntilNext_us(). Pass nullptr to clear.
+     */
+    void setWakeCallback(WakeCallback wake, void* context = nullptr);
+
+    /**
+     * @brief Microseconds until the earliest slot that may hold a due timer.
+     *
+     * A lower bound, exact for timers within 64 ticks; sleeping this long
+     * never oversleeps a timer. Returns UINT64_MAX when no timer is active.
+     */
+    uint64_t getTimeUntilNext_us() const;
+
+    uint64_t getCurrentTick() const {
+        return _now;
+    }
+
+    uint32_t getTick_us() const {
+        return _tick_us;
+    }
+
+    size_t getActiveCount() const {
+        return _active;
+    }
+
+    size_t getCapacity() const {
+        return _capacity;
+    }
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    struct Node {
+        uint64_t expires;   // Absolute tick
+        uint32_t period;    // Ticks, 0 = one-shot
+        uint32_t generation;
+        Callback callback;
+        void* context;
+        uint32_t prev;
+        uint32_t next;
+        uint8_t level;      // Level / slot currently linked into (valid while active)
+        uint8_t slot;
+        bool active;
+    };
+
+    void lock() const;
+    void unlock() const;
+    TimerId add(uint32_t delay_ticks, uint32_t period_ticks, Callback callback, void* context);
+    void link(uint32_t index);
+    void unlink(uint32_t index);
+    void release(uint32_t index);
+    void cascade(uint32_t level);
+    size_t runSlot(uint32_t slot);
+    uint32_t toTicks(uint32_t us) const;
+
+    std::unique_ptr<Node[]> _nodes;
+    uint32_t _capacity;
+    uint32_t _tick_us;
+    uint64_t _origin_us;
+    uint64_t _now;
+    uint32_t _free;
+    size_t _active;
+    uint32_t _heads[LEVELS][SLOTS];
+    uint64_t _occupied[LEVELS];
+    WakeCallback _wake;
+    void* _wake_context;
+    mutable std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+};
+
+} // namespace timer
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_TIMER_TIMERWHEEL_IPP
+#define FLEXHAL_INTERNAL_UTILS_TIMER_TIMERWHEEL_IPP
+
+#include "flexhal/utils/time.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace timer {
+
+TimerWheel::TimerWheel(uint32_t capacity, uint32_t tick_us)
+    : _nodes(new Node[capacity ? capacity : 1]),
+      _capacity(capacity ? capacity : 1),
+      _tick_us(tick_us ? tick_us : 1),
+      _origin_us(flexhal::utils::time::micros64()),
+      _now(0),
+      _free(0),
+      _active(0),
+      _wake(nullptr),
+      _wake_context(nullptr)
+{
+    for (uint32_t i = 0; i < _capacity; ++i) {
+        _nodes[i].generation = 0;
+        _nodes[i].active     = false;
+        _nodes[i].next       = (i + 1 < _capacity) ? i + 1 : NIL;
+    }
+    for (uint32_t level = 0; level < LEVELS; ++level) {
+        for (uint32_t slot = 0; slot < SLOTS; ++slot) {
+            _heads[level][slot] = NIL;
+        }
+        _occupied[level] = 0;
+    }
+}
+
+void TimerWheel::lock() const {
+    while (_lock.test_and_set(std::memory_order_acquire)) {
+    }
+}
+
+void TimerWheel::unlock() const {
+    _lock.clear(std::memory_order_release);
+}
+
+uint32_t TimerWheel::toTicks(uint32_t us) const {
+    const uint64_t ticks = (static_cast<uint64_t>(us) + _tick_us - 1) / _tick_us;
+    return ticks ? static_cast<uint32_t>(ticks) : 1;
+}
+
+// Chooses the level from the distance to expiry and links the node into the
+// slot indexed by the matching bits of the absolute expiry tick.
+void TimerWheel::link(uint32_t index) {
+    Node& node      = _nodes[index];
+    uint64_t delta  = node.expires - _now;
+    uint64_t target = node.expires;
+    uint32_t level  = 0;
+    while (level < LEVELS - 1 && delta >= (1ull << (SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+    if (delta >= (1ull << (SLOT_BITS * LEVELS))) {
+        // Beyond the wheel's range: park in the farthest slot and re-cascade later.
+        target = _now + (1ull << (SLOT_BITS * LEVELS)) - 1;
+    }
+    const uint32_t slot = static_cast<uint32_t>(target >> (SLOT_BITS * level)) & (SLOTS - 1);
+
+    node.level = static_cast<uint8_t>(level);
+    node.slot  = static_cast<uint8_t>(slot);
+    node.prev  = NIL;
+    node.next  = _heads[level][slot];
+    if (node.next != NIL) {
+        _nodes[node.next].prev = index;
+    }
+    _heads[level][slot] = index;
+    _occupied[level] |= (1ull << slot);
+}
+
+void TimerWheel::unlink(uint32_t index) {
+    Node& node = _nodes[index];
+    if (node.prev != NIL) {
+        _nodes[node.prev].next = node.next;
+    } else {
+        _heads[node.level][node.slot] = node.next;
+        if (node.next == NIL) {
+            _occupied[node.level] &= ~(1ull << node.slot);
+        }
+    }
+    if (node.next != NIL) {
+        _nodes[node.next].prev = node.prev;
+    }
+}
+
+void TimerWheel::release(uint32_t index) {
+    Node& node  = _nodes[index];
+    node.active = false;
+    ++node.generation;
+    node.next = _free;
+    _free     = index;
+    --_active;
+}
+
+TimerId TimerWheel::add(uint32_t delay_ticks, uint32_t period_ticks, Callback callback, void* context) {
+    TimerId id;
+    if (callback == nullptr) return id;
+    lock();
+    if (_free == NIL) {
+        unlock();
+        return id;
+    }
+    const uint32_t index = _free;
+    Node& node           = _nodes[index];
+    _free                = node.next;
+    node.expires         = _now + delay_ticks;
+    node.period          = period_ticks;
+    node.callback        = callback;
+    node.context         = context;
+    node.active          = true;
+    link(index);
+    ++_active;
+    id.index      = index;
+    id.generation = node.generation;
+    if (_wake != nullptr) {
+        _wake(_wake_context); // Under the lock, so a driver cannot be torn down in between
+    }
+    unlock();
+    return id;
+}
+
+void TimerWheel::setWakeCallback(WakeCallback wake, void* context) {
+    lock();
+    _wake         = wake;
+    _wake_context = context;
+    unlock();
+}
+
+TimerId TimerWheel::start(uint32_t delay_us, Callback callback, void* context) {
+    return add(toTicks(delay_us), 0, callback, context);
+}
+
+TimerId TimerWheel::startPeriodic(uint32_t period_us, Callback callback, void* context) {
+    const uint32_t period = toTicks(period_us);
+    return add(period, period, callback, context);
+}
+
+base::status TimerWheel::cancel(TimerId id) {
+    if (!id.valid() || id.index >= _capacity) return base::status::param;
+    lock();
+    Node& node = _nodes[id.index];
+    if (!node.active || node.generation != id.generation) {
+        unlock();
+        return base::status::not_found;
+    }
+    unlink(id.index);
+    release(id.index);
+    unlock();
+    return base::status::ok;
+}
+
+bool TimerWheel::isActive(TimerId id) const {
+    if (!id.valid() || id.index >= _capacity) return false;
+    lock();
+    const bool active = _nodes[id.index].active && _nodes[id.index].generation == id.generation;
+    unlock();
+    return active;
+}
+
+// Moves every node of the current slot of `level` down to the levels below.
+void TimerWheel::cascade(uint32_t level) {
+    const uint32_t slot = static_cast<uint32_t>(_now >> (SLOT_BITS * level)) & (SLOTS - 1);
+    uint32_t index      = _heads[level][slot];
+    _heads[level][slot] = NIL;
+    _occupied[level] &= ~(1ull << slot);
+    while (index != NIL) {
+        const uint32_t next = _nodes[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+// Runs the level-0 slot for the current tick. Caller holds the lock; it is
+// released around each callback.
+size_t TimerWheel::runSlot(uint32_t slot) {
+    size_t fired = 0;
+    while (_heads[0][slot] != NIL) {
+        const uint32_t index = _heads[0][slot];
+        Node& node           = _nodes[index];
+        unlink(index);
+        // Level-0 slots only ever hold nodes expiring on this exact tick.
+        const Callback callback = node.callback;
+        void* const context     = node.context;
+        if (node.period != 0) {
+            node.expires += node.period;
+            if (node.expires <= _now) node.expires = _now + 1; // Fell behind: skip missed periods
+            link(index);
+        } else {
+            release(index);
+        }
+        unlock();
+        callback(context);
+        ++fired;
+        lock();
+    }
+    return fired;
+}
+
+size_t TimerWheel::advance(uint64_t ticks) {
+    size_t fired = 0;
+    lock();
+    const uint64_t target = _now + ticks;
+    while (_now < target) {
+        // Jump straight to the next tick that has work: an occupied level-0
+        // slot or a cascade boundary.
+        const uint32_t index = static_cast<uint32_t>(_now) & (SLOTS - 1);
+        uint64_t step        = SLOTS - index; // Distance to the next boundary
+        const uint64_t ahead = (index == SLOTS - 1) ? 0 : (_occupied[0] >> (index + 1)) << (index + 1);
+        if (ahead != 0) {
+            const uint64_t to_slot = static_cast<uint64_t>(__builtin_ctzll(ahead)) - index;
+            if (to_slot < step) step = to_slot;
+        }
+        if (step > target - _now) step = target - _now;
+        _now += step;
+
+        const uint32_t slot = static_cast<uint32_t>(_now) & (SLOTS - 1);
+        if (slot == 0) {
+            for (uint32_t level = 1; level < LEVELS; ++level) {
+                cascade(level);
+                if (((_now >> (SLOT_BITS * level)) & (SLOTS - 1)) != 0) break;
+            }
+        }
+        fired += runSlot(slot);
+    }
+    unlock();
+    return fired;
+}
+
+size_t TimerWheel::poll() {
+    const uint64_t elapsed = (flexhal::utils::time::micros64() - _origin_us) / _tick_us;
+    return (elapsed > _now) ? advance(elapsed - _now) : 0;
+}
+
+uint64_t TimerWheel::getTimeUntilNext_us() const {
+    lock();
+    if (_active == 0) {
+        unlock();
+        return UINT64_MAX;
+    }
+    uint64_t ticks = UINT64_MAX;
+    for (uint32_t level = 0; level < LEVELS && ticks == UINT64_MAX; ++level) {
+        if (_occupied[level] == 0) continue;
+        const uint32_t shift   = SLOT_BITS * level;
+        const uint32_t current = static_cast<uint32_t>(_now >> shift) & (SLOTS - 1);
+        // Rotate so that bit 0 is the slot after the current one.
+        const uint32_t rot     = (current + 1) & (SLOTS - 1);
+        const uint64_t rotated = (_occupied[level] >> rot) | (rot ? (_occupied[level] << (SLOTS - rot)) : 0);
+        const uint64_t slots   = static_cast<uint64_t>(__builtin_ctzll(rotated)) + 1;
+        // Start of that slot's span, relative to now.
+        const uint64_t span    = 1ull << shift;
+        const uint64_t start   = ((_now >> shift) + slots) << shift;
+        ticks                  = (level == 0) ? slots : (start > _now ? start - _now : span);
+    }
+    unlock();
+    const uint64_t next_tick_us = (_now + ticks) * _tick_us + _origin_us;
+    const uint64_t now_us       = flexhal::utils::time::micros64();
+    return (next_tick_us > now_us) ? next_tick_us - now_us : 0;
+}
+
+} // namespace timer
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_TIMER_TIMERWHEEL_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
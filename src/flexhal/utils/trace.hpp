@@ -0,0 +1,8 @@
+#pragma once
+
+// Hot-path tracing.
+// FLEXHAL_TRACE_SCOPE("gpio.write") times the enclosing block with
+// utils::time::cycles(): per-site count/min/max/mean plus a per-thread
+// (per-core on ESP-IDF) event buffer, readable as stats, log lines or Chrome
+// trace JSON. Call sites compile to nothing unless FLEXHAL_TRACE is 1.
+#include "trace/Tracer.hpp"
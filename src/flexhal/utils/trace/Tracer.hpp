@@ -0,0 +1,494 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "flexhal/base/status.hpp"
+#include "flexhal/utils/time.hpp"
+
+// ESP-IDF (including Arduino-ESP32): one event buffer per core, appended to inside a
+// FreeRTOS critical section, so scopes may also run in ISRs and in tasks that migrate.
+#if defined(ESP_PLATFORM) && defined(__has_include)
+#if __has_include(<freertos/FreeRTOS.h>)
+#include <freertos/FreeRTOS.h>
+#define FLEXHAL_INTERNAL_TRACE_PER_CORE 1
+#endif
+#endif
+#ifndef FLEXHAL_INTERNAL_TRACE_PER_CORE
+#define FLEXHAL_INTERNAL_TRACE_PER_CORE 0
+#endif
+
+/**
+ * @brief Set to 1 (e.g., `-DFLEXHAL_TRACE=1` in build_flags, so that the
+ *        library sees it too) to compile FLEXHAL_TRACE_SCOPE call sites in.
+ *        With 0 they expand to nothing.
+ */
+#ifndef FLEXHAL_TRACE
+#define FLEXHAL_TRACE 0
+#endif
+
+/**
+ * @brief Number of event buffers. On ESP-IDF there is one per core. Elsewhere
+ *        a thread owns a buffer from its first traced scope until it exits,
+ *        after which the next thread reuses it; while all buffers are owned,
+ *        other threads still update the per-site counters but their events
+ *        are dropped.
+ */
+#ifndef FLEXHAL_TRACE_BUFFERS
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+#define FLEXHAL_TRACE_BUFFERS 8
+#elif FLEXHAL_INTERNAL_TRACE_PER_CORE
+#define FLEXHAL_TRACE_BUFFERS portNUM_PROCESSORS
+#else
+#define FLEXHAL_TRACE_BUFFERS 2
+#endif
+#endif
+
+/**
+ * @brief Events kept per buffer (a power of two); older events are overwritten.
+ */
+#ifndef FLEXHAL_TRACE_EVENTS
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+#define FLEXHAL_TRACE_EVENTS 1024
+#else
+#define FLEXHAL_TRACE_EVENTS 64
+#endif
+#endif
+
+namespace flexhal {
+namespace utils {
+namespace trace {
+
+/**
+ * @brief Aggregated timing of one call site.
+ */
+struct SiteStats {
+    const char* name;
+    uint32_t count;
+    uint64_t total_ns;
+    uint32_t min_ns;
+    uint32_t max_ns;
+    uint32_t mean_ns;
+};
+
+/**
+ * @brief One traced scope, as exported from the event buffers.
+ */
+struct TraceEvent {
+    const char* name;
+    uint64_t start_ns;    ///< utils::time::ticks() at entry, converted to nanoseconds.
+    uint32_t duration_ns;
+    uint32_t thread;      ///< Index of the buffer: the core on ESP-IDF, else the owning thread.
+};
+
+/**
+ * @brief Counters of one FLEXHAL_TRACE_SCOPE call site.
+ *
+ * Constant-initialized, so a function-local static costs no guard; it joins
+ * the global site list the first time it records.
+ */
+class TraceSite {
+public:
+    constexpr explicit TraceSite(const char* name)
+        : _name(name), _count(0), _total(0), _min(UINT32_MAX), _max(0), _next(nullptr), _registered(false)
+    {
+    }
+
+    TraceSite(const TraceSite&)            = delete;
+    TraceSite& operator=(const TraceSite&) = delete;
+
+    const char* getName() const {
+        return _name;
+    }
+
+    /**
+     * @brief Adds one execution that started at start_ticks (utils::time::ticks())
+     *        and lasted cycles (a utils::time::cycles() difference).
+     */
+    void record(uint64_t start_ticks, uint32_t cycles);
+
+    SiteStats getStats() const;
+
+private:
+    friend size_t get_site_count();
+    friend bool get_site_stats(size_t index, SiteStats& stats);
+    friend void reset();
+
+    void add(uint32_t cycles);
+
+    const char* _name;
+    std::atomic<uint32_t> _count;
+    std::atomic<uint64_t> _total; // In cycles
+    std::atomic<uint32_t> _min;
+    std::atomic<uint32_t> _max;
+    TraceSite* _next;
+    std::atomic<bool> _registered;
+};
+
+/**
+ * @brief Times its own lifetime into a TraceSite.
+ *
+ * The duration is measured with utils::time::cycles() (the CPU cycle counter
+ * on ESP32, where ticks() only has microsecond resolution), so scopes of a
+ * few hundred nanoseconds are still resolved; ticks() only timestamps the
+ * event. Scopes longer than the cycle counter's wrap-around period are not
+ * measured correctly.
+ *
+ * On ESP-IDF a scope may run in an ISR. On other targets the event goes to
+ * the current thread's buffer, so do not trace from interrupt or signal
+ * handlers there.
+ */
+class TraceScope {
+public:
+    explicit TraceScope(TraceSite& site)
+        : _site(site), _start(utils::time::ticks()), _start_cycles(utils::time::cycles())
+    {
+    }
+
+    ~TraceScope() {
+        _site.record(_start, utils::time::cycles() - _start_cycles);
+    }
+
+    TraceScope(const TraceScope&)            = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceSite& _site;
+    uint64_t _start;
+    uint32_t _start_cycles;
+};
+
+#define FLEXHAL_INTERNAL_TRACE_CONCAT2(a, b) a##b
+#define FLEXHAL_INTERNAL_TRACE_CONCAT(a, b) FLEXHAL_INTERNAL_TRACE_CONCAT2(a, b)
+
+/**
+ * @brief Times the enclosing block under name (a string literal such as "gpio.write").
+ */
+#if FLEXHAL_TRACE
+#define FLEXHAL_TRACE_SCOPE(name)                                                                             \
+    static ::flexhal::utils::trace::TraceSite FLEXHAL_INTERNAL_TRACE_CONCAT(flexhal_trace_site_, __LINE__)( \
+        name);                                                                                                \
+    ::flexhal::utils::trace::TraceScope FLEXHAL_INTERNAL_TRACE_CONCAT(flexhal_trace_scope_, __LINE__)(      \
+        FLEXHAL_INTERNAL_TRACE_CONCAT(flexhal_trace_site_, __LINE__))
+#else
+#define FLEXHAL_TRACE_SCOPE(name) ((void)0)
+#endif
+
+/**
+ * @brief Number of sites that have recorded so far.
+ */
+size_t get_site_count();
+
+/**
+ * @brief Stats of the index-th site (most recently registered first).
+ * @return false if index is out of range.
+ */
+bool get_site_stats(size_t index, SiteStats& stats);
+
+/**
+ * @brief Copies the buffered events, oldest first within each buffer.
+ *
+ * Events a thread overwrites while they are being copied are skipped.
+ * @return The number of events written to events.
+ */
+size_t get_events(TraceEvent* events, size_t max_events);
+
+/**
+ * @brief Events lost because every buffer was owned by another live thread
+ *        (always 0 on ESP-IDF).
+ */
+uint32_t get_dropped_count();
+
+/**
+ * @brief Writes one line per site ("name: n=.. min=.. mean=.. max=.. ns")
+ *        through the logger at INFO level with the "TRACE" tag.
+ */
+void log_stats();
+
+using WriteFn = void (*)(const char* data, size_t size, void* context);
+
+/**
+ * @brief Streams the buffered events as Chrome trace JSON (chrome://tracing,
+ *        Perfetto) through write, in chunks.
+ */
+void export_chrome_json(WriteFn write, void* context);
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+/**
+ * @brief Writes export_chrome_json() to a file.
+ * @return status::io if the file cannot be written.
+ */
+base::status save_chrome_json(const char* path);
+#endif
+
+/**
+ * @brief Clears every site's counters and the event buffers. Call it while
+ *        no traced scope is running.
+ */
+void reset();
+
+} // namespace trace
+} // namespace utils
+} // namespace flexhal
+
+
+// --- Implementation Section ---
+#ifdef FLEXHAL_INTERNAL_IMPLEMENTATION
+#ifndef FLEXHAL_INTERNAL_UTILS_TRACE_TRACER_IPP
+#define FLEXHAL_INTERNAL_UTILS_TRACE_TRACER_IPP
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "flexhal/utils/logger.hpp"
+
+namespace flexhal {
+namespace utils {
+namespace trace {
+
+namespace {
+
+static_assert((FLEXHAL_TRACE_EVENTS & (FLEXHAL_TRACE_EVENTS - 1)) == 0, "FLEXHAL_TRACE_EVENTS must be a power of two");
+
+struct Event {
+    const TraceSite* site;
+    uint64_t start;    // In ticks
+    uint32_t duration; // In cycles
+};
+
+// One writer at a time: the owning thread, or on ESP-IDF whoever holds lock.
+// The reader copies without locking and uses head to discard the events
+// overwritten meanwhile (seqlock style).
+struct Buffer {
+    Event events[FLEXHAL_TRACE_EVENTS];
+    std::atomic<uint32_t> head;
+#if FLEXHAL_INTERNAL_TRACE_PER_CORE
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+#else
+    std::atomic<bool> owned;
+#endif
+};
+
+Buffer buffers[FLEXHAL_TRACE_BUFFERS];
+std::atomic<uint32_t> dropped{0};
+std::atomic<TraceSite*> sites{nullptr};
+
+void append(Buffer& buffer, const TraceSite* site, uint64_t start_ticks, uint32_t cycles) {
+    const uint32_t head = buffer.head.load(std::memory_order_relaxed);
+    Event& event        = buffer.events[head & (FLEXHAL_TRACE_EVENTS - 1)];
+    event.site          = site;
+    event.start         = start_ticks;
+    event.duration      = cycles;
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+#if !FLEXHAL_INTERNAL_TRACE_PER_CORE
+// Hands the buffer back when its thread exits. Not usable from interrupt or
+// signal handlers: they would write into the buffer of the thread they
+// interrupted.
+struct BufferOwner {
+    Buffer* buffer = nullptr;
+
+    ~BufferOwner() {
+        if (buffer != nullptr) {
+            buffer->owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local BufferOwner current_owner;
+
+Buffer* claim_buffer() {
+    if (current_owner.buffer == nullptr) {
+        for (Buffer& buffer : buffers) {
+            bool expected = false;
+            if (!buffer.owned.load(std::memory_order_relaxed) &&
+                buffer.owned.compare_exchange_strong(expected, true, std::memory_order_acquire,
+                                                     std::memory_order_relaxed)) {
+                current_owner.buffer = &buffer;
+                break;
+            }
+        }
+    }
+    return current_owner.buffer;
+}
+#endif
+
+uint32_t cycles_to_ns32(uint64_t cycles) {
+    const uint64_t ns = utils::time::cycles_to_ns(cycles);
+    return ns > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(ns);
+}
+
+// Calls visit(event) for each buffered event, oldest first within each
+// buffer, until it returns false.
+template <class Visit>
+void for_each_event(Visit&& visit) {
+    for (uint32_t b = 0; b < FLEXHAL_TRACE_BUFFERS; ++b) {
+        const Buffer& buffer = buffers[b];
+        const uint32_t head  = buffer.head.load(std::memory_order_acquire);
+        for (uint32_t i = head > FLEXHAL_TRACE_EVENTS ? head - FLEXHAL_TRACE_EVENTS : 0; i != head; ++i) {
+            const Event copy = buffer.events[i & (FLEXHAL_TRACE_EVENTS - 1)];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (buffer.head.load(std::memory_order_relaxed) - i > FLEXHAL_TRACE_EVENTS) {
+                continue; // The writer has lapped this slot while we copied it
+            }
+            TraceEvent event;
+            event.name        = copy.site->getName();
+            event.start_ns    = utils::time::ticks_to_ns(copy.start);
+            event.duration_ns = cycles_to_ns32(copy.duration);
+            event.thread      = b;
+            if (!visit(event)) return;
+        }
+    }
+}
+
+} // namespace
+
+void TraceSite::add(uint32_t cycles) {
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _total.fetch_add(cycles, std::memory_order_relaxed);
+    uint32_t current = _min.load(std::memory_order_relaxed);
+    while (cycles < current && !_min.compare_exchange_weak(current, cycles, std::memory_order_relaxed)) {
+    }
+    current = _max.load(std::memory_order_relaxed);
+    while (cycles > current && !_max.compare_exchange_weak(current, cycles, std::memory_order_relaxed)) {
+    }
+}
+
+void TraceSite::record(uint64_t start_ticks, uint32_t cycles) {
+    if (!_registered.load(std::memory_order_acquire) && !_registered.exchange(true, std::memory_order_acq_rel)) {
+        TraceSite* head = sites.load(std::memory_order_relaxed);
+        do {
+            _next = head;
+        } while (!sites.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+    }
+    add(cycles);
+
+#if FLEXHAL_INTERNAL_TRACE_PER_CORE
+    // The lock also covers a task that migrates to the other core in between
+    Buffer& buffer = buffers[static_cast<uint32_t>(xPortGetCoreID()) % FLEXHAL_TRACE_BUFFERS];
+    portENTER_CRITICAL_SAFE(&buffer.lock);
+    append(buffer, this, start_ticks, cycles);
+    portEXIT_CRITICAL_SAFE(&buffer.lock);
+#else
+    Buffer* buffer = claim_buffer();
+    if (buffer == nullptr) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    append(*buffer, this, start_ticks, cycles);
+#endif
+}
+
+SiteStats TraceSite::getStats() const {
+    SiteStats stats;
+    stats.name     = _name;
+    stats.count    = _count.load(std::memory_order_relaxed);
+    stats.total_ns = utils::time::cycles_to_ns(_total.load(std::memory_order_relaxed));
+    stats.min_ns   = stats.count != 0 ? cycles_to_ns32(_min.load(std::memory_order_relaxed)) : 0;
+    stats.max_ns   = cycles_to_ns32(_max.load(std::memory_order_relaxed));
+    stats.mean_ns  = stats.count != 0 ? static_cast<uint32_t>(stats.total_ns / stats.count) : 0;
+    return stats;
+}
+
+size_t get_site_count() {
+    size_t count = 0;
+    for (const TraceSite* site = sites.load(std::memory_order_acquire); site != nullptr; site = site->_next) {
+        ++count;
+    }
+    return count;
+}
+
+bool get_site_stats(size_t index, SiteStats& stats) {
+    const TraceSite* site = sites.load(std::memory_order_acquire);
+    for (; site != nullptr && index > 0; --index) {
+        site = site->_next;
+    }
+    if (site == nullptr) {
+        return false;
+    }
+    stats = site->getStats();
+    return true;
+}
+
+size_t get_events(TraceEvent* events, size_t max_events) {
+    size_t count = 0;
+    if (max_events == 0) {
+        return 0;
+    }
+    for_each_event([&](const TraceEvent& event) {
+        events[count++] = event;
+        return count < max_events;
+    });
+    return count;
+}
+
+uint32_t get_dropped_count() {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+void log_stats() {
+    SiteStats stats;
+    for (size_t i = 0; get_site_stats(i, stats); ++i) {
+        logger::Log.info("TRACE", "%s: n=%" PRIu32 " min=%" PRIu32 " mean=%" PRIu32 " max=%" PRIu32 " ns", stats.name,
+                         stats.count, stats.min_ns, stats.mean_ns, stats.max_ns);
+    }
+}
+
+void export_chrome_json(WriteFn write, void* context) {
+    static const char header[] = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    write(header, sizeof(header) - 1, context);
+    bool first = true;
+    for_each_event([&](const TraceEvent& event) {
+        // Chrome expects microseconds; the fraction keeps nanosecond precision
+        char line[192];
+        const int length =
+            snprintf(line, sizeof(line),
+                     "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%" PRIu32 ",\"ts\":%" PRIu64
+                     ".%03u,\"dur\":%" PRIu32 ".%03u}",
+                     first ? "" : ",", event.name, event.thread, event.start_ns / 1000,
+                     static_cast<unsigned>(event.start_ns % 1000), event.duration_ns / 1000,
+                     static_cast<unsigned>(event.duration_ns % 1000));
+        if (length > 0 && static_cast<size_t>(length) < sizeof(line)) {
+            write(line, static_cast<size_t>(length), context);
+            first = false;
+        }
+        return true;
+    });
+    static const char footer[] = "]}\n";
+    write(footer, sizeof(footer) - 1, context);
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+base::status save_chrome_json(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file == nullptr) {
+        return base::status::io;
+    }
+    export_chrome_json(
+        [](const char* data, size_t size, void* context) { fwrite(data, 1, size, static_cast<FILE*>(context)); },
+        file);
+    return fclose(file) == 0 ? base::status::ok : base::status::io;
+}
+#endif
+
+void reset() {
+    for (TraceSite* site = sites.load(std::memory_order_acquire); site != nullptr; site = site->_next) {
+        site->_count.store(0, std::memory_order_relaxed);
+        site->_total.store(0, std::memory_order_relaxed);
+        site->_min.store(UINT32_MAX, std::memory_order_relaxed);
+        site->_max.store(0, std::memory_order_relaxed);
+    }
+    for (Buffer& buffer : buffers) {
+        buffer.head.store(0, std::memory_order_relaxed);
+    }
+    dropped.store(0, std::memory_order_relaxed);
+}
+
+} // namespace trace
+} // namespace utils
+} // namespace flexhal
+
+#endif // FLEXHAL_INTERNAL_UTILS_TRACE_TRACER_IPP
+#endif // FLEXHAL_INTERNAL_IMPLEMENTATION
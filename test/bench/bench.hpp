@@ -0,0 +1,269 @@
+// マイクロベンチマーク用の小さなハーネス
+//
+// run() は 1 サンプルが一定時間以上になるようにバッチ回数を決め、サンプルごとの
+// ns/op から平均・最小・パーセンタイルを求め、サイクル数/op（x86: rdtsc の基準クロック、
+// ESP32: ESP.getCycleCount()）とヒープ確保回数/op も記録する。
+// 全テスト終了時に結果を 1 行の JSON（"BENCH_JSON " で始まる）として出力し、
+// native では環境変数 FLEXHAL_BENCH_JSON のパスにも書き出す。
+//
+// operator new / delete を置き換えるので、各スイートの 1 つのファイルからだけ include すること。
+
+#pragma once
+
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define FLEXHAL_BENCH_CYCLES 1
+#elif defined(ARDUINO_ARCH_ESP32)
+#include <Esp.h>
+#define FLEXHAL_BENCH_CYCLES 1
+#else
+#define FLEXHAL_BENCH_CYCLES 0
+#endif
+
+// サンプル数と 1 サンプルの最短時間（マイコンでは短めに、時計の分解能より十分長く）
+#ifndef FLEXHAL_BENCH_SAMPLES
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+#define FLEXHAL_BENCH_SAMPLES 201
+#else
+#define FLEXHAL_BENCH_SAMPLES 31
+#endif
+#endif
+
+#ifndef FLEXHAL_BENCH_MIN_SAMPLE_NS
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+#define FLEXHAL_BENCH_MIN_SAMPLE_NS 20000
+#else
+#define FLEXHAL_BENCH_MIN_SAMPLE_NS 2000000
+#endif
+#endif
+
+namespace flexhal_bench {
+
+// --- ヒープ確保のカウント ---
+
+inline std::atomic<uint64_t>& allocation_count() {
+  static std::atomic<uint64_t> count{0};
+  return count;
+}
+
+// --- 最適化で消されないようにする ---
+
+template <class T>
+inline void do_not_optimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobber_memory() {
+  asm volatile("" : : : "memory");
+}
+
+// ESP32 のカウンタは 32 ビットなので、差分は同じ幅の型で取る
+#if defined(ARDUINO_ARCH_ESP32)
+using cycles_t = uint32_t;
+#else
+using cycles_t = uint64_t;
+#endif
+
+inline cycles_t cycle_count() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(ARDUINO_ARCH_ESP32)
+  return ESP.getCycleCount();
+#else
+  return 0;
+#endif
+}
+
+struct Result {
+  std::string name;
+  uint64_t batch;        // 1 サンプルあたりの呼び出し回数
+  uint32_t samples;
+  double ns_per_op;      // 全サンプルの平均
+  double min_ns;
+  double p50_ns;
+  double p90_ns;
+  double p99_ns;
+  double cycles_per_op;  // 使えない環境では負
+  double allocs_per_op;  // record() では負
+};
+
+inline std::vector<Result>& results() {
+  static std::vector<Result> list;
+  return list;
+}
+
+// 昇順に並んだ値の p パーセンタイル（0..1）
+inline double percentile(const std::vector<double>& sorted, double p) {
+  return sorted[static_cast<size_t>(p * (sorted.size() - 1) + 0.5)];
+}
+
+inline const Result& add_result(Result result) {
+  printf("[ bench     ] %-32s %9.2f ns/op  p50 %8.2f  p99 %8.2f  %8.1f cycles/op  %.3f allocs/op\n",
+         result.name.c_str(), result.ns_per_op, result.p50_ns, result.p99_ns, result.cycles_per_op,
+         result.allocs_per_op);
+  results().push_back(result);
+  return results().back();
+}
+
+// op をバッチで繰り返し実行して計測する。結果が最適化で消えないよう、op の中で do_not_optimize() すること。
+template <class F>
+inline const Result& run(const char* name, F&& op, uint32_t samples = FLEXHAL_BENCH_SAMPLES) {
+  using flexhal::utils::time::nanos64;
+
+  // ウォームアップを兼ねてバッチ回数を決める
+  uint64_t batch = 1;
+  for (;;) {
+    const uint64_t start = nanos64();
+    for (uint64_t i = 0; i < batch; ++i) op();
+    if (nanos64() - start >= FLEXHAL_BENCH_MIN_SAMPLE_NS || batch >= (1ull << 30)) break;
+    batch *= 2;
+  }
+
+  std::vector<double> per_op;
+  per_op.reserve(samples);
+  uint64_t total_ns = 0, total_cycles = 0;
+  const uint64_t allocations = allocation_count().load(std::memory_order_relaxed);
+  for (uint32_t s = 0; s < samples; ++s) {
+    const uint64_t start  = nanos64();
+    const cycles_t cycles = cycle_count();
+    for (uint64_t i = 0; i < batch; ++i) op();
+    const cycles_t elapsed_cycles = static_cast<cycles_t>(cycle_count() - cycles);
+    const uint64_t elapsed        = nanos64() - start;
+    per_op.push_back(static_cast<double>(elapsed) / batch);
+    total_ns += elapsed;
+    total_cycles += elapsed_cycles;
+  }
+  const uint64_t allocated = allocation_count().load(std::memory_order_relaxed) - allocations;
+
+  std::sort(per_op.begin(), per_op.end());
+  const double ops = static_cast<double>(batch) * samples;
+  return add_result(Result{name,
+                           batch,
+                           samples,
+                           total_ns / ops,
+                           per_op.front(),
+                           percentile(per_op, 0.50),
+                           percentile(per_op, 0.90),
+                           percentile(per_op, 0.99),
+                           FLEXHAL_BENCH_CYCLES ? total_cycles / ops : -1.0,
+                           allocated / ops});
+}
+
+// バッチにできない 1 回ごとの計測値（遅延の超過時間、割り込みの応答時間など）を記録する。
+// サイクル数と確保回数は記録しない（JSON では null）
+inline const Result& record(const char* name, std::vector<double> ns) {
+  if (ns.empty()) ns.push_back(0);
+  std::sort(ns.begin(), ns.end());
+  double total = 0;
+  for (double v : ns) total += v;
+  return add_result(Result{name,
+                           1,
+                           static_cast<uint32_t>(ns.size()),
+                           total / ns.size(),
+                           ns.front(),
+                           percentile(ns, 0.50),
+                           percentile(ns, 0.90),
+                           percentile(ns, 0.99),
+                           -1.0,
+                           -1.0});
+}
+
+inline std::string to_json() {
+  std::string json = "{\"platform\":\"";
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+  json += "native";
+#else
+  json += "arduino";
+#endif
+  json += "\",\"compiler\":\"" __VERSION__ "\",\"results\":[";
+  char item[512];
+  for (size_t i = 0; i < results().size(); ++i) {
+    const Result& r = results()[i];
+    char cycles[32], allocs[32];
+    if (r.cycles_per_op >= 0) {
+      snprintf(cycles, sizeof(cycles), "%.2f", r.cycles_per_op);
+    } else {
+      snprintf(cycles, sizeof(cycles), "null");
+    }
+    if (r.allocs_per_op >= 0) {
+      snprintf(allocs, sizeof(allocs), "%.4f", r.allocs_per_op);
+    } else {
+      snprintf(allocs, sizeof(allocs), "null");
+    }
+    snprintf(item, sizeof(item),
+             "%s{\"name\":\"%s\",\"batch\":%llu,\"samples\":%u,\"ns_per_op\":%.3f,\"min_ns\":%.3f,"
+             "\"p50_ns\":%.3f,\"p90_ns\":%.3f,\"p99_ns\":%.3f,\"cycles_per_op\":%s,\"allocs_per_op\":%s}",
+             i ? "," : "", r.name.c_str(), static_cast<unsigned long long>(r.batch), r.samples, r.ns_per_op,
+             r.min_ns, r.p50_ns, r.p90_ns, r.p99_ns, cycles, allocs);
+    json += item;
+  }
+  json += "]}";
+  return json;
+}
+
+// 全テスト終了後に JSON を出力する
+class ReportEnvironment : public ::testing::Environment {
+public:
+  void TearDown() override {
+    const std::string json = to_json();
+    printf("BENCH_JSON %s\n", json.c_str());
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+    if (const char* path = getenv("FLEXHAL_BENCH_JSON")) {
+      if (FILE* file = fopen(path, "w")) {
+        fputs(json.c_str(), file);
+        fputc('\n', file);
+        fclose(file);
+      }
+    }
+#endif
+  }
+};
+
+static ::testing::Environment* const report_environment =
+    ::testing::AddGlobalTestEnvironment(new ReportEnvironment);
+
+} // namespace flexhal_bench
+
+// --- operator new / delete の置き換え（確保回数を数える） ---
+// どちらもインライン展開させない（呼び出し側で malloc() / free() と new / delete の組み合わせに見え、
+// GCC が -Wmismatched-new-delete を誤検出する）
+
+__attribute__((noinline)) void* operator new(size_t size) {
+  flexhal_bench::allocation_count().fetch_add(1, std::memory_order_relaxed);
+  if (void* p = malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void* operator new[](size_t size) {
+  flexhal_bench::allocation_count().fetch_add(1, std::memory_order_relaxed);
+  if (void* p = malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+  free(p);
+}
+
+__attribute__((noinline)) void operator delete[](void* p) noexcept {
+  free(p);
+}
+
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+__attribute__((noinline)) void operator delete[](void* p, size_t) noexcept {
+  free(p);
+}
@@ -0,0 +1,76 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace flexhal_bench {
+
+namespace native_adc = flexhal::internal::platform::native::hal::adc;
+namespace adc = flexhal::hal::adc;
+
+using Shape = native_adc::Waveform::Shape;
+
+// 単発の読み取り（4 チャンネルのスキャン、16 回オーバーサンプリング）
+inline bool bench_adc_read() {
+  native_adc::NativeAdc converter(4, 12);
+  converter.setWaveform(0, {Shape::Sine, 50.0, 1000.0, 2048.0, 16});
+  const uint32_t channels[] = {0, 1, 2, 3};
+  adc::sample_t out[4];
+  bool ok = true;
+  run("NativeAdc::readScan 4 ch", [&] {
+    ok = ok && converter.readScan({channels, 4, 1}, out) == flexhal::base::status::ok;
+    do_not_optimize(out[0]);
+  });
+  run("NativeAdc::read x16 oversampling", [&] { do_not_optimize(converter.read(0, 16)); });
+  return ok;
+}
+
+// 実時間モード（10 kHz x 4 ch、100 スキャンごとにコールバック）でのコールバック間隔。
+// スキャンレートどおりなら 10 ms 間隔で、200 ms で約 2000 スキャンになる
+inline bool bench_adc_realtime() {
+  native_adc::NativeAdc converter(4, 12);
+  converter.setWaveform(0, {Shape::Sine, 50.0, 1000.0, 2048.0, 0});
+  struct Counter {
+    std::atomic<uint32_t> halves{0};
+    uint64_t at_ns[64] = {};
+  } counter;
+  auto tick = [](void* context, const adc::sample_t*, size_t) {
+    Counter* c       = static_cast<Counter*>(context);
+    const uint32_t i = c->halves.load();
+    if (i < 64) c->at_ns[i] = flexhal::utils::time::nanos64();
+    c->halves.store(i + 1);
+  };
+  adc::sample_t buffer[4 * 200];
+  const uint32_t channels[] = {0, 1, 2, 3};
+  const uint64_t start      = flexhal::utils::time::nanos64();
+  bool ok = converter.startContinuous({channels, 4, 4}, {buffer, 4 * 200, 10000, tick, tick, &counter}) ==
+            flexhal::base::status::ok;
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  converter.stopContinuous();
+  const double elapsed_ms = (flexhal::utils::time::nanos64() - start) / 1e6;
+
+  const uint32_t halves = counter.halves.load();
+  std::vector<double> intervals;
+  for (uint32_t i = 1; i < halves && i < 64; ++i) {
+    intervals.push_back(static_cast<double>(counter.at_ns[i] - counter.at_ns[i - 1]));
+  }
+  record("NativeAdc 100-scan callback interval", intervals);
+  const uint32_t scans = halves * 100;
+  // 1 コアの VM でも大きく外れないこと
+  return ok && scans >= 1000 && scans <= elapsed_ms * 10.0 + 100 && !converter.isContinuousRunning();
+}
+
+} // namespace flexhal_bench
+
+TEST(AdcBench, Read) {
+  EXPECT_TRUE(flexhal_bench::bench_adc_read());
+}
+
+TEST(AdcBench, Realtime) {
+  EXPECT_TRUE(flexhal_bench::bench_adc_realtime());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,194 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+#include <cstdlib>
+#include <thread>
+#endif
+
+#ifndef FLEXHAL_BENCH_GPIO_PIN
+#define FLEXHAL_BENCH_GPIO_PIN 2 // 実機では何もつながっていないピンを指定する
+#endif
+
+namespace flexhal_bench {
+
+namespace gpio = flexhal::hal::gpio;
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+using Gpio = flexhal::internal::platform::native::hal::gpio::NativeGpio;
+#else
+using Gpio = flexhal::internal::framework::arduino::hal::gpio::ArduinoGpio;
+#endif
+
+// IPin / IPort の仮想呼び出し経由のコスト
+inline bool bench_gpio() {
+  Gpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  gpio::IPin& pin   = port.getPin(FLEXHAL_BENCH_GPIO_PIN);
+  if (pin.setMode(gpio::PinMode::Output) != flexhal::base::status::ok) return false;
+
+  bool level = false;
+  run("IPin::digitalWrite", [&] {
+    level = !level;
+    do_not_optimize(pin.digitalWrite(level));
+  });
+  run("IPin::digitalRead", [&] { do_not_optimize(pin.digitalRead()); });
+
+  const uint32_t mask = 1u << FLEXHAL_BENCH_GPIO_PIN;
+  run("IPort::toggleBits", [&] { do_not_optimize(port.toggleBits(mask)); });
+  run("IPort::read", [&] { do_not_optimize(port.read()); });
+  return results().back().allocs_per_op == 0;
+}
+
+// 番兵値の判定と result<bool> での読み取りコストの比較
+inline bool bench_try_read() {
+  Gpio hal_gpio;
+  gpio::IPin& pin = hal_gpio.getPort(0).getPin(FLEXHAL_BENCH_GPIO_PIN);
+  if (pin.setMode(gpio::PinMode::Input) != flexhal::base::status::ok) return false;
+
+  uint32_t errors = 0;
+  run("IPin::digitalRead + sentinel", [&] {
+    const int level = pin.digitalRead();
+    if (level < 0) ++errors;
+    do_not_optimize(level);
+  });
+  run("IPin::tryDigitalRead", [&] {
+    const flexhal::base::result<bool> level = pin.tryDigitalRead();
+    if (!level) ++errors;
+    do_not_optimize(level.value());
+  });
+  return errors == 0 && results().back().allocs_per_op == 0;
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+
+// エッジ注入→キュー投入→取り出しの 1 イベントあたりのコスト
+inline bool bench_interrupt_queue() {
+  Gpio hal_gpio;
+  gpio::IPin& pin = hal_gpio.getPort(0).getPin(9);
+  pin.digitalWrite(false);
+  gpio::PinEventQueue queue(1024);
+  pin.attachInterrupt(gpio::PinEdge::Both, queue);
+  gpio::PinEvent event;
+  bool level = false;
+  const Result& result = run("PinEventQueue edge+pop", [&] {
+    level = !level;
+    pin.digitalWrite(level);
+    do_not_optimize(queue.pop(event));
+  });
+  pin.detachInterrupt();
+  return result.allocs_per_op == 0 && queue.getDroppedCount() == 0;
+}
+
+// 別スレッドから 1 つずつ注入したエッジを、消費側スレッドが取り出すまでの遅延
+inline bool bench_interrupt_latency(uint32_t edges = 20000) {
+  Gpio hal_gpio;
+  gpio::IPin& pin = hal_gpio.getPort(0).getPin(10);
+  pin.digitalWrite(false);
+  gpio::PinEventQueue queue(64);
+  pin.attachInterrupt(gpio::PinEdge::Both, queue);
+
+  std::atomic<uint32_t> consumed(0);
+  std::vector<double> latency;
+  latency.reserve(edges);
+  std::thread consumer([&]() {
+    gpio::PinEvent event;
+    while (consumed.load(std::memory_order_relaxed) < edges) {
+      if (queue.pop(event)) {
+        latency.push_back(static_cast<double>(native_gpio::PinStateBlock::now_ns() - event.timestamp_ns));
+        consumed.fetch_add(1, std::memory_order_release);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  for (uint32_t i = 0; i < edges; ++i) {
+    pin.digitalWrite((i & 1) == 0);
+    while (consumed.load(std::memory_order_acquire) <= i) std::this_thread::yield();
+  }
+  consumer.join();
+  pin.detachInterrupt();
+  const bool ok = latency.size() == edges && queue.getDroppedCount() == 0;
+  record("PinEventQueue cross-thread latency", latency);
+  return ok;
+}
+
+struct EdgeTimes {
+  std::vector<uint64_t> ns;
+};
+
+inline void record_edge(void* context, const gpio::PinEvent& event) {
+  static_cast<EdgeTimes*>(context)->ns.push_back(event.timestamp_ns);
+}
+
+// 各エッジの実時刻と理想時刻（最初のエッジ基準）のずれ
+inline std::vector<double> edge_errors(const std::vector<uint64_t>& edges, uint32_t period_ns) {
+  std::vector<double> errors;
+  for (size_t i = 0; i < edges.size(); ++i) {
+    const int64_t e = static_cast<int64_t>(edges[i] - edges[0]) - static_cast<int64_t>(i * period_ns);
+    errors.push_back(static_cast<double>(std::llabs(e)));
+  }
+  return errors;
+}
+
+// 矩形波 (10 us 周期) のエッジ誤差を、digitalWrite + delay_us のループと比較する
+inline bool bench_waveform_jitter(uint32_t edges = 400, uint32_t period_ns = 10000) {
+  Gpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  gpio::IPin& pin   = port.getPin(6);
+  pin.digitalWrite(false);
+
+  std::vector<gpio::WaveStep> steps(edges);
+  for (uint32_t i = 0; i < edges; ++i) steps[i] = {1u << 6, (i % 2 == 0) ? (1u << 6) : 0u, period_ns};
+
+  EdgeTimes played, looped;
+  gpio::WaveformPlayer player(port);
+  player.calibrate(64, 1u << 6);
+  played.ns.reserve(edges);
+  pin.attachInterrupt(gpio::PinEdge::Both, record_edge, &played);
+  player.play(steps.data(), steps.size());
+  pin.detachInterrupt();
+
+  pin.digitalWrite(false);
+  looped.ns.reserve(edges);
+  pin.attachInterrupt(gpio::PinEdge::Both, record_edge, &looped);
+  for (uint32_t i = 0; i < edges; ++i) {
+    flexhal::utils::time::delay_us(period_ns / 1000);
+    pin.digitalWrite(i % 2 == 0);
+  }
+  pin.detachInterrupt();
+
+  if (played.ns.size() != edges || looped.ns.size() != edges) return false;
+  const Result& player_error = record("WaveformPlayer edge error", edge_errors(played.ns, period_ns));
+  const double player_p50    = player_error.p50_ns;
+  const Result& loop_error   = record("write+delay_us edge error", edge_errors(looped.ns, period_ns));
+  // 絶対期限なので誤差は蓄積しない（ループ側は周期ごとに遅れが積み上がる）
+  return player_p50 < loop_error.p50_ns;
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+} // namespace flexhal_bench
+
+TEST(GpioBench, PinAndPort) {
+  EXPECT_TRUE(flexhal_bench::bench_gpio());
+}
+
+TEST(GpioBench, TryRead) {
+  EXPECT_TRUE(flexhal_bench::bench_try_read());
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+TEST(GpioBench, InterruptQueue) {
+  EXPECT_TRUE(flexhal_bench::bench_interrupt_queue());
+}
+
+TEST(GpioBench, InterruptLatency) {
+  EXPECT_TRUE(flexhal_bench::bench_interrupt_latency());
+}
+
+TEST(GpioBench, WaveformJitter) {
+  EXPECT_TRUE(flexhal_bench::bench_waveform_jitter());
+}
+#endif
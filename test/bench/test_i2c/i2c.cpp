@@ -0,0 +1,60 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+namespace flexhal_bench {
+
+namespace native_i2c = flexhal::internal::platform::native::hal::i2c;
+namespace i2c = flexhal::hal::i2c;
+
+using flexhal::base::status;
+
+// 4 デバイス x 8 レジスタの 32 回の読み出しを、1 つずつ転送した場合とバッチで処理した場合の CPU 時間。
+// シミュレーション上のバス時間（400 kHz）も 1 回分の値として記録する
+inline bool bench_i2c(bool batched) {
+  native_i2c::NativeI2c bus(400000);
+  native_i2c::I2cRegisterDevice devices[4];
+  for (int d = 0; d < 4; ++d) bus.attachDevice(static_cast<uint16_t>(0x40 + d), devices[d]);
+
+  static const uint8_t registers[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  uint8_t values[32] = {};
+  i2c::I2cTransaction transactions[32];
+  for (int i = 0; i < 32; ++i) {
+    transactions[i].address      = static_cast<uint16_t>(0x40 + i % 4);
+    transactions[i].write        = &registers[i / 4];
+    transactions[i].write_length = 1;
+    transactions[i].read         = &values[i];
+    transactions[i].read_length  = 1;
+    transactions[i].flags        = i2c::I2cTransaction::auto_increment;
+  }
+
+  bool ok = true;
+  auto round = [&] {
+    if (batched) {
+      ok = ok && bus.submitBatch(transactions, 32) == status::ok;
+      bus.poll();
+    } else {
+      for (auto& t : transactions) ok = ok && bus.transfer(t) == status::ok;
+    }
+  };
+  run(batched ? "NativeI2c 32 reads (batched)" : "NativeI2c 32 reads (naive)", round);
+
+  bus.resetStats();
+  bus.resetBusTime();
+  round();
+  record(batched ? "NativeI2c 32 reads bus time (batched)" : "NativeI2c 32 reads bus time (naive)",
+         {static_cast<double>(bus.getBusTime_ns())});
+  return ok && bus.getBusStats().messages == (batched ? 4u : 32u);
+}
+
+} // namespace flexhal_bench
+
+TEST(I2cBench, Naive) {
+  EXPECT_TRUE(flexhal_bench::bench_i2c(false));
+}
+
+TEST(I2cBench, Batched) {
+  EXPECT_TRUE(flexhal_bench::bench_i2c(true));
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,48 @@
+#include "../bench.hpp"
+
+#include <cstdarg>
+
+namespace flexhal_bench {
+
+namespace logger = flexhal::utils::logger;
+
+// 整形までは行い、出力はしないロガー
+class FormatOnlyLogger : public logger::ILogger {
+public:
+  void log(logger::LogLevel level, const char* tag, const char* format, std::va_list args) override {
+    char text[128];
+    do_not_optimize(vsnprintf(text, sizeof(text), format, args));
+    (void)level;
+    (void)tag;
+  }
+};
+
+// レベルで捨てられる呼び出し、同期整形、AsyncLogger へのキューイングのコスト
+inline bool bench_logger() {
+  FormatOnlyLogger sink;
+  logger::setLogger(&sink);
+  logger::setLogLevel(logger::LogLevel::INFO);
+  int value = 0;
+
+  run("Log.debug (filtered)", [&] { logger::Log.debug("BENCH", "value %d", ++value); });
+  run("FLEXHAL_LOGD (filtered)", [&] { FLEXHAL_LOGD("BENCH", "value %d", ++value); });
+  run("Log.info (formatted)", [&] { logger::Log.info("BENCH", "value %d", ++value); });
+
+  logger::AsyncLogger async(sink, 1024);
+  logger::setLogger(&async);
+  run("Log.info (AsyncLogger + drain)", [&] {
+    logger::Log.info("BENCH", "value %d", ++value);
+    if (async.getQueuedCount() % 512 == 0) async.drain();
+  });
+  async.flush();
+  const bool ok = results().back().allocs_per_op == 0 && async.getDroppedCount() == 0;
+
+  logger::setLogger(nullptr);
+  return ok;
+}
+
+} // namespace flexhal_bench
+
+TEST(LoggerBench, Paths) {
+  EXPECT_TRUE(flexhal_bench::bench_logger());
+}
@@ -0,0 +1,61 @@
+// DEBUG 以下をコンパイル時に取り除いた状態で、抑制されたログ呼び出しのコストを比べる
+// （-DFLEXHAL_LOG_MIN_LEVEL=FLEXHAL_LOG_LEVEL_INFO でビルドしたのと同じ。このファイルだけに効く）
+#define FLEXHAL_LOG_MIN_LEVEL FLEXHAL_LOG_LEVEL_INFO
+
+#include "../bench.hpp"
+
+#include <cstdarg>
+
+namespace flexhal_bench {
+
+namespace logger = flexhal::utils::logger;
+
+// 何も出力しないロガー（抑制されるので呼ばれないはず）
+class NullLogger : public logger::ILogger {
+public:
+  void log(logger::LogLevel level, const char* tag, const char* format, std::va_list args) override {
+    ++calls;
+    (void)level;
+    (void)tag;
+    (void)format;
+    (void)args;
+  }
+
+  uint32_t calls = 0;
+};
+
+// 変更前の LogProxy::debug と同じ形: 先に va_start し、その後でレベルを比べる
+__attribute__((noinline)) void baseline_debug(const char* tag, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  if (logger::_active_logger && logger::LogLevel::DEBUG <= logger::_default_log_level) {
+    logger::_active_logger->log(logger::LogLevel::DEBUG, tag, format, args);
+  }
+  va_end(args);
+}
+
+// 抑制された DEBUG 呼び出しのサイクル数/op: コンパイル時に除去、実行時の判定、変更前の経路
+inline bool bench_suppressed_log() {
+  NullLogger sink;
+  logger::setLogger(&sink);
+  logger::setLogLevel(logger::LogLevel::INFO);
+  int value = 0;
+
+  run("FLEXHAL_LOGD (stripped)", [&] {
+    FLEXHAL_LOGD("BENCH", "value %d", ++value);
+    do_not_optimize(value);
+  });
+  const bool stripped = value == 0; // 引数も評価されない
+
+  run("Log.debug (runtime filtered)", [&] { logger::Log.debug("BENCH", "value %d", ++value); });
+  run("va_start + level compare (baseline)", [&] { baseline_debug("BENCH", "value %d", ++value); });
+
+  logger::setLogger(nullptr);
+  return stripped && sink.calls == 0 && results().back().allocs_per_op == 0;
+}
+
+} // namespace flexhal_bench
+
+TEST(LoggerBench, Suppressed) {
+  EXPECT_TRUE(flexhal_bench::bench_suppressed_log());
+}
@@ -0,0 +1,81 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <memory>
+
+namespace flexhal_bench {
+
+namespace memory = flexhal::utils::memory;
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+
+// 構築時間と走査の局所性: アリーナに並べたピンと、個別に new したピンの比較。
+// 構築はまとめて 1 回しか計れないので数回作り直し、走査は全ピン 1 周を 1 回として計測する
+inline bool bench_memory_pins(size_t count = 4096, int rounds = 5) {
+  using flexhal::utils::time::nanos64;
+
+  native_gpio::PinStateBlock& block = native_gpio::default_block();
+  native_gpio::NativeGpio gpio;
+  flexhal::hal::gpio::IPort& port = gpio.getPort(0);
+
+  std::vector<std::unique_ptr<native_gpio::NativePin>> heap_pins;
+  std::vector<std::unique_ptr<uint8_t[]>> noise;
+  std::vector<uint8_t> storage(sizeof(native_gpio::NativePin) * count + alignof(native_gpio::NativePin));
+  native_gpio::NativePin* arena_pins = nullptr;
+  std::vector<double> heap_build, arena_build;
+  bool ok = true;
+  for (int round = 0; round < rounds; ++round) {
+    // 以前と同じ make_unique 方式。間に別の確保を挟み、ヒープ上で散らばる状況を再現する
+    heap_pins.clear();
+    noise.clear();
+    heap_pins.reserve(count);
+    noise.reserve(count);
+    uint64_t start = nanos64();
+    for (size_t i = 0; i < count; ++i) {
+      heap_pins.push_back(std::make_unique<native_gpio::NativePin>(port, block, static_cast<uint32_t>(i % 32)));
+      noise.push_back(std::make_unique<uint8_t[]>(48 + (i % 5) * 16));
+    }
+    heap_build.push_back(static_cast<double>(nanos64() - start) / count);
+
+    if (arena_pins != nullptr) {
+      for (size_t i = 0; i < count; ++i) arena_pins[i].~NativePin();
+    }
+    memory::Arena arena(storage.data(), storage.size());
+    start      = nanos64();
+    arena_pins = arena.allocateArray<native_gpio::NativePin>(count);
+    for (size_t i = 0; i < count; ++i) {
+      new (&arena_pins[i]) native_gpio::NativePin(port, block, static_cast<uint32_t>(i % 32));
+    }
+    arena_build.push_back(static_cast<double>(nanos64() - start) / count);
+    ok = ok && arena.getStats().allocations == 1;
+  }
+  record("NativePin build (make_unique)", heap_build);
+  record("NativePin build (arena)", arena_build);
+
+  // 同じ順序で仮想関数を呼びながら全ピンをなめる（アクセス順は割り当て順）
+  std::vector<flexhal::hal::gpio::IPin*> heap_order, arena_order;
+  for (size_t i = 0; i < count; ++i) {
+    heap_order.push_back(heap_pins[i].get());
+    arena_order.push_back(&arena_pins[i]);
+  }
+  uint64_t heap_sum = 0, arena_sum = 0;
+  run("NativePin walk (make_unique)", [&] {
+    for (flexhal::hal::gpio::IPin* pin : heap_order) heap_sum += pin->getPinIndex();
+    do_not_optimize(heap_sum);
+  });
+  run("NativePin walk (arena)", [&] {
+    for (flexhal::hal::gpio::IPin* pin : arena_order) arena_sum += pin->getPinIndex();
+    do_not_optimize(arena_sum);
+  });
+
+  for (size_t i = 0; i < count; ++i) arena_pins[i].~NativePin();
+  return ok && heap_sum > 0 && arena_sum > 0;
+}
+
+} // namespace flexhal_bench
+
+TEST(MemoryBench, Pins) {
+  EXPECT_TRUE(flexhal_bench::bench_memory_pins());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,58 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+namespace flexhal_bench {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace pwm = flexhal::hal::pwm;
+
+// チャネル数ごとの 1 周期あたりのエッジ処理時間（ポートへ書き込んだ poll() の合計）。
+// 1 kHz で 20 ms ずつ 5 回動かし、回ごとの値を記録する
+inline bool bench_soft_pwm() {
+  native_gpio::PinStateBlock block;
+  native_gpio::PinStateBlockConfig config;
+  config.port_count = 16;
+  if (block.open(config) != flexhal::base::status::ok) return false;
+  native_gpio::NativeGpio hal_gpio(block);
+  bool ok = true;
+  for (uint32_t channels : {8u, 64u, 256u, 512u}) {
+    pwm::SoftPwm soft(channels, 1000, 256);
+    std::mt19937 rng(channels);
+    for (uint32_t i = 0; i < channels; ++i) {
+      int ch = soft.addChannel(hal_gpio.getPort(i / 32), i % 32);
+      soft.setDuty(static_cast<uint32_t>(ch), rng() % 257);
+    }
+    std::vector<double> per_period;
+    for (int round = 0; round < 5; ++round) {
+      const uint64_t busy0    = soft.getBusyTime_ns();
+      const uint32_t periods0 = soft.getPeriodCount();
+      const auto t0           = std::chrono::steady_clock::now();
+      while (std::chrono::steady_clock::now() - t0 < std::chrono::milliseconds(20)) {
+        uint32_t wait_us = soft.poll();
+        if (wait_us > 0) std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+      }
+      const uint32_t periods = soft.getPeriodCount() - periods0;
+      ok = ok && periods > 0;
+      if (periods > 0) per_period.push_back(static_cast<double>(soft.getBusyTime_ns() - busy0) / periods);
+    }
+    soft.stop();
+    char name[64];
+    snprintf(name, sizeof(name), "SoftPwm edge work/period (%u ch)", channels);
+    record(name, per_period);
+  }
+  block.close();
+  return ok;
+}
+
+} // namespace flexhal_bench
+
+TEST(SoftPwmBench, EdgeWork) {
+  EXPECT_TRUE(flexhal_bench::bench_soft_pwm());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,51 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+namespace flexhal_bench {
+
+namespace native_spi = flexhal::internal::platform::native::hal::spi;
+namespace spi = flexhal::hal::spi;
+
+using flexhal::base::status;
+
+// トランザクションあたりのオーバーヘッド（4 バイト x64 をまとめて投入）と 4 KiB 同期転送のスループット
+inline bool bench_spi(bool threaded) {
+  native_spi::NativeSpi bus(threaded);
+  spi::SpiDevice device;
+  static uint8_t tx[4096], rx[4096];
+
+  spi::SpiTransaction small[64];
+  for (auto& t : small) {
+    t.device = &device;
+    t.tx     = tx;
+    t.rx     = rx;
+    t.length = 4;
+  }
+  bool ok = true;
+  run(threaded ? "NativeSpi 64x4-byte queued (thread)" : "NativeSpi 64x4-byte queued (poll)", [&] {
+    for (auto& t : small) ok = ok && bus.submit(t) == status::ok;
+    while (!bus.isIdle()) bus.poll();
+  });
+
+  spi::SpiTransaction big;
+  big.device = &device;
+  big.tx     = tx;
+  big.rx     = rx;
+  big.length = sizeof(tx);
+  run(threaded ? "NativeSpi 4 KiB transfer (thread)" : "NativeSpi 4 KiB transfer (poll)",
+      [&] { ok = ok && bus.transfer(big) == status::ok; });
+  return ok;
+}
+
+} // namespace flexhal_bench
+
+TEST(SpiBench, Poll) {
+  EXPECT_TRUE(flexhal_bench::bench_spi(false));
+}
+
+TEST(SpiBench, Threaded) {
+  EXPECT_TRUE(flexhal_bench::bench_spi(true));
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,44 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_INTERNAL_TASK
+
+namespace flexhal_bench {
+
+namespace task = flexhal::utils::task;
+
+inline task::Task ping(int rounds, uint64_t* switches) {
+  for (int i = 0; i < rounds; ++i) {
+    ++*switches;
+    co_await task::yield_now();
+  }
+}
+
+// 多数のタスク間の切り替えコスト（yield_now() 1 回あたり）。
+// executor.run() はまとめて 1 回しか実行できないので、タスクを作り直して数回計測する
+inline bool bench_task_switch(int tasks = 12, int rounds = 20000, int repeat = 5) {
+  using flexhal::utils::time::nanos64;
+
+  std::vector<double> per_switch;
+  bool ok = true;
+  for (int r = 0; r < repeat; ++r) {
+    task::Executor executor;
+    uint64_t switches = 0;
+    for (int i = 0; i < tasks; ++i) {
+      ok = ok && executor.spawn(ping(rounds, &switches)) == flexhal::base::status::ok;
+    }
+    const uint64_t start = nanos64();
+    executor.run();
+    per_switch.push_back(static_cast<double>(nanos64() - start) / switches);
+    ok = ok && switches == static_cast<uint64_t>(tasks) * rounds;
+  }
+  record("task::yield_now switch (12 tasks)", per_switch);
+  return ok;
+}
+
+} // namespace flexhal_bench
+
+TEST(TaskBench, Switch) {
+  EXPECT_TRUE(flexhal_bench::bench_task_switch());
+}
+
+#endif // FLEXHAL_INTERNAL_TASK
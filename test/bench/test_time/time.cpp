@@ -0,0 +1,64 @@
+#include "../bench.hpp"
+
+// delay_us() の超過時間の上限
+#ifndef FLEXHAL_BENCH_DELAY_P50_NS
+#define FLEXHAL_BENCH_DELAY_P50_NS 5000
+#endif
+#ifndef FLEXHAL_BENCH_DELAY_P99_NS
+#define FLEXHAL_BENCH_DELAY_P99_NS 100000
+#endif
+
+namespace flexhal_bench {
+
+namespace time = flexhal::utils::time;
+
+// 時刻取得のコスト（いずれもヒープ確保なし）
+inline bool bench_time() {
+  bool ok = true;
+  ok = ok && run("time::millis", [] { do_not_optimize(time::millis()); }).allocs_per_op == 0;
+  ok = ok && run("time::micros", [] { do_not_optimize(time::micros()); }).allocs_per_op == 0;
+  ok = ok && run("time::micros64", [] { do_not_optimize(time::micros64()); }).allocs_per_op == 0;
+  ok = ok && run("time::nanos64", [] { do_not_optimize(time::nanos64()); }).allocs_per_op == 0;
+  ok = ok && run("time::ticks", [] { do_not_optimize(time::ticks()); }).allocs_per_op == 0;
+  return ok;
+}
+
+// delay_us() の超過時間（要求より長く待った分）の分布。短すぎる待ちは常に不可。
+// ホストの割り込み（他プロセス、VM のスケジューリング）は回ごとに変わるので、
+// 数回計測して p99 が最もよい回で判定する（実装が劣化すればどの回も悪くなる）
+inline bool bench_delay_us_overshoot(int rounds = 5, int repeat = 100) {
+  const uint32_t delays[] = {5, 20, 100, 500, 2000};
+  std::vector<double> best;
+  double best_p99 = 0;
+  for (int round = 0; round < rounds; ++round) {
+    std::vector<double> overshoot;
+    for (uint32_t delay_time : delays) {
+      for (int i = 0; i < repeat; ++i) {
+        const uint64_t start = time::nanos64();
+        time::delay_us(delay_time);
+        const uint64_t elapsed = time::nanos64() - start;
+        if (elapsed < delay_time * 1000ull) return false;
+        overshoot.push_back(static_cast<double>(elapsed - delay_time * 1000ull));
+      }
+    }
+    std::vector<double> sorted = overshoot;
+    std::sort(sorted.begin(), sorted.end());
+    const double p99 = percentile(sorted, 0.99);
+    if (best.empty() || p99 < best_p99) {
+      best     = overshoot;
+      best_p99 = p99;
+    }
+  }
+  const Result& result = record("time::delay_us overshoot", best);
+  return result.p50_ns < FLEXHAL_BENCH_DELAY_P50_NS && result.p99_ns < FLEXHAL_BENCH_DELAY_P99_NS;
+}
+
+} // namespace flexhal_bench
+
+TEST(TimeBench, Clocks) {
+  EXPECT_TRUE(flexhal_bench::bench_time());
+}
+
+TEST(TimeBench, DelayUsOvershoot) {
+  EXPECT_TRUE(flexhal_bench::bench_delay_us_overshoot());
+}
@@ -0,0 +1,64 @@
+#include "../bench.hpp"
+
+#include <random>
+
+// アクティブなタイマー数（マイコンではノードのプールが RAM に収まる数にする）
+#ifndef FLEXHAL_BENCH_TIMERS
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+#define FLEXHAL_BENCH_TIMERS 20000
+#else
+#define FLEXHAL_BENCH_TIMERS 2000
+#endif
+#endif
+
+namespace flexhal_bench {
+
+namespace timer = flexhal::utils::timer;
+
+inline void count_callback(void* context) {
+  ++*static_cast<int*>(context);
+}
+
+// 多数のアクティブタイマーでの start / cancel / advance+fire の 1 件あたりのコスト。
+// 各フェーズはまとめて 1 回しか実行できないので、ホイールを作り直して数回計測する
+inline bool bench_timer_wheel(uint32_t count = FLEXHAL_BENCH_TIMERS, int rounds = 5) {
+  using flexhal::utils::time::nanos64;
+
+  std::mt19937 rng(42);
+  std::vector<uint32_t> delays(count);
+  for (auto& d : delays) d = 1000 + (rng() % 60000) * 1000; // 1ms..60s
+  std::vector<timer::TimerId> ids(count);
+  std::vector<double> start_ns, cancel_ns, fire_ns;
+  bool ok = true;
+  for (int round = 0; round < rounds; ++round) {
+    timer::TimerWheel wheel(count, 1000);
+    int fired = 0;
+
+    uint64_t t0 = nanos64();
+    for (uint32_t i = 0; i < count; ++i) ids[i] = wheel.start(delays[i], count_callback, &fired);
+    uint64_t t1 = nanos64();
+    for (uint32_t i = 0; i < count; i += 2) wheel.cancel(ids[i]);
+    uint64_t t2  = nanos64();
+    size_t total = 0;
+    while (wheel.getActiveCount() > 0) total += wheel.advance(100);
+    uint64_t t3 = nanos64();
+
+    start_ns.push_back(static_cast<double>(t1 - t0) / count);
+    cancel_ns.push_back(static_cast<double>(t2 - t1) / (count / 2));
+    fire_ns.push_back(static_cast<double>(t3 - t2) / (count / 2));
+    ok = ok && total == count / 2 && fired == static_cast<int>(count / 2);
+  }
+  char name[64];
+  snprintf(name, sizeof(name), "TimerWheel::start (%u active)", count);
+  record(name, start_ns);
+  snprintf(name, sizeof(name), "TimerWheel::cancel (%u active)", count);
+  record(name, cancel_ns);
+  record("TimerWheel advance+fire per timer", fire_ns);
+  return ok;
+}
+
+} // namespace flexhal_bench
+
+TEST(TimerBench, Wheel) {
+  EXPECT_TRUE(flexhal_bench::bench_timer_wheel());
+}
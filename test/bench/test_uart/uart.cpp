@@ -0,0 +1,45 @@
+#include "../bench.hpp"
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <unistd.h>
+
+namespace flexhal_bench {
+
+namespace native_uart = flexhal::internal::platform::native::hal::uart;
+namespace uart = flexhal::hal::uart;
+
+// socketpair 経由の受信（1 KiB を送って poll し、peek/consume でコピーなしに行を数える）
+inline bool bench_uart_rx() {
+  native_uart::NativeUart port(4096, 256);
+  if (port.openSocketPair() != flexhal::base::status::ok) return false;
+  const int peer = port.getPeerFd();
+
+  static uint8_t chunk[1024];
+  for (size_t i = 0; i < sizeof(chunk); ++i) chunk[i] = static_cast<uint8_t>(i == sizeof(chunk) - 1 ? '\n' : 'a');
+  uint64_t chunks = 0, lines = 0;
+  bool ok = true;
+  const Result& result = run("NativeUart socketpair rx 1 KiB", [&] {
+    ok = ok && ::write(peer, chunk, sizeof(chunk)) == static_cast<ssize_t>(sizeof(chunk));
+    size_t received = 0;
+    while (ok && received < sizeof(chunk)) {
+      port.poll();
+      uart::ByteView view;
+      while ((view = port.peek()).size != 0) {
+        for (size_t i = 0; i < view.size; ++i) lines += view.data[i] == '\n';
+        received += view.size;
+        port.consume(view.size);
+      }
+    }
+    ++chunks;
+  });
+  return ok && lines == chunks && result.allocs_per_op == 0;
+}
+
+} // namespace flexhal_bench
+
+TEST(UartBench, SocketPairRx) {
+  EXPECT_TRUE(flexhal_bench::bench_uart_rx());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
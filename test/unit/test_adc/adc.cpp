@@ -0,0 +1,212 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace flexhal_test {
+
+namespace native_adc = flexhal::internal::platform::native::hal::adc;
+namespace adc = flexhal::hal::adc;
+
+using Shape = native_adc::Waveform::Shape;
+
+// 連続取得が止まるまで待つ（最大 timeout_ms）
+inline bool wait_stopped(adc::IAdc& converter, int timeout_ms) {
+  for (int i = 0; i < timeout_ms && converter.isContinuousRunning(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return !converter.isContinuousRunning();
+}
+
+// スキャンがグループの順に変換され、不正なグループが弾かれるか
+inline bool test_adc_scan() {
+  native_adc::NativeAdc converter(4, 12);
+  converter.setWaveform(0, {Shape::Constant, 0.0, 0.0, 100.0, 0});
+  converter.setWaveform(2, {Shape::Constant, 0.0, 0.0, 3000.0, 0});
+  converter.setWaveform(3, {Shape::Constant, 0.0, 0.0, 9999.0, 0}); // 上限で飽和
+  const uint32_t channels[] = {3, 0, 2, 1};
+  adc::sample_t out[4]      = {};
+  bool ok = converter.readScan({channels, 4, 1}, out) == flexhal::base::status::ok;
+  ok = ok && out[0] == 4095 && out[1] == 100 && out[2] == 3000 && out[3] == 0;
+  ok = ok && converter.read(2) == 3000 && converter.read(2, 8) == 3000;
+
+  const uint32_t bad[] = {0, 4};
+  ok = ok && converter.readScan({bad, 2, 1}, out) == flexhal::base::status::param;
+  ok = ok && converter.readScan({channels, 0, 1}, out) == flexhal::base::status::param;
+  ok = ok && converter.readScan({channels, 4, 1}, nullptr) == flexhal::base::status::param;
+  ok = ok && converter.read(7) == static_cast<int>(flexhal::base::status::param);
+  return ok && converter.getConversionCount() == 4 + 1 + 8 && converter.getResolutionBits() == 12;
+}
+
+// オーバーサンプリングでノイズの標準偏差が下がるか
+inline bool test_adc_oversampling() {
+  native_adc::NativeAdc converter(1, 12);
+  converter.setWaveform(0, {Shape::Constant, 0.0, 0.0, 2048.0, 64});
+  auto deviation = [&](uint32_t oversampling) {
+    double sum = 0.0, sq = 0.0;
+    const int n = 2000;
+    for (int i = 0; i < n; ++i) {
+      const double v = converter.read(0, oversampling);
+      sum += v;
+      sq += v * v;
+    }
+    const double mean = sum / n;
+    return std::sqrt(sq / n - mean * mean);
+  };
+  const double single = deviation(1);
+  const double x16    = deviation(16);
+  // 一様ノイズ ±64 の標準偏差は約 37、16 回平均で 1/4 になる
+  return single > 30.0 && single < 45.0 && x16 < single / 3.0;
+}
+
+struct Capture {
+  std::atomic<int> callbacks{0};
+  int halves[4] = {};
+  adc::sample_t first[4] = {}; // 各コールバックで渡された先頭スキャンの ch0
+  const adc::sample_t* base = nullptr;
+  bool pointers_ok = true;
+  size_t count = 0;
+  adc::IAdc* converter = nullptr;
+};
+
+inline void on_half(void* context, const adc::sample_t* samples, size_t count) {
+  Capture* c = static_cast<Capture*>(context);
+  const int i = c->callbacks.load();
+  c->halves[i] = 1;
+  c->first[i] = samples[0];
+  c->pointers_ok = c->pointers_ok && samples == c->base;
+  c->count = count;
+  c->callbacks.store(i + 1); // 停止を観測した側が必ず 3 を読めるよう、止める前に書く
+  if (i + 1 == 3) c->converter->stopContinuous();
+}
+
+inline void on_full(void* context, const adc::sample_t* samples, size_t count) {
+  Capture* c = static_cast<Capture*>(context);
+  const int i = c->callbacks.load();
+  c->halves[i] = 2;
+  c->first[i] = samples[0];
+  c->pointers_ok = c->pointers_ok && samples == c->base + count;
+  c->callbacks.store(i + 1);
+}
+
+// 高速モードで半分・全体のコールバックが交互に来て、内容がスキャン順に並ぶか
+inline bool test_adc_continuous() {
+  native_adc::NativeAdc converter(2, 12);
+  converter.setRealtime(false);
+  adc::sample_t ramp[100];
+  for (int i = 0; i < 100; ++i) ramp[i] = static_cast<adc::sample_t>(i);
+  converter.setSamples(0, ramp, 100, 1000); // スキャンレートと同じ速さで再生
+  converter.setWaveform(1, {Shape::Constant, 0.0, 0.0, 7.0, 0});
+
+  adc::sample_t buffer[32];
+  Capture capture;
+  capture.base      = buffer;
+  capture.converter = &converter;
+  const uint32_t channels[] = {0, 1};
+  const adc::ScanGroup group{channels, 2, 1};
+
+  bool ok = converter.startContinuous(group, {buffer, 30, 1000, on_half, on_full, &capture}) ==
+            flexhal::base::status::param; // 2 * チャンネル数の倍数でない
+  ok = ok && converter.startContinuous(group, {buffer, 32, 1000, on_half, on_full, &capture}) ==
+                 flexhal::base::status::ok;
+  ok = ok && wait_stopped(converter, 2000);
+  ok = ok && capture.callbacks.load() == 3 && capture.pointers_ok && capture.count == 16;
+  ok = ok && capture.halves[0] == 1 && capture.halves[1] == 2 && capture.halves[2] == 1;
+  ok = ok && capture.first[0] == 0 && capture.first[1] == 8 && capture.first[2] == 16;
+  // 3 回目（前半）のスキャン 16..23 が前半に入っている
+  for (int s = 0; ok && s < 8; ++s) {
+    ok = buffer[2 * s] == 16 + s && buffer[2 * s + 1] == 7;
+  }
+  // 自分のコールバックで止めた後も再開できる
+  ok = ok && converter.startContinuous(group, {buffer, 32, 1000, nullptr, nullptr, nullptr}) ==
+                 flexhal::base::status::ok;
+  converter.stopContinuous();
+  return ok && !converter.isContinuousRunning();
+}
+
+// テキストファイルからサンプル列を読み込んで再生できるか
+inline bool test_adc_file() {
+  native_adc::NativeAdc converter(1, 10);
+  converter.setRealtime(false);
+  const std::string path = "/tmp/flexhal_adc_" + std::to_string(getpid()) + ".csv";
+  if (FILE* f = fopen(path.c_str(), "w")) {
+    fputs("# ch0\n10, 20\n30\n5000\n", f);
+    fclose(f);
+  }
+  bool ok = converter.loadSamples(0, path.c_str(), 500) == flexhal::base::status::ok;
+  unlink(path.c_str());
+  ok = ok && converter.loadSamples(0, "/nonexistent/x.csv", 500) == flexhal::base::status::io;
+
+  struct Done {
+    std::atomic<bool> full{false};
+  } done;
+  adc::sample_t buffer[8];
+  const uint32_t channels[] = {0};
+  auto full = [](void* context, const adc::sample_t*, size_t) {
+    static_cast<Done*>(context)->full.store(true);
+  };
+  ok = ok && converter.startContinuous({channels, 1, 1}, {buffer, 8, 500, nullptr, full, &done}) ==
+                 flexhal::base::status::ok;
+  for (int i = 0; i < 2000 && !done.full.load(); ++i) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  converter.stopContinuous();
+  const adc::sample_t expected[] = {10, 20, 30, 1023}; // 10 ビットで飽和
+  for (int i = 0; ok && i < 8; ++i) {
+    ok = buffer[i] == expected[i % 4];
+  }
+  return ok && done.full.load();
+}
+
+// 実時間モードで連続変換中は単発の読み取りが busy になり、コールバックが届いて止められるか
+inline bool test_adc_realtime() {
+  native_adc::NativeAdc converter(4, 12);
+  converter.setWaveform(0, {Shape::Sine, 50.0, 1000.0, 2048.0, 0});
+  struct Counter {
+    std::atomic<uint32_t> halves{0};
+  } counter;
+  auto tick = [](void* context, const adc::sample_t*, size_t) {
+    static_cast<Counter*>(context)->halves.fetch_add(1);
+  };
+  adc::sample_t buffer[4 * 200];
+  const uint32_t channels[] = {0, 1, 2, 3};
+  bool ok = converter.startContinuous({channels, 4, 4}, {buffer, 4 * 200, 10000, tick, tick, &counter}) ==
+            flexhal::base::status::ok;
+  ok = ok && converter.isContinuousRunning();
+  ok = ok && converter.readScan({channels, 4, 1}, buffer) == flexhal::base::status::busy;
+  for (int i = 0; i < 2000 && counter.halves.load() < 2; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  converter.stopContinuous();
+  const uint32_t halves = counter.halves.load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(30));
+  return ok && halves >= 2 && counter.halves.load() == halves && !converter.isContinuousRunning();
+}
+
+} // namespace flexhal_test
+
+TEST(AdcTest, Scan) {
+  EXPECT_TRUE(flexhal_test::test_adc_scan());
+}
+
+TEST(AdcTest, Oversampling) {
+  EXPECT_TRUE(flexhal_test::test_adc_oversampling());
+}
+
+TEST(AdcTest, Continuous) {
+  EXPECT_TRUE(flexhal_test::test_adc_continuous());
+}
+
+TEST(AdcTest, File) {
+  EXPECT_TRUE(flexhal_test::test_adc_file());
+}
+
+TEST(AdcTest, Realtime) {
+  EXPECT_TRUE(flexhal_test::test_adc_realtime());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
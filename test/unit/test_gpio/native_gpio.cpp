@@ -0,0 +1,167 @@
+
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace flexhal_test {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace gpio = flexhal::hal::gpio;
+
+// IPin 経由の書き込みが IPort と共有ブロックの両方から見えるか
+inline bool test_pin_write_read() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  gpio::IPin& pin = port.getPin(3);
+
+  pin.setMode(gpio::PinMode::Output);
+  pin.digitalWrite(true);
+  bool high_ok = (pin.digitalRead() == 1) && (port.read() & (1u << 3));
+  pin.digitalWrite(false);
+  bool low_ok = (pin.digitalRead() == 0) && !(port.read() & (1u << 3));
+  bool mode_ok = (hal_gpio.getBlock().port(0).output.load() & (1u << 3)) != 0;
+  return high_ok && low_ok && mode_ok;
+}
+
+// レベル変化ごとに change_count と timestamp_ns が更新されるか
+inline bool test_change_timestamp() {
+  native_gpio::NativeGpio hal_gpio;
+  native_gpio::PortState& state = hal_gpio.getBlock().port(0);
+  gpio::IPort& port = hal_gpio.getPort(0);
+
+  port.write(0);
+  uint64_t count_before = state.change_count.load();
+  uint64_t t0 = native_gpio::PinStateBlock::now_ns();
+  port.write(0x5);
+  port.write(0x5); // 同じ値の書き込みは変化として数えない
+  port.write(0x0);
+  uint64_t count_after = state.change_count.load();
+  return (count_after - count_before == 2) && (state.timestamp_ns.load() >= t0);
+}
+
+// 関数型APIが既定ブロックのフラットなピン番号で動作するか
+inline bool test_functional_api() {
+  bool ok = native_gpio::pin_mode(5, gpio::PinMode::Output) == flexhal::base::status::ok;
+  ok = ok && native_gpio::digital_write(5, true) == flexhal::base::status::ok;
+  ok = ok && native_gpio::digital_read(5) == 1;
+  ok = ok && native_gpio::digital_write(5, false) == flexhal::base::status::ok;
+  ok = ok && native_gpio::digital_read(5) == 0;
+  // 範囲外のピンはエラー
+  ok = ok && native_gpio::digital_write(1000, true) == flexhal::base::status::param;
+  ok = ok && native_gpio::digital_read(1000) < 0;
+  return ok;
+}
+
+// 名前付き共有メモリで別のブロック（別プロセス相当）から変化が観測できるか
+inline bool test_shared_block() {
+  std::string name = "/flexhal_test_gpio_" + std::to_string(getpid());
+  native_gpio::PinStateBlockConfig config;
+  config.port_count = 2;
+  config.pins_per_port = 16;
+  config.shm_name = name.c_str();
+
+  native_gpio::PinStateBlock writer_block;
+  native_gpio::PinStateBlock observer_block;
+  bool ok = writer_block.open(config) == flexhal::base::status::ok;
+  ok = ok && observer_block.open(config) == flexhal::base::status::ok;
+
+  // ジオメトリが異なる場合は接続できない
+  native_gpio::PinStateBlockConfig mismatch = config;
+  mismatch.port_count = 3;
+  native_gpio::PinStateBlock mismatch_block;
+  ok = ok && mismatch_block.open(mismatch) == flexhal::base::status::param;
+
+  if (ok) {
+    native_gpio::NativeGpio hal_gpio(writer_block);
+    ok = hal_gpio.getNumberOfPorts() == 2 && hal_gpio.getPort(1).getNumberOfPins() == 16;
+    hal_gpio.getPort(1).getPin(15).digitalWrite(true);
+    ok = ok && (observer_block.read(1) == (1u << 15));
+    ok = ok && observer_block.port(1).change_count.load() == 1;
+    // ポート幅を超えるビットは無視される
+    hal_gpio.getPort(1).write(0xFFFFFFFF);
+    ok = ok && (observer_block.read(1) == 0xFFFF);
+  }
+  native_gpio::PinStateBlock::unlink(name.c_str());
+  return ok;
+}
+
+// 作成側が shm_open() した直後（ftruncate() 前、サイズ 0）に接続すると busy になるか
+inline bool test_shared_block_creating() {
+  std::string name = "/flexhal_test_gpio_creating_" + std::to_string(getpid());
+  const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) return false;
+  native_gpio::PinStateBlockConfig config;
+  config.shm_name = name.c_str();
+  native_gpio::PinStateBlock block;
+  const bool ok = block.open(config) == flexhal::base::status::busy && !block.isOpen();
+  ::close(fd);
+  native_gpio::PinStateBlock::unlink(name.c_str());
+  return ok;
+}
+
+// マスク操作が対象ピンだけを変更するか
+inline bool test_port_mask_ops() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+
+  port.write(0xF0F0);
+  bool ok = port.setBits(0x000F) == flexhal::base::status::ok && port.read() == 0xF0FF;
+  ok = ok && port.clearBits(0x00F0) == flexhal::base::status::ok && port.read() == 0xF00F;
+  ok = ok && port.toggleBits(0xFF00) == flexhal::base::status::ok && port.read() == 0x0F0F;
+  ok = ok && port.writeMasked(0x00FF, 0x1234) == flexhal::base::status::ok && port.read() == 0x0F34;
+  port.write(0);
+  return ok;
+}
+
+// 1回のマスク操作は1回の変化として記録されるか
+inline bool test_port_mask_single_change() {
+  native_gpio::NativeGpio hal_gpio;
+  native_gpio::PortState& state = hal_gpio.getBlock().port(0);
+  gpio::IPort& port = hal_gpio.getPort(0);
+
+  port.write(0);
+  uint64_t before = state.change_count.load();
+  port.setBits(0xFF);
+  port.writeMasked(0xFF, 0xFF); // 変化なし
+  port.clearBits(0xFF);
+  return state.change_count.load() - before == 2;
+}
+
+} // namespace flexhal_test
+
+TEST(NativeGpioTest, PinWriteRead) {
+  EXPECT_TRUE(flexhal_test::test_pin_write_read());
+}
+
+TEST(NativeGpioTest, ChangeTimestamp) {
+  EXPECT_TRUE(flexhal_test::test_change_timestamp());
+}
+
+TEST(NativeGpioTest, FunctionalApi) {
+  EXPECT_TRUE(flexhal_test::test_functional_api());
+}
+
+TEST(NativeGpioTest, SharedBlock) {
+  EXPECT_TRUE(flexhal_test::test_shared_block());
+}
+
+TEST(NativeGpioTest, SharedBlockCreating) {
+  EXPECT_TRUE(flexhal_test::test_shared_block_creating());
+}
+
+TEST(NativeGpioTest, PortMaskOps) {
+  EXPECT_TRUE(flexhal_test::test_port_mask_ops());
+}
+
+TEST(NativeGpioTest, PortMaskSingleChange) {
+  EXPECT_TRUE(flexhal_test::test_port_mask_single_change());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
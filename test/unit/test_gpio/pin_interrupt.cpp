@@ -0,0 +1,175 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <atomic>
+#include <thread>
+
+namespace flexhal_test {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace gpio = flexhal::hal::gpio;
+
+struct EventLog {
+  int count = 0;
+  gpio::PinEvent last{};
+};
+
+inline void log_event(void* context, const gpio::PinEvent& event) {
+  auto* log = static_cast<EventLog*>(context);
+  ++log->count;
+  log->last = event;
+}
+
+// 指定したエッジだけでコールバックが呼ばれ、イベントの内容が正しいか
+inline bool test_interrupt_callback() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  gpio::IPin& pin = port.getPin(4);
+  port.write(0);
+  EventLog log;
+  bool ok = pin.attachInterrupt(gpio::PinEdge::Rising, log_event, &log) == flexhal::base::status::ok;
+  pin.digitalWrite(true);
+  ok = ok && log.count == 1 && log.last.pin == 4 && log.last.port == 0 && log.last.level == 1;
+  ok = ok && log.last.timestamp_ns == hal_gpio.getBlock().port(0).timestamp_ns.load();
+  pin.digitalWrite(true);  // 変化なし
+  pin.digitalWrite(false); // 立ち下がりは対象外
+  port.setBits(1u << 5);   // 別のピン
+  ok = ok && log.count == 1;
+  port.toggleBits(1u << 4);
+  ok = ok && log.count == 2;
+  ok = ok && pin.detachInterrupt() == flexhal::base::status::ok;
+  port.write(0);
+  port.write(1u << 4);
+  return ok && log.count == 2;
+}
+
+// Falling / Both の判定と、ポート単位の書き込みで複数ピンが発火するか
+inline bool test_interrupt_edges() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  port.write(0);
+  EventLog falling, both;
+  port.getPin(1).attachInterrupt(gpio::PinEdge::Falling, log_event, &falling);
+  port.getPin(2).attachInterrupt(gpio::PinEdge::Both, log_event, &both);
+  port.write(0x6);
+  bool ok = falling.count == 0 && both.count == 1 && both.last.level == 1;
+  port.writeMasked(0x6, 0x0);
+  ok = ok && falling.count == 1 && falling.last.level == 0 && both.count == 2 && both.last.level == 0;
+  port.getPin(1).detachInterrupt();
+  port.getPin(2).detachInterrupt();
+  return ok;
+}
+
+// キューモード：満杯時は破棄して数え、まとめて取り出せるか
+inline bool test_interrupt_queue() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPin& pin = hal_gpio.getPort(0).getPin(7);
+  pin.digitalWrite(false);
+  gpio::PinEventQueue queue(6); // 8 に切り上げ
+  bool ok = queue.getCapacity() == 8;
+  ok = ok && pin.attachInterrupt(gpio::PinEdge::Both, queue) == flexhal::base::status::ok;
+  for (int i = 0; i < 20; ++i) {
+    pin.digitalWrite(i % 2 == 0);
+  }
+  ok = ok && queue.size() == 8 && queue.getDroppedCount() == 12;
+  gpio::PinEvent events[16];
+  size_t n = queue.pop(events, 16);
+  ok = ok && n == 8 && queue.empty();
+  for (size_t i = 0; i < n; ++i) {
+    ok = ok && events[i].pin == 7 && events[i].level == (i % 2 == 0 ? 1 : 0);
+    if (i > 0) ok = ok && events[i].timestamp_ns >= events[i - 1].timestamp_ns;
+  }
+  gpio::PinEvent event;
+  ok = ok && !queue.pop(event);
+  pin.detachInterrupt();
+  return ok;
+}
+
+// 範囲外のピンや null コールバックは param
+inline bool test_interrupt_param() {
+  native_gpio::PinStateBlock& block = native_gpio::default_block();
+  bool ok = block.attachInterrupt(0, 40, gpio::PinEdge::Rising, log_event, nullptr) == flexhal::base::status::param;
+  ok = ok && block.attachInterrupt(0, 1, gpio::PinEdge::Rising, nullptr, nullptr) == flexhal::base::status::param;
+  return ok && block.detachInterrupt(5, 0) == flexhal::base::status::param;
+}
+
+// 多数のエッジを注入してまとめて取り出しても、取りこぼしがないか
+inline bool test_interrupt_burst(uint32_t edges = 1u << 14) {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPin& pin = hal_gpio.getPort(0).getPin(9);
+  pin.digitalWrite(false);
+  gpio::PinEventQueue queue(1024);
+  pin.attachInterrupt(gpio::PinEdge::Both, queue);
+  gpio::PinEvent events[1024];
+  size_t received = 0;
+  bool ok = true;
+  for (uint32_t i = 0; i < edges; i += 1024) {
+    for (uint32_t j = 0; j < 1024; ++j) pin.digitalWrite((j & 1) == 0);
+    const size_t n = queue.pop(events, 1024);
+    ok = ok && n == 1024 && events[0].level == 1 && events[n - 1].level == 0;
+    received += n;
+  }
+  pin.detachInterrupt();
+  return ok && received == edges && queue.getDroppedCount() == 0;
+}
+
+// 別スレッドから1つずつ注入したエッジが、消費側スレッドに順番どおり届くか
+inline bool test_interrupt_cross_thread(uint32_t edges = 2000) {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPin& pin = hal_gpio.getPort(0).getPin(10);
+  pin.digitalWrite(false);
+  gpio::PinEventQueue queue(64);
+  pin.attachInterrupt(gpio::PinEdge::Both, queue);
+
+  std::atomic<uint32_t> consumed(0);
+  std::atomic<bool> in_order(true);
+  std::thread consumer([&]() {
+    gpio::PinEvent event;
+    while (consumed.load(std::memory_order_relaxed) < edges) {
+      if (queue.pop(event)) {
+        const uint32_t i = consumed.load(std::memory_order_relaxed);
+        if (event.level != ((i & 1) == 0 ? 1 : 0)) in_order.store(false);
+        consumed.fetch_add(1, std::memory_order_release);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  for (uint32_t i = 0; i < edges; ++i) {
+    pin.digitalWrite((i & 1) == 0);
+    while (consumed.load(std::memory_order_acquire) <= i) std::this_thread::yield();
+  }
+  consumer.join();
+  pin.detachInterrupt();
+  return in_order.load() && consumed.load() == edges && queue.getDroppedCount() == 0;
+}
+
+} // namespace flexhal_test
+
+TEST(PinInterruptTest, Callback) {
+  EXPECT_TRUE(flexhal_test::test_interrupt_callback());
+}
+
+TEST(PinInterruptTest, Edges) {
+  EXPECT_TRUE(flexhal_test::test_interrupt_edges());
+}
+
+TEST(PinInterruptTest, Queue) {
+  EXPECT_TRUE(flexhal_test::test_interrupt_queue());
+}
+
+TEST(PinInterruptTest, Param) {
+  EXPECT_TRUE(flexhal_test::test_interrupt_param());
+}
+
+TEST(PinInterruptTest, Burst) {
+  EXPECT_TRUE(flexhal_test::test_interrupt_burst());
+}
+
+TEST(PinInterruptTest, CrossThread) {
+  EXPECT_TRUE(flexhal_test::test_interrupt_cross_thread());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
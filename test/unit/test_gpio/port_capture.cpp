@@ -0,0 +1,167 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+namespace flexhal_test {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace gpio = flexhal::hal::gpio;
+
+// 変化したときだけレコードが増え、マスク外のピンは無視されるか
+inline bool test_capture_rle() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  port.write(0);
+  gpio::CaptureRecord buffer[16];
+  gpio::PortCapture capture(port, buffer, 16, 0x3);
+  capture.start();
+  for (int i = 0; i < 100; ++i) capture.sample(); // 変化なし
+  port.write(0x1);
+  capture.sample();
+  port.write(0x1 | 0x100); // マスク外
+  capture.sample();
+  port.write(0x3);
+  capture.sample();
+  capture.stop();
+  bool ok = capture.getRecordCount() == 3 && capture.getSampleCount() == 104 && !capture.overflowed();
+  ok = ok && buffer[0].value == 0 && buffer[1].value == 0x1 && buffer[2].value == 0x3;
+  ok = ok && buffer[0].time_us == 0 && buffer[1].time_us <= buffer[2].time_us;
+  return ok && buffer[2].time_us <= capture.getDuration_us() && !capture.isRunning();
+}
+
+// バッファが一杯になると停止して overflowed になるか
+inline bool test_capture_overflow() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  port.write(0);
+  gpio::CaptureRecord buffer[3];
+  gpio::PortCapture capture(port, buffer, 3, 0x1);
+  capture.start();
+  bool ok = true;
+  for (int i = 1; i <= 2; ++i) {
+    port.write(i & 1);
+    ok = ok && capture.sample();
+  }
+  port.write(1);
+  ok = ok && !capture.sample() && capture.overflowed() && !capture.isRunning();
+  return ok && capture.getRecordCount() == 3;
+}
+
+// ピンのエッジ割り込みからキャプチャできるか
+inline bool test_capture_interrupt() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  port.write(0);
+  gpio::CaptureRecord buffer[16];
+  gpio::PortCapture capture(port, buffer, 16, 0x6);
+  capture.start();
+  port.getPin(1).attachInterrupt(gpio::PinEdge::Both, gpio::PortCapture::interruptCallback, &capture);
+  port.getPin(2).attachInterrupt(gpio::PinEdge::Both, gpio::PortCapture::interruptCallback, &capture);
+  port.write(0x2);
+  port.write(0x6);
+  port.write(0x4);
+  port.write(0x0);
+  port.getPin(1).detachInterrupt();
+  port.getPin(2).detachInterrupt();
+  capture.stop();
+  const uint32_t expected[] = {0x0, 0x2, 0x6, 0x4, 0x0};
+  bool ok = capture.getRecordCount() == 5;
+  for (size_t i = 0; ok && i < 5; ++i) ok = buffer[i].value == expected[i];
+  return ok;
+}
+
+// read() の呼び出し回数で値が変わる疑似ポート（固定レートの検証用）
+class CountingPort : public gpio::IPort {
+public:
+  explicit CountingPort(gpio::IPort& inner) : _inner(inner) {}
+  gpio::IGpio& getGpio() override { return _inner.getGpio(); }
+  const gpio::IGpio& getGpio() const override { return _inner.getGpio(); }
+  uint32_t getPortIndex() const override { return 0; }
+  uint32_t getNumberOfPins() const override { return 32; }
+  flexhal::base::status write(uint32_t) override { return flexhal::base::status::unsupported; }
+  uint32_t read() const override { return (_reads++ / 10) & 1u; }
+  gpio::IPin& getPin(uint32_t index) override { return _inner.getPin(index); }
+  const gpio::IPin& getPin(uint32_t index) const override { return _inner.getPin(index); }
+
+private:
+  gpio::IPort& _inner;
+  mutable uint32_t _reads = 0;
+};
+
+// 固定レートでは時刻が周期の倍数になり、サンプル数が期間/周期と一致するか
+inline bool test_capture_fixed_rate() {
+  native_gpio::NativeGpio hal_gpio;
+  CountingPort port(hal_gpio.getPort(0));
+  gpio::CaptureRecord buffer[64];
+  gpio::PortCapture capture(port, buffer, 64, 0x1);
+  bool ok = capture.captureFixedRate(0, 1000) == flexhal::base::status::param;
+  ok = ok && capture.captureFixedRate(50, 10000) == flexhal::base::status::ok;
+  ok = ok && capture.getSampleCount() + capture.getMissedSamples() == 201 && capture.getDuration_us() == 10000;
+  for (size_t i = 0; ok && i < capture.getRecordCount(); ++i) {
+    ok = buffer[i].time_us % 50 == 0 && buffer[i].value == (i & 1);
+  }
+  return ok && capture.getRecordCount() >= 2;
+}
+
+// VCD ファイルとして書き出せるか
+inline bool test_capture_vcd() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  port.write(0);
+  gpio::CaptureRecord buffer[8];
+  gpio::PortCapture capture(port, buffer, 8, 0x3);
+  capture.start();
+  port.write(0x1);
+  capture.sample();
+  port.write(0x2);
+  capture.sample();
+  capture.stop();
+
+  const char* names[32] = {"sda", nullptr};
+  std::string path = "/tmp/flexhal_capture_" + std::to_string(getpid()) + ".vcd";
+  if (native_gpio::write_vcd(path.c_str(), capture, names) != flexhal::base::status::ok) return false;
+  std::string text;
+  if (FILE* f = fopen(path.c_str(), "r")) {
+    char chunk[256];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) text.append(chunk, n);
+    fclose(f);
+  }
+  unlink(path.c_str());
+  bool ok = text.find("$timescale 1us $end") != std::string::npos;
+  ok = ok && text.find("$var wire 1 ! sda $end") != std::string::npos;
+  ok = ok && text.find("$var wire 1 \" p1 $end") != std::string::npos;
+  ok = ok && text.find("#0\n$dumpvars\n0!\n0\"\n$end\n") != std::string::npos;
+  // 2 つ目の変化では両方のピンが変わる
+  ok = ok && text.find("\n0!\n1\"\n") != std::string::npos;
+  return ok && native_gpio::write_vcd("/nonexistent/dir/x.vcd", capture) == flexhal::base::status::io;
+}
+
+} // namespace flexhal_test
+
+TEST(PortCaptureTest, RunLength) {
+  EXPECT_TRUE(flexhal_test::test_capture_rle());
+}
+
+TEST(PortCaptureTest, Overflow) {
+  EXPECT_TRUE(flexhal_test::test_capture_overflow());
+}
+
+TEST(PortCaptureTest, Interrupt) {
+  EXPECT_TRUE(flexhal_test::test_capture_interrupt());
+}
+
+TEST(PortCaptureTest, FixedRate) {
+  EXPECT_TRUE(flexhal_test::test_capture_fixed_rate());
+}
+
+TEST(PortCaptureTest, Vcd) {
+  EXPECT_TRUE(flexhal_test::test_capture_vcd());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
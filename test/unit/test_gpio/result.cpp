@@ -0,0 +1,110 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <type_traits>
+
+namespace flexhal_test {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace gpio = flexhal::hal::gpio;
+
+using flexhal::base::result;
+using flexhal::base::status;
+
+// 値・エラー・付加情報つきの正常系
+inline bool test_result_basics() {
+  static_assert(std::is_trivially_copyable<result<bool>>::value, "result<bool> must be trivially copyable");
+  static_assert(sizeof(result<uint32_t>) == 8, "result<uint32_t> must fit in one 64-bit register");
+
+  constexpr result<uint32_t> value(42u);
+  constexpr result<uint32_t> failed(status::timeout);
+  constexpr result<uint32_t> pending(status::pending, 7u);
+  static_assert(value.ok() && value.value() == 42 && value.error() == status::ok, "constexpr value");
+  static_assert(!failed.ok() && failed.value() == 0 && failed.value_or(9) == 9, "constexpr error");
+
+  bool ok = static_cast<bool>(value) && !failed && failed.error() == status::timeout;
+  ok = ok && pending.ok() && pending.error() == status::pending && pending.value_or(0) == 7;
+  return ok;
+}
+
+// 番兵値を返すだけのピン（既定の tryDigitalRead / tryAnalogRead の変換を確認する）
+class SentinelPin : public gpio::IPin {
+public:
+  explicit SentinelPin(gpio::IPort& port) : _port(port) {}
+
+  gpio::IPort& getPort() override {
+    return _port;
+  }
+  const gpio::IPort& getPort() const override {
+    return _port;
+  }
+  uint32_t getPinIndex() const override {
+    return 0;
+  }
+  status setMode(gpio::PinMode) override {
+    return status::ok;
+  }
+  status setConfig(const gpio::PinConfig&) override {
+    return status::ok;
+  }
+  status digitalWrite(bool) override {
+    return status::ok;
+  }
+  int digitalRead() const override {
+    return level;
+  }
+
+  int level = 1;
+
+private:
+  gpio::IPort& _port;
+};
+
+// GPIO の try* は 1 回の呼び出しで値とエラーを返すか
+inline bool test_gpio_try_read() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  gpio::IPin& pin = port.getPin(4);
+  pin.setMode(gpio::PinMode::Output);
+
+  pin.digitalWrite(true);
+  result<bool> level = pin.tryDigitalRead();
+  bool ok = level.ok() && level.value();
+  pin.digitalWrite(false);
+  level = pin.tryDigitalRead();
+  ok = ok && level.ok() && !level.value();
+
+  port.write(0xA5);
+  const result<uint32_t> bits = port.tryRead();
+  ok = ok && bits.ok() && bits.value() == port.read();
+
+  // アナログ入力のないピンは unsupported
+  const result<uint32_t> analog = pin.tryAnalogRead();
+  ok = ok && !analog && analog.error() == status::unsupported;
+
+  // 既定実装は digitalRead() の番兵値を status に変換する
+  SentinelPin sentinel(port);
+  ok = ok && sentinel.tryDigitalRead().value();
+  sentinel.level = static_cast<int>(status::io);
+  ok = ok && sentinel.tryDigitalRead().error() == status::io;
+
+  // StaticPin も同じ形で使える（範囲外のピンは param）
+  native_gpio::pin_mode(6, gpio::PinMode::Output);
+  native_gpio::digital_write(6, true);
+  ok = ok && gpio::StaticPin<6>::tryDigitalRead().value();
+  return ok && gpio::StaticPin<255>::tryDigitalRead().error() == status::param;
+}
+
+} // namespace flexhal_test
+
+TEST(ResultTest, Basics) {
+  EXPECT_TRUE(flexhal_test::test_result_basics());
+}
+
+TEST(ResultTest, GpioTryRead) {
+  EXPECT_TRUE(flexhal_test::test_gpio_try_read());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,74 @@
+
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+namespace flexhal_test {
+
+namespace gpio = flexhal::hal::gpio;
+
+// IPin& と StaticPin<N> のどちらでも受け付ける汎用ドライバの例
+template <typename Pin>
+inline int pulse_count(Pin& pin, int count) {
+  static_assert(gpio::is_pin_like<Pin>::value, "Pin must be pin-like");
+  int highs = 0;
+  for (int i = 0; i < count; ++i) {
+    pin.digitalWrite(true);
+    highs += pin.digitalRead();
+    pin.digitalWrite(false);
+  }
+  return highs;
+}
+
+struct NotAPin {
+  void digitalWrite(bool) {}
+};
+
+inline bool test_traits() {
+  return gpio::is_pin_like<gpio::IPin>::value &&
+         gpio::is_pin_like<gpio::StaticPin<1>>::value &&
+         !gpio::is_pin_like<NotAPin>::value &&
+         !gpio::is_pin_like<int>::value &&
+         std::is_empty<gpio::StaticPin<1>>::value;
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+
+// StaticPin の書き込みが同じピンの IPin から観測できるか
+inline bool test_static_pin_native() {
+  gpio::StaticPin<9> led;
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPin& same_pin = hal_gpio.getPort(0).getPin(9);
+
+  bool ok = led.setMode(gpio::PinMode::Output) == flexhal::base::status::ok;
+  ok = ok && led.digitalWrite(true) == flexhal::base::status::ok;
+  ok = ok && same_pin.digitalRead() == 1;
+  same_pin.digitalWrite(false);
+  ok = ok && led.digitalRead() == 0;
+  return ok;
+}
+
+// 同じ汎用ドライバが両方の型で動作するか
+inline bool test_generic_driver() {
+  gpio::StaticPin<10> static_pin;
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPin& dynamic_pin = hal_gpio.getPort(0).getPin(11);
+  return pulse_count(static_pin, 5) == 5 && pulse_count(dynamic_pin, 5) == 5;
+}
+#endif
+
+} // namespace flexhal_test
+
+TEST(StaticPinTest, Traits) {
+  EXPECT_TRUE(flexhal_test::test_traits());
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+TEST(StaticPinTest, NativeBackend) {
+  EXPECT_TRUE(flexhal_test::test_static_pin_native());
+}
+
+TEST(StaticPinTest, GenericDriver) {
+  EXPECT_TRUE(flexhal_test::test_generic_driver());
+}
+#endif
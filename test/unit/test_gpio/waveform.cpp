@@ -0,0 +1,75 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <vector>
+
+namespace flexhal_test {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace gpio = flexhal::hal::gpio;
+
+struct EdgeTimes {
+  std::vector<uint64_t> ns;
+};
+
+inline void record_edge(void* context, const gpio::PinEvent& event) {
+  static_cast<EdgeTimes*>(context)->ns.push_back(event.timestamp_ns);
+}
+
+// パターンの全ステップが順番どおりに出力され、統計が報告されるか
+inline bool test_waveform_steps() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  port.write(0);
+  const gpio::WaveStep steps[] = {
+      {0x3, 0x1, 1000}, {0x3, 0x3, 1000}, {0x3, 0x2, 1000}, {0x3, 0x0, 1000},
+  };
+  gpio::WaveformPlayer player(port);
+  bool ok = player.play(nullptr, 1) == flexhal::base::status::param;
+  ok = ok && player.play(steps, 4, 0) == flexhal::base::status::param;
+  gpio::CaptureRecord buffer[32];
+  gpio::PortCapture capture(port, buffer, 32, 0x3);
+  capture.start();
+  port.getPin(0).attachInterrupt(gpio::PinEdge::Both, gpio::PortCapture::interruptCallback, &capture);
+  port.getPin(1).attachInterrupt(gpio::PinEdge::Both, gpio::PortCapture::interruptCallback, &capture);
+  ok = ok && player.play(steps, 4, 3) == flexhal::base::status::ok;
+  port.getPin(0).detachInterrupt();
+  port.getPin(1).detachInterrupt();
+  capture.stop();
+  const gpio::WaveformStats& stats = player.getStats();
+  ok = ok && stats.steps == 12 && stats.duration_ns >= 12000 && capture.getRecordCount() == 13;
+  for (size_t i = 1; ok && i < capture.getRecordCount(); ++i) {
+    ok = buffer[i].value == steps[(i - 1) % 4].value;
+  }
+  return ok;
+}
+
+// calibrate() は実際にピンを反転させて計測し、終了後に元の値へ戻すか
+inline bool test_waveform_calibrate() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  gpio::IPin& pin = port.getPin(6);
+  pin.setMode(gpio::PinMode::Output);
+  pin.digitalWrite(true);
+
+  EdgeTimes edges;
+  gpio::WaveformPlayer player(port);
+  pin.attachInterrupt(gpio::PinEdge::Both, record_edge, &edges);
+  const uint32_t lead = player.calibrate(32, 1u << 6);
+  pin.detachInterrupt();
+  return lead > 0 && lead == player.getWriteLead_ns() && edges.ns.size() == 32 && pin.digitalRead() == 1;
+}
+
+} // namespace flexhal_test
+
+TEST(WaveformTest, Steps) {
+  EXPECT_TRUE(flexhal_test::test_waveform_steps());
+}
+
+TEST(WaveformTest, Calibrate) {
+  EXPECT_TRUE(flexhal_test::test_waveform_calibrate());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
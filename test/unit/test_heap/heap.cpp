@@ -0,0 +1,151 @@
+// ライブラリの operator new フックを使うので、FLEXHAL_NO_HEAP_AFTER_INIT つきでビルドする
+// （pio test -e test_heap_native）。通常の unit ビルドでは何もしない
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE && defined(FLEXHAL_NO_HEAP_AFTER_INIT)
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace flexhal_test {
+
+namespace heap = flexhal::utils::heap;
+namespace logger = flexhal::utils::logger;
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+
+// 確保が最適化で消されないように、ポインタを外へ出す
+void* volatile heap_escape = nullptr;
+
+std::atomic<int> heap_violations{0};
+const char* heap_violation_subsystem = nullptr;
+
+inline void count_violation(const char* subsystem, size_t size) {
+  heap_violation_subsystem = subsystem;
+  heap_violations.fetch_add(1);
+  (void)size;
+}
+
+// 固定長バッファに書くだけのロガー（確保しない）
+class BufferLogger : public logger::ILogger {
+public:
+  void log(logger::LogLevel level, const char* tag, const char* format, std::va_list args) override {
+    vsnprintf(text, sizeof(text), format, args);
+    ++count;
+    (void)level;
+    (void)tag;
+  }
+
+  char text[64] = {};
+  int count     = 0;
+};
+
+inline void log_tick(logger::ILogger& target, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  target.log(logger::LogLevel::INFO, "HEAP", format, args);
+  va_end(args);
+}
+
+// 初期化中の確保はサブシステムごとに数えられるか
+inline bool test_heap_subsystems() {
+  heap::reset();
+  bool ok = !heap::is_init_complete();
+  {
+    FLEXHAL_HEAP_SCOPE("outer");
+    std::unique_ptr<int> a(new int(1));
+    {
+      FLEXHAL_HEAP_SCOPE("inner");
+      std::unique_ptr<int[]> b(new int[4]);
+      heap_escape = b.get();
+    }
+    std::unique_ptr<int> c(new int(2));
+    heap_escape = a.get();
+    heap_escape = c.get();
+  }
+  const heap::SubsystemStats outer = heap::get_subsystem_stats("outer");
+  const heap::SubsystemStats inner = heap::get_subsystem_stats("inner");
+  ok = ok && outer.allocations == 2 && outer.bytes == 2 * sizeof(int) && outer.after_init == 0;
+  ok = ok && inner.allocations == 1 && inner.bytes == 4 * sizeof(int);
+  ok = ok && heap::get_subsystem_stats("unknown").allocations == 0;
+  ok = ok && heap::get_allocation_count() >= 3 && heap::get_free_count() >= 3;
+
+  // 名前はポインタではなく内容で比較する
+  char name[] = "outer";
+  {
+    FLEXHAL_HEAP_SCOPE(name);
+    std::unique_ptr<int> d(new int(3));
+    heap_escape = d.get();
+  }
+  ok = ok && heap::get_subsystem_stats("outer").allocations == 3;
+  heap::reset();
+  return ok;
+}
+
+// 初期化後のホットパス（GPIO の読み書き、非同期ログ）は確保しないか
+inline bool test_heap_no_alloc_after_init() {
+  heap::reset();
+  heap_violations = 0;
+  heap::set_violation_handler(count_violation);
+
+  BufferLogger sink;
+  native_gpio::NativeGpio gpio;
+  logger::AsyncLogger async(sink, 16);
+  flexhal::hal::gpio::IPort& port = gpio.getPort(0);
+  flexhal::hal::gpio::IPin& pin   = port.getPin(3);
+  bool ok = pin.setMode(flexhal::hal::gpio::PinMode::Output) == flexhal::base::status::ok;
+  ok = ok && heap::get_subsystem_stats("gpio").allocations > 0;
+  ok = ok && heap::get_subsystem_stats("logger").allocations == 1;
+
+  heap::mark_init_complete();
+  ok = ok && heap::is_init_complete();
+  for (int i = 0; i < 100; ++i) {
+    pin.digitalWrite(i & 1);
+    ok = ok && pin.digitalRead() == (i & 1);
+    port.write(static_cast<uint32_t>(i));
+    ok = ok && port.read() == static_cast<uint32_t>(i);
+    log_tick(async, "tick %d", i);
+    if ((i & 7) == 7) async.drain();
+  }
+  async.flush();
+  ok = ok && sink.count == 100 && strcmp(sink.text, "tick 99") == 0;
+  ok = ok && heap::get_post_init_allocation_count() == 0 && heap_violations == 0;
+
+  // 初期化後にわざと確保すると違反として報告される
+  {
+    FLEXHAL_HEAP_SCOPE("late");
+    std::unique_ptr<int> late(new int(0));
+    heap_escape = late.get();
+  }
+  ok = ok && heap_violations == 1 && strcmp(heap_violation_subsystem, "late") == 0;
+  ok = ok && heap::get_post_init_allocation_count() == 1 && heap::get_subsystem_stats("late").after_init == 1;
+
+  // alignas(64) のメンバを持つ型（align_val_t 版の operator new）も同じフックを通る
+  {
+    FLEXHAL_HEAP_SCOPE("aligned");
+    std::unique_ptr<logger::AsyncLogger> aligned(new logger::AsyncLogger(sink, 4));
+    heap_escape = aligned.get();
+    ok = ok && reinterpret_cast<uintptr_t>(aligned.get()) % alignof(logger::AsyncLogger) == 0;
+  }
+  ok = ok && heap_violations >= 2 && heap::get_subsystem_stats("aligned").after_init >= 1;
+  ok = ok && heap::get_subsystem_stats("aligned").bytes >= sizeof(logger::AsyncLogger);
+
+  heap::set_violation_handler(nullptr);
+  heap::reset();
+  return ok;
+}
+
+} // namespace flexhal_test
+
+TEST(HeapTest, Subsystems) {
+  EXPECT_TRUE(flexhal_test::test_heap_subsystems());
+}
+
+TEST(HeapTest, NoAllocationAfterInit) {
+  EXPECT_TRUE(flexhal_test::test_heap_no_alloc_after_init());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE && FLEXHAL_NO_HEAP_AFTER_INIT
@@ -0,0 +1,278 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <vector>
+
+namespace flexhal_test {
+
+namespace native_i2c = flexhal::internal::platform::native::hal::i2c;
+namespace i2c = flexhal::hal::i2c;
+
+using flexhal::base::status;
+
+// レジスタの読み書きと、存在しないデバイスの NACK
+inline bool test_i2c_registers() {
+  native_i2c::NativeI2c bus;
+  native_i2c::I2cRegisterDevice sensor;
+  bool ok = bus.attachDevice(0x48, sensor) == status::ok && bus.attachDevice(0x80, sensor) == status::param;
+
+  ok = ok && bus.writeRegister(0x48, 0x10, 0xAB) == status::ok && sensor.getRegister(0x10) == 0xAB;
+  sensor.setRegister(0x11, 0xCD);
+  uint8_t data[2] = {};
+  ok = ok && bus.readRegisters(0x48, 0x10, data, 2) == status::ok && data[0] == 0xAB && data[1] == 0xCD;
+
+  // 自動インクリメントなしでは同じレジスタを読み続ける
+  sensor.setAutoIncrement(false);
+  ok = ok && bus.readRegisters(0x48, 0x10, data, 2) == status::ok && data[0] == 0xAB && data[1] == 0xAB;
+
+  ok = ok && bus.readRegisters(0x49, 0x00, data, 1) == status::not_found;
+  sensor.setNack(true);
+  ok = ok && bus.writeRegister(0x48, 0x00, 1) == status::not_found;
+
+  i2c::I2cTransaction empty;
+  empty.address = 0x48;
+  ok = ok && bus.submit(empty) == status::param;
+  return ok && bus.isIdle() && bus.getBusStats().stops == 5;
+}
+
+struct Completion {
+  std::vector<int> order; // address * 16 + register
+};
+
+inline void record_completion(void* context, i2c::I2cTransaction& transaction, status result) {
+  Completion* completion = static_cast<Completion*>(context);
+  completion->order.push_back(result == status::ok ? transaction.address * 16 + transaction.write[0] : -1);
+}
+
+// 3 デバイスへ交互に投入した 12 個のレジスタ読み出しが、デバイスごとに
+// 1 メッセージへまとめられ、STOP 1 回で実行されるか
+inline bool test_i2c_scheduler() {
+  native_i2c::NativeI2c bus;
+  native_i2c::I2cRegisterDevice devices[3];
+  const uint16_t addresses[3] = {0x30, 0x10, 0x20};
+  for (int d = 0; d < 3; ++d) {
+    bus.attachDevice(addresses[d], devices[d]);
+    for (int r = 0; r < 4; ++r) devices[d].setRegister(static_cast<uint8_t>(r), static_cast<uint8_t>(addresses[d] + r));
+  }
+
+  Completion completion;
+  static const uint8_t registers[4] = {0, 1, 2, 3};
+  uint8_t values[12] = {};
+  i2c::I2cTransaction transactions[12];
+  for (int i = 0; i < 12; ++i) {
+    i2c::I2cTransaction& t = transactions[i];
+    t.address      = addresses[i % 3];
+    t.write        = &registers[i / 3];
+    t.write_length = 1;
+    t.read         = &values[i];
+    t.read_length  = 1;
+    t.flags        = i2c::I2cTransaction::auto_increment;
+    t.callback     = record_completion;
+    t.context      = &completion;
+  }
+  bool ok = bus.submitBatch(transactions, 12) == status::ok && !bus.isIdle();
+  bus.poll();
+  ok = ok && bus.isIdle();
+  for (int i = 0; ok && i < 12; ++i) {
+    ok = transactions[i].result.load() == status::ok && values[i] == addresses[i % 3] + i / 3;
+  }
+
+  const i2c::I2cBusStats& stats = bus.getBusStats();
+  ok = ok && stats.batches == 1 && stats.messages == 3 && stats.merged == 9;
+  ok = ok && stats.stops == 1 && stats.repeated_starts == 2;
+  for (auto& device : devices) ok = ok && device.getAccessCount() == 2; // 書き込み + 読み出し
+
+  // アドレス順にまとめられ、デバイス内では投入順のまま
+  ok = ok && completion.order.size() == 12;
+  for (size_t i = 0; ok && i < completion.order.size(); ++i) {
+    const int expected_address = 0x10 * static_cast<int>(i / 4 + 1);
+    ok = completion.order[i] == expected_address * 16 + static_cast<int>(i % 4);
+  }
+
+  // マージ無効・repeated start 無効ではトランザクションごとに STOP
+  bus.resetStats();
+  bus.setMergeReads(false);
+  bus.setRepeatedStart(false);
+  ok = ok && bus.submitBatch(transactions, 12) == status::ok;
+  bus.poll();
+  return ok && bus.getBusStats().messages == 12 && bus.getBusStats().stops == 12 && bus.getBusStats().merged == 0;
+}
+
+// デバイスごとの統計（レイテンシ・エラー）と、失敗後のバッチ継続
+inline bool test_i2c_stats() {
+  native_i2c::NativeI2c bus;
+  native_i2c::I2cRegisterDevice present;
+  bus.attachDevice(0x20, present);
+
+  static const uint8_t reg = 0;
+  uint8_t data[4]          = {};
+  i2c::I2cTransaction transactions[3];
+  for (int i = 0; i < 3; ++i) {
+    transactions[i].address      = (i == 1) ? 0x21 : 0x20; // 0x21 は存在しない
+    transactions[i].write        = &reg;
+    transactions[i].write_length = 1;
+    transactions[i].read         = data;
+    transactions[i].read_length  = 4;
+  }
+  bool ok = bus.submitBatch(transactions, 3) == status::ok;
+  bus.poll();
+  ok = ok && transactions[0].result.load() == status::ok && transactions[1].result.load() == status::not_found &&
+       transactions[2].result.load() == status::ok;
+
+  const i2c::I2cDeviceStats* good = bus.getDeviceStats(0x20);
+  const i2c::I2cDeviceStats* bad  = bus.getDeviceStats(0x21);
+  ok = ok && good != nullptr && bad != nullptr && bus.getDeviceStats(0x22) == nullptr;
+  ok = ok && good->transactions == 2 && good->errors == 0 && good->bytes == 10 && bad->errors == 1;
+  ok = ok && good->min_latency_ns <= good->max_latency_ns && good->total_latency_ns >= good->max_latency_ns;
+
+  // アドレス順に 0x20, 0x20, 0x21（失敗で解放）: STOP は 1 回
+  ok = ok && bus.getBusStats().stops == 1 && bus.getBusStats().repeated_starts == 2;
+  bus.resetStats();
+  return ok && bus.getDeviceStats(0x20) == nullptr && bus.getBusStats().messages == 0;
+}
+
+struct Sensor {
+  uint8_t samples = 0;
+  uint8_t config  = 0;
+};
+
+inline uint8_t sensor_read(void* context, uint8_t reg, uint8_t value) {
+  Sensor* sensor = static_cast<Sensor*>(context);
+  return reg == 0x00 ? ++sensor->samples : value; // 読むたびに変わるデータレジスタ
+}
+
+inline void sensor_write(void* context, uint8_t reg, uint8_t value) {
+  if (reg == 0x7F) static_cast<Sensor*>(context)->config = value;
+}
+
+// フックでセンサーの振る舞いを記述できるか
+inline bool test_i2c_hooks() {
+  native_i2c::NativeI2c bus;
+  native_i2c::I2cRegisterDevice device(128);
+  Sensor sensor;
+  device.setReadHook(sensor_read, &sensor);
+  device.setWriteHook(sensor_write, &sensor);
+  bus.attachDevice(0x68, device);
+
+  uint8_t value = 0;
+  bool ok = bus.readRegisters(0x68, 0x00, &value, 1) == status::ok && value == 1;
+  ok = ok && bus.readRegisters(0x68, 0x00, &value, 1) == status::ok && value == 2;
+  ok = ok && bus.writeRegister(0x68, 0x7F, 0x42) == status::ok && sensor.config == 0x42;
+
+  // 末尾で折り返す自動インクリメント（0x7F → 0x00）
+  uint8_t wrap[2] = {};
+  ok = ok && bus.readRegisters(0x68, 0x7F, wrap, 2) == status::ok && wrap[0] == 0x42 && wrap[1] == 3;
+  return ok;
+}
+
+// バッチはデバイスごとの連続読み出しにまとめられ、1 つずつ転送するよりバス時間が短いか
+inline bool test_i2c_batching(int rounds = 4) {
+  native_i2c::NativeI2c bus(400000);
+  native_i2c::I2cRegisterDevice devices[4];
+  for (int d = 0; d < 4; ++d) bus.attachDevice(static_cast<uint16_t>(0x40 + d), devices[d]);
+
+  static const uint8_t registers[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  uint8_t values[32] = {};
+  i2c::I2cTransaction transactions[32];
+  for (int i = 0; i < 32; ++i) {
+    transactions[i].address      = static_cast<uint16_t>(0x40 + i % 4);
+    transactions[i].write        = &registers[i / 4];
+    transactions[i].write_length = 1;
+    transactions[i].read         = &values[i];
+    transactions[i].read_length  = 1;
+    transactions[i].flags        = i2c::I2cTransaction::auto_increment;
+  }
+
+  bool ok = true;
+  uint64_t bus_ns[2] = {};
+  for (bool batched : {false, true}) {
+    bus.resetStats();
+    bus.resetBusTime();
+    for (int r = 0; r < rounds; ++r) {
+      if (batched) {
+        ok = ok && bus.submitBatch(transactions, 32) == status::ok;
+        bus.poll();
+      } else {
+        for (auto& t : transactions) ok = ok && bus.transfer(t) == status::ok;
+      }
+    }
+    bus_ns[batched] = bus.getBusTime_ns();
+    ok = ok && bus.getBusStats().messages == static_cast<uint32_t>(rounds * (batched ? 4 : 32));
+  }
+  return ok && bus_ns[1] > 0 && bus_ns[1] < bus_ns[0];
+}
+
+// コールバックからのブロッキング呼び出しは待ち続けずに busy を返し、submit() は同じ poll() で実行される
+struct Chained {
+  i2c::II2c* bus;
+  status blocking = status::ok;
+  i2c::I2cTransaction next;
+  uint8_t value = 0;
+};
+
+inline void chain_from_callback(void* context, i2c::I2cTransaction& transaction, status result) {
+  Chained* chained  = static_cast<Chained*>(context);
+  uint8_t value     = 0;
+  chained->blocking = chained->bus->readRegisters(0x48, 0x01, &value, 1);
+  chained->bus->submit(chained->next);
+  (void)transaction;
+  (void)result;
+}
+
+inline bool test_i2c_callback_reentry() {
+  native_i2c::NativeI2c bus;
+  native_i2c::I2cRegisterDevice sensor;
+  bus.attachDevice(0x48, sensor);
+  sensor.setRegister(0x01, 0x5A);
+
+  static const uint8_t reg = 0x01;
+  Chained chained;
+  chained.bus               = &bus;
+  chained.next.address      = 0x48;
+  chained.next.write        = &reg;
+  chained.next.write_length = 1;
+  chained.next.read         = &chained.value;
+  chained.next.read_length  = 1;
+
+  uint8_t data = 0;
+  i2c::I2cTransaction first;
+  first.address      = 0x48;
+  first.write        = &reg;
+  first.write_length = 1;
+  first.read         = &data;
+  first.read_length  = 1;
+  first.callback     = chain_from_callback;
+  first.context      = &chained;
+  bool ok = !bus.isPolling() && bus.transfer(first) == status::ok && data == 0x5A;
+  return ok && chained.blocking == status::busy && chained.next.isDone() && chained.value == 0x5A && bus.isIdle();
+}
+
+} // namespace flexhal_test
+
+TEST(I2cTest, Registers) {
+  EXPECT_TRUE(flexhal_test::test_i2c_registers());
+}
+
+TEST(I2cTest, Scheduler) {
+  EXPECT_TRUE(flexhal_test::test_i2c_scheduler());
+}
+
+TEST(I2cTest, Stats) {
+  EXPECT_TRUE(flexhal_test::test_i2c_stats());
+}
+
+TEST(I2cTest, Hooks) {
+  EXPECT_TRUE(flexhal_test::test_i2c_hooks());
+}
+
+TEST(I2cTest, CallbackReentry) {
+  EXPECT_TRUE(flexhal_test::test_i2c_callback_reentry());
+}
+
+TEST(I2cTest, Batching) {
+  EXPECT_TRUE(flexhal_test::test_i2c_batching());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
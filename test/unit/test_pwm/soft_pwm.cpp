@@ -0,0 +1,209 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace flexhal_test {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace gpio = flexhal::hal::gpio;
+namespace pwm = flexhal::hal::pwm;
+
+// 同じデューティ・同じポートのエッジがまとめられ、1周期の書き込み数が最小になるか
+inline bool test_pwm_schedule() {
+  native_gpio::PinStateBlock block;
+  native_gpio::PinStateBlockConfig config;
+  config.port_count = 2;
+  if (block.open(config) != flexhal::base::status::ok) return false;
+  native_gpio::NativeGpio hal_gpio(block);
+  gpio::IPort& port0 = hal_gpio.getPort(0);
+  gpio::IPort& port1 = hal_gpio.getPort(1);
+
+  pwm::SoftPwm soft(8, 1000, 256);
+  int ch[6];
+  ch[0] = soft.addChannel(port0, 0);
+  ch[1] = soft.addChannel(port0, 1);
+  ch[2] = soft.addChannel(port0, 2);
+  ch[3] = soft.addChannel(port1, 0);
+  ch[4] = soft.addChannel(port1, 1);
+  ch[5] = soft.addChannel(port1, 2);
+  bool ok = soft.addChannel(port0, 1) == static_cast<int>(flexhal::base::status::param); // 使用済み
+  ok = ok && soft.addChannel(port0, 40) == static_cast<int>(flexhal::base::status::param);
+  ok = ok && soft.setDuty(99, 1) == flexhal::base::status::param;
+  soft.setDuty(ch[0], 64);
+  soft.setDuty(ch[1], 64);  // ch0 とまとめられる
+  soft.setDuty(ch[2], 999); // 256 に丸められ、常時 High
+  soft.setDuty(ch[3], 64);  // 別ポートなので別の書き込み
+  soft.setDuty(ch[4], 128);
+  soft.setDuty(ch[5], 0);   // 常時 Low
+  soft.poll();
+  ok = ok && soft.getDuty(ch[2]) == 256 && soft.getWritesPerPeriod() == 2 + 3;
+  ok = ok && (port0.read() & 0x7) == 0x7 && (port1.read() & 0x7) == 0x3;
+  soft.stop();
+  ok = ok && (port0.read() & 0x7) == 0 && (port1.read() & 0x7) == 0;
+  block.close();
+  return ok;
+}
+
+struct HighTime {
+  uint64_t rise = 0;
+  std::vector<uint64_t> high_ns;
+};
+
+inline void measure_high(void* context, const gpio::PinEvent& event) {
+  auto* h = static_cast<HighTime*>(context);
+  if (event.level) {
+    h->rise = event.timestamp_ns;
+  } else if (h->rise != 0) {
+    h->high_ns.push_back(event.timestamp_ns - h->rise);
+  }
+}
+
+// 出力されたパルス幅がデューティに一致し、変更が次の周期から反映されるか
+inline bool test_pwm_duty() {
+  native_gpio::NativeGpio hal_gpio;
+  gpio::IPort& port = hal_gpio.getPort(0);
+  port.write(0);
+  pwm::SoftPwm soft(2, 1000, 100);
+  int ch = soft.addChannel(port, 11);
+  soft.setDuty(ch, 25);
+  HighTime high;
+  port.getPin(11).attachInterrupt(gpio::PinEdge::Both, measure_high, &high);
+  auto run_periods = [&](uint32_t periods) {
+    uint32_t target = soft.getPeriodCount() + periods;
+    while (soft.getPeriodCount() < target) soft.poll();
+  };
+  run_periods(20);
+  std::vector<uint64_t> first = high.high_ns;
+  high.high_ns.clear();
+  soft.setDuty(ch, 60);
+  run_periods(20);
+  soft.stop();
+  port.getPin(11).detachInterrupt();
+  if (first.size() < 10 || high.high_ns.size() < 10) return false;
+  std::sort(first.begin(), first.end());
+  std::sort(high.high_ns.begin() + 1, high.high_ns.end()); // 先頭は切り替え前の周期
+  uint64_t m25 = first[first.size() / 2];
+  uint64_t m60 = high.high_ns[high.high_ns.size() / 2];
+  // 立ち上がりは poll() の呼び出し時刻、立ち下がりは周期の格子に対して決まるので数十 us の誤差を許容
+  auto near = [](uint64_t v, uint64_t ideal) { return v + 50000 > ideal && v < ideal + 50000; };
+  return near(m25, 250000) && near(m60, 600000);
+}
+
+// writeMasked() / clearBits() の呼び出しを、その時点の getPeriodCount() ごとに数えて実際のポートへ渡すポート。
+// 周期 k の間の数は、周期 k の立ち下がりと周期 k+1 の先頭の書き込み（startPeriod() は書いてから周期を進める）
+class PeriodWriteCounter : public gpio::IPort {
+public:
+  PeriodWriteCounter(gpio::IPort& port, const pwm::SoftPwm& soft) : _port(port), _soft(soft) {}
+
+  gpio::IGpio& getGpio() override {
+    return _port.getGpio();
+  }
+  const gpio::IGpio& getGpio() const override {
+    return _port.getGpio();
+  }
+  uint32_t getPortIndex() const override {
+    return _port.getPortIndex();
+  }
+  uint32_t getNumberOfPins() const override {
+    return _port.getNumberOfPins();
+  }
+  flexhal::base::status write(uint32_t value) override {
+    return _port.write(value);
+  }
+  uint32_t read() const override {
+    return _port.read();
+  }
+  flexhal::base::status clearBits(uint32_t mask) override {
+    count();
+    return _port.clearBits(mask);
+  }
+  flexhal::base::status writeMasked(uint32_t mask, uint32_t value) override {
+    count();
+    return _port.writeMasked(mask, value);
+  }
+  gpio::IPin& getPin(uint32_t pin_index) override {
+    return _port.getPin(pin_index);
+  }
+  const gpio::IPin& getPin(uint32_t pin_index) const override {
+    return _port.getPin(pin_index);
+  }
+
+  uint32_t writes[4] = {};
+
+private:
+  void count() {
+    const uint32_t period = _soft.getPeriodCount();
+    if (period < 4) ++writes[period];
+  }
+
+  gpio::IPort& _port;
+  const pwm::SoftPwm& _soft;
+};
+
+// 1 周期あたりの実際のポート書き込み数が、ポート数と (デューティ, ポート) の組の数に一致するか
+inline bool test_pwm_writes_per_period() {
+  native_gpio::PinStateBlock block;
+  native_gpio::PinStateBlockConfig config;
+  config.port_count = 16;
+  if (block.open(config) != flexhal::base::status::ok) return false;
+  native_gpio::NativeGpio hal_gpio(block);
+  bool ok = true;
+  for (uint32_t channels : {8u, 64u, 256u, 512u}) {
+    pwm::SoftPwm soft(channels, 1000, 256);
+    std::vector<std::unique_ptr<PeriodWriteCounter>> ports;
+    for (uint32_t p = 0; p < (channels + 31) / 32; ++p) {
+      ports.emplace_back(new PeriodWriteCounter(hal_gpio.getPort(p), soft));
+    }
+    auto port_writes = [&ports](uint32_t period) {
+      uint32_t writes = 0;
+      for (const auto& port : ports) writes += port->writes[period];
+      return writes;
+    };
+    std::mt19937 rng(channels);
+    // 周期の先頭でポートごとに 1 回、0 < デューティ < 256 の (デューティ, ポート) ごとに立ち下がり 1 回
+    std::set<std::pair<uint32_t, uint32_t>> falling_edges;
+    for (uint32_t i = 0; i < channels; ++i) {
+      int ch = soft.addChannel(*ports[i / 32], i % 32);
+      const uint32_t duty = rng() % 257;
+      soft.setDuty(static_cast<uint32_t>(ch), duty);
+      if (duty > 0 && duty < 256) falling_edges.insert({duty, i / 32});
+    }
+    const uint32_t expected_writes = (channels + 31) / 32 + static_cast<uint32_t>(falling_edges.size());
+    while (soft.getPeriodCount() < 3) {
+      uint32_t wait_us = soft.poll();
+      if (wait_us > 0) std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+    }
+    soft.stop();
+    // 周期 0（最初の startPeriod() のみ）はポート数、周期 1, 2 は全体
+    ok = ok && port_writes(0) == (channels + 31) / 32;
+    ok = ok && port_writes(1) == expected_writes && port_writes(2) == expected_writes;
+  }
+  block.close();
+  return ok;
+}
+
+} // namespace flexhal_test
+
+TEST(SoftPwmTest, Schedule) {
+  EXPECT_TRUE(flexhal_test::test_pwm_schedule());
+}
+
+TEST(SoftPwmTest, Duty) {
+  EXPECT_TRUE(flexhal_test::test_pwm_duty());
+}
+
+TEST(SoftPwmTest, WritesPerPeriod) {
+  EXPECT_TRUE(flexhal_test::test_pwm_writes_per_period());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,212 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+namespace flexhal_test {
+
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+namespace native_spi = flexhal::internal::platform::native::hal::spi;
+namespace spi = flexhal::hal::spi;
+
+using flexhal::base::status;
+
+// ループバックで送った内容が返り、tx なしでは fill バイトが返るか
+inline bool test_spi_loopback() {
+  native_spi::NativeSpi bus;
+  spi::SpiDevice device;
+  device.fill = 0xA5;
+  const uint8_t tx[5] = {1, 2, 3, 4, 5};
+  uint8_t rx[5]       = {};
+  bool ok = bus.transfer(device, tx, rx, 5) == status::ok && memcmp(tx, rx, 5) == 0;
+  ok = ok && bus.transfer(device, nullptr, rx, 5) == status::ok && rx[0] == 0xA5 && rx[4] == 0xA5;
+  ok = ok && bus.transfer(device, tx, nullptr, 5) == status::ok; // 受信は捨てる
+  ok = ok && bus.transfer(device, tx, rx, 0) == status::param;
+
+  spi::SpiTransaction orphan;
+  orphan.length = 1;
+  ok = ok && bus.submit(orphan) == status::param; // device なし
+  return ok && bus.isIdle() && bus.getTransactionCount() == 3 && bus.getByteCount() == 15;
+}
+
+// keep_cs でコマンドとデータが 1 フレームになり、CS ピンが正しく動くか
+inline bool test_spi_frames() {
+  native_gpio::NativeGpio hal_gpio;
+  flexhal::hal::gpio::IPin& cs = hal_gpio.getPort(0).getPin(3);
+  cs.setMode(flexhal::hal::gpio::PinMode::Output);
+  cs.digitalWrite(true);
+
+  native_spi::NativeSpi bus(false); // poll() で実行
+  native_spi::SpiMemoryDevice memory(256);
+  spi::SpiDevice flash;
+  flash.cs = &cs;
+  bus.attachDevice(flash, memory);
+
+  // WRITE 0x000010 "abcd"（コマンドとデータは別のディスクリプタ）
+  const uint8_t write_cmd[4] = {native_spi::SpiMemoryDevice::cmd_write, 0x00, 0x00, 0x10};
+  const uint8_t payload[4]   = {'a', 'b', 'c', 'd'};
+  spi::SpiTransaction cmd, data;
+  cmd.device  = &flash;
+  cmd.tx      = write_cmd;
+  cmd.length  = 4;
+  cmd.flags   = spi::SpiTransaction::keep_cs;
+  data.device = &flash;
+  data.tx     = payload;
+  data.length = 4;
+  bool ok = bus.submit(cmd) == status::ok && bus.submit(data) == status::ok;
+  ok = ok && bus.submit(cmd) == status::busy && !bus.isIdle() && !cmd.isDone();
+  bus.poll();
+  ok = ok && bus.isIdle() && cmd.isDone() && data.isDone() && cs.digitalRead() == 1;
+  ok = ok && memcmp(memory.data() + 0x10, "abcd", 4) == 0 && bus.getFrameCount() == 1;
+
+  // READ を 1 フレームで読み戻す
+  const uint8_t read_cmd[4] = {native_spi::SpiMemoryDevice::cmd_read, 0x00, 0x00, 0x11};
+  uint8_t readback[3]       = {};
+  cmd.tx = read_cmd;
+  spi::SpiTransaction rd;
+  rd.device = &flash;
+  rd.rx     = readback;
+  rd.length = 3;
+  ok = ok && bus.submit(cmd) == status::ok && bus.transfer(rd) == status::ok;
+  ok = ok && memcmp(readback, "bcd", 3) == 0 && bus.getFrameCount() == 2;
+
+  // JEDEC ID は全二重 1 トランザクションで
+  const uint8_t id_cmd[4] = {native_spi::SpiMemoryDevice::cmd_jedec, 0, 0, 0};
+  uint8_t id[4]           = {};
+  ok = ok && bus.transfer(flash, id_cmd, id, 4) == status::ok && id[1] == 0xEF && id[2] == 0x40;
+  return ok && cs.digitalRead() == 1;
+}
+
+struct Order {
+  std::vector<int> done;
+};
+
+inline void record_order(void* context, spi::SpiTransaction& transaction, status result) {
+  Order* order = static_cast<Order*>(context);
+  order->done.push_back(result == status::ok ? static_cast<int>(transaction.tx[0]) : -1);
+}
+
+// スレッドモードで投入順に完了し、コールバックが呼ばれるか
+inline bool test_spi_queue_order() {
+  native_spi::NativeSpi bus;
+  spi::SpiDevice a, b;
+  Order order;
+  uint8_t tx[8];
+  spi::SpiTransaction transactions[8];
+  for (int i = 0; i < 8; ++i) {
+    tx[i]                      = static_cast<uint8_t>(i);
+    transactions[i].device     = (i & 1) ? &b : &a;
+    transactions[i].tx         = &tx[i];
+    transactions[i].length     = 1;
+    transactions[i].callback   = record_order;
+    transactions[i].context    = &order;
+  }
+  bool ok = true;
+  for (auto& transaction : transactions) ok = ok && bus.submit(transaction) == status::ok;
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (!bus.isIdle() && std::chrono::steady_clock::now() < deadline) bus.poll();
+  ok = ok && bus.isIdle() && order.done.size() == 8;
+  for (int i = 0; ok && i < 8; ++i) ok = order.done[i] == i && transactions[i].isDone();
+  return ok;
+}
+
+#if FLEXHAL_INTERNAL_TASK
+
+namespace task = flexhal::utils::task;
+
+inline task::Task spi_reader(spi::ISpi& bus, const spi::SpiDevice& device, uint8_t* rx, status* result) {
+  static const uint8_t tx[3] = {7, 8, 9};
+  spi::SpiTransaction transaction;
+  transaction.device = &device;
+  transaction.tx     = tx;
+  transaction.rx     = rx;
+  transaction.length = 3;
+  *result = co_await bus.transferAsync(transaction);
+}
+
+// co_await で完了を待てるか（スレッド・poll の両モード）
+inline bool test_spi_await() {
+  bool ok = true;
+  for (bool threaded : {true, false}) {
+    native_spi::NativeSpi bus(threaded);
+    spi::SpiDevice device;
+    uint8_t rx[3]  = {};
+    status result  = status::error;
+    task::Executor executor;
+    executor.setPinPollInterval_us(10);
+    ok = ok && executor.spawn(spi_reader(bus, device, rx, &result)) == status::ok;
+    executor.run();
+    ok = ok && result == status::ok && rx[0] == 7 && rx[2] == 9;
+  }
+  return ok;
+}
+
+#endif // FLEXHAL_INTERNAL_TASK
+
+// 小さなトランザクションのまとめ投入と大きな同期転送を、ポーリング・スレッドの両方で混ぜても数が合うか
+inline bool test_spi_batches(int batches = 8, int large = 4) {
+  bool ok = true;
+  for (bool threaded : {false, true}) {
+    native_spi::NativeSpi bus(threaded);
+    spi::SpiDevice device;
+    static uint8_t tx[4096], rx[4096];
+    for (size_t i = 0; i < sizeof(tx); ++i) tx[i] = static_cast<uint8_t>(i * 7);
+
+    // 4 バイトのトランザクションを 64 個ずつまとめて投入
+    spi::SpiTransaction small[64];
+    for (auto& t : small) {
+      t.device = &device;
+      t.tx     = tx;
+      t.rx     = rx;
+      t.length = 4;
+    }
+    for (int b = 0; b < batches; ++b) {
+      for (auto& t : small) ok = ok && bus.submit(t) == status::ok;
+      while (!bus.isIdle()) bus.poll();
+    }
+
+    // 4 KiB を 1 つずつ同期転送
+    spi::SpiTransaction big;
+    big.device = &device;
+    big.tx     = tx;
+    big.rx     = rx;
+    big.length = sizeof(tx);
+    for (int i = 0; i < large; ++i) {
+      memset(rx, 0, sizeof(rx));
+      ok = ok && bus.transfer(big) == status::ok && memcmp(tx, rx, sizeof(tx)) == 0;
+    }
+    ok = ok && bus.getTransactionCount() == static_cast<uint64_t>(batches * 64 + large);
+  }
+  return ok;
+}
+
+} // namespace flexhal_test
+
+TEST(SpiTest, Loopback) {
+  EXPECT_TRUE(flexhal_test::test_spi_loopback());
+}
+
+TEST(SpiTest, Frames) {
+  EXPECT_TRUE(flexhal_test::test_spi_frames());
+}
+
+TEST(SpiTest, QueueOrder) {
+  EXPECT_TRUE(flexhal_test::test_spi_queue_order());
+}
+
+#if FLEXHAL_INTERNAL_TASK
+TEST(SpiTest, Await) {
+  EXPECT_TRUE(flexhal_test::test_spi_await());
+}
+#endif
+
+TEST(SpiTest, Batches) {
+  EXPECT_TRUE(flexhal_test::test_spi_batches());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,212 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <poll.h>
+#include <unistd.h>
+
+namespace flexhal_test {
+
+namespace native_uart = flexhal::internal::platform::native::hal::uart;
+namespace uart = flexhal::hal::uart;
+
+using flexhal::base::status;
+
+// 相手側から届くまで（最大 1 秒）ポーリングする
+inline bool wait_available(uart::IUart& port, size_t count) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+  while (port.available() < count && std::chrono::steady_clock::now() < deadline) {
+    port.poll();
+    std::this_thread::yield();
+  }
+  return port.available() >= count;
+}
+
+// 相手側の fd から count バイト読む。届かなければ 1 秒で諦める（read() で固まらないよう poll() で待つ）
+inline std::string read_peer(int fd, size_t count) {
+  std::string text;
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+  char buffer[256];
+  while (text.size() < count) {
+    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    if (left.count() <= 0) break;
+    struct pollfd pfd = {fd, POLLIN, 0};
+    if (::poll(&pfd, 1, static_cast<int>(left.count())) <= 0 || (pfd.revents & POLLIN) == 0) break;
+    const ssize_t n = ::read(fd, buffer, sizeof(buffer));
+    if (n <= 0) break;
+    text.append(buffer, static_cast<size_t>(n));
+  }
+  return text;
+}
+
+// リングの折り返しと、コピーなしのビュー
+inline bool test_uart_ring() {
+  uart::ByteRing ring(6); // 8 に切り上げ
+  const uint8_t data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  bool ok = ring.capacity() == 8 && ring.write(data, 6) == 6 && ring.size() == 6;
+  uint8_t out[8] = {};
+  ok = ok && ring.read(out, 4) == 4 && out[3] == 4 && ring.space() == 6;
+
+  // 5,6 の後ろに 4 バイト書くと末尾で折り返す
+  ok = ok && ring.write(data, 8) == 6 && ring.size() == 8 && ring.space() == 0;
+  uart::ByteView views[2];
+  ok = ok && ring.readViews(views) == 2 && views[0].size == 4 && views[1].size == 4;
+  ok = ok && views[0].data[0] == 5 && views[0].data[2] == 1 && views[1].data[0] == 3;
+  ok = ok && ring.readView().size == 4;
+  ring.consume(4);
+  ok = ok && ring.readView().size == 4 && ring.readView().data[3] == 6;
+
+  // writeView / commit で直接書き込む
+  uart::MutableByteView free = ring.writeView();
+  ok = ok && free.size == 4;
+  free.data[0] = 0xAA;
+  ring.commit(1);
+  ok = ok && ring.size() == 5 && ring.read(out, 8) == 5 && out[4] == 0xAA && ring.empty();
+  return ok;
+}
+
+// socketpair 越しの受信（peek/consume）と scatter-gather 送信
+inline bool test_uart_socketpair() {
+  native_uart::NativeUart port(64, 16);
+  bool ok = port.openSocketPair() == status::ok && port.isOpen() && port.openSocketPair() == status::busy;
+  const int peer = port.getPeerFd();
+
+  ok = ok && ::write(peer, "hello world", 11) == 11 && wait_available(port, 11);
+  uart::ByteView view = port.peek();
+  ok = ok && view.size == 11 && memcmp(view.data, "hello", 5) == 0;
+  port.consume(6);
+  char word[8] = {};
+  ok = ok && port.read(reinterpret_cast<uint8_t*>(word), sizeof(word)) == 5 && strcmp(word, "world") == 0;
+  ok = ok && port.available() == 0;
+
+  const char* head = "AT+";
+  const char* body = "PING";
+  const uart::ByteView parts[3] = {{reinterpret_cast<const uint8_t*>(head), 3},
+                                   {reinterpret_cast<const uint8_t*>(body), 4},
+                                   {reinterpret_cast<const uint8_t*>("\r\n"), 2}};
+  ok = ok && port.writev(parts, 3) == status::ok && port.getWriteSpace() == 7;
+  ok = ok && port.writev(parts, 3) == status::busy; // 全部入らなければ何も入れない
+  ok = ok && port.getWriteSpace() == 7;
+  uint8_t large[17] = {};
+  ok = ok && port.write(large, sizeof(large)) == status::param;
+  ok = ok && port.flush() == status::ok && read_peer(peer, 9) == "AT+PING\r\n";
+
+  port.close();
+  return ok && !port.isOpen();
+}
+
+// スレッドモードではワーカーが受信・送信する
+inline bool test_uart_threaded() {
+  native_uart::NativeUart port(256, 256, true);
+  bool ok = port.openSocketPair() == status::ok;
+  const int peer = port.getPeerFd();
+  ok = ok && ::write(peer, "ping", 4) == 4 && wait_available(port, 4);
+
+  uint8_t echo[4];
+  ok = ok && port.read(echo, 4) == 4 && port.write(echo, 4) == status::ok;
+  ok = ok && read_peer(peer, 4) == "ping" && port.flush() == status::ok;
+  return ok;
+}
+
+// 疑似端末（raw モード）経由でも送受信できるか
+inline bool test_uart_pty() {
+  native_uart::NativeUart port;
+  if (port.openPty() != status::ok) {
+    printf("[ uart      ] pseudo-terminals are not available, skipped\n");
+    return true;
+  }
+  const int peer = port.getPeerFd();
+  bool ok = port.getPtyName()[0] == '/' && ::write(peer, "abc\n", 4) == 4 && wait_available(port, 4);
+  uint8_t received[4] = {};
+  ok = ok && port.read(received, 4) == 4 && memcmp(received, "abc\n", 4) == 0;
+  ok = ok && port.write(reinterpret_cast<const uint8_t*>("xyz"), 3) == status::ok && port.flush() == status::ok;
+  return ok && read_peer(peer, 3) == "xyz";
+}
+
+inline void log_to(flexhal::utils::logger::ILogger& logger, flexhal::utils::logger::LogLevel level, const char* tag,
+                   const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  logger.log(level, tag, format, args);
+  va_end(args);
+}
+
+// ロガーの出力先として使え、満杯のときはブロックせず捨てるか
+inline bool test_uart_logger() {
+  native_uart::NativeUart port(64, 64);
+  bool ok = port.openSocketPair() == status::ok;
+  uart::UartLogger logger(port);
+
+  log_to(logger, flexhal::utils::logger::LogLevel::INFO, "UART", "value %d", 42);
+  ok = ok && port.available() == 0 && !port.isWriteIdle();
+  logger.flush();
+  ok = ok && port.isWriteIdle() && read_peer(port.getPeerFd(), 20) == "[I] [UART] value 42\n";
+
+  // poll しなければ 18 バイトの行は 3 行までしか入らない
+  for (int i = 0; i < 4; ++i) log_to(logger, flexhal::utils::logger::LogLevel::WARN, "UART", "line %d", i);
+  ok = ok && logger.getDroppedCount() == 1;
+  logger.flush();
+  const std::string lines = read_peer(port.getPeerFd(), 54);
+  return ok && lines == "[W] [UART] line 0\n[W] [UART] line 1\n[W] [UART] line 2\n";
+}
+
+// 受信バッファより大きなデータを peek/consume でコピーなしに走査し、取りこぼしがないか
+inline bool test_uart_stream(size_t total = 256u << 10) {
+  native_uart::NativeUart port(4096, 256);
+  bool ok = port.openSocketPair() == status::ok;
+  const int peer = port.getPeerFd();
+
+  static uint8_t chunk[1024];
+  for (size_t i = 0; i < sizeof(chunk); ++i) chunk[i] = static_cast<uint8_t>(i == sizeof(chunk) - 1 ? '\n' : 'a');
+  size_t sent = 0, received = 0, lines = 0;
+  while (ok && received < total) {
+    if (sent < total) {
+      const ssize_t n = ::write(peer, chunk, sizeof(chunk));
+      if (n > 0) sent += static_cast<size_t>(n);
+    }
+    port.poll();
+    uart::ByteView view;
+    while ((view = port.peek()).size != 0) {
+      for (size_t i = 0; i < view.size; ++i) lines += view.data[i] == '\n';
+      received += view.size;
+      port.consume(view.size);
+    }
+  }
+  return ok && received == total && lines == total / sizeof(chunk);
+}
+
+} // namespace flexhal_test
+
+TEST(UartTest, Ring) {
+  EXPECT_TRUE(flexhal_test::test_uart_ring());
+}
+
+TEST(UartTest, SocketPair) {
+  EXPECT_TRUE(flexhal_test::test_uart_socketpair());
+}
+
+TEST(UartTest, Threaded) {
+  EXPECT_TRUE(flexhal_test::test_uart_threaded());
+}
+
+TEST(UartTest, Pty) {
+  EXPECT_TRUE(flexhal_test::test_uart_pty());
+}
+
+TEST(UartTest, Logger) {
+  EXPECT_TRUE(flexhal_test::test_uart_logger());
+}
+
+TEST(UartTest, Stream) {
+  EXPECT_TRUE(flexhal_test::test_uart_stream());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
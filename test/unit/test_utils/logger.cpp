@@ -0,0 +1,401 @@
+// このテストファイルでは DEBUG/VERBOSE をコンパイル時に除去する
+#define FLEXHAL_LOG_MIN_LEVEL FLEXHAL_LOG_LEVEL_INFO
+
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flexhal_test {
+
+namespace logger = flexhal::utils::logger;
+
+// 受け取ったメッセージを保存するだけのロガー
+class CaptureLogger : public logger::ILogger {
+public:
+  void log(logger::LogLevel level, const char* tag, const char* format, std::va_list args) override {
+    char text[256];
+    vsnprintf(text, sizeof(text), format, args);
+    std::lock_guard<std::mutex> lock(_mutex);
+    messages.push_back(text);
+    (void)level;
+    (void)tag;
+  }
+
+  std::vector<std::string> messages;
+
+private:
+  std::mutex _mutex;
+};
+
+// 可変引数を va_list に変換して ILogger::log を呼ぶヘルパー
+inline void log_to(logger::ILogger& target, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  target.log(logger::LogLevel::INFO, "TEST", format, args);
+  va_end(args);
+}
+
+inline std::string pack_and_format(const char* format, ...) {
+  uint8_t packed[128];
+  va_list args;
+  va_start(args, format);
+  size_t size = logger::args::pack(packed, sizeof(packed), format, args);
+  va_end(args);
+  char text[256];
+  logger::args::format(text, sizeof(text), format, packed, size);
+  return text;
+}
+
+// pack/format の往復が vsnprintf と同じ結果になるか
+inline bool test_args_round_trip() {
+  const char* expected = "i=-42 u=7 x=ff ll=-9000000000 zu=123 f=3.250 s=[abc] w=[   12] c=Z 100%";
+  std::string actual = pack_and_format("i=%d u=%u x=%x ll=%lld zu=%zu f=%.3f s=[%s] w=[%*d] c=%c 100%%",
+                                       -42, 7u, 255u, -9000000000LL, static_cast<size_t>(123), 3.25,
+                                       "abc", 5, 12, 'Z');
+  return actual == expected;
+}
+
+// 長さ修飾子ごとの幅で読み、後ろの引数がずれないか（ESP32 では long / size_t は 32 ビット）
+inline bool test_args_length_modifiers() {
+  const char* expected = "ld=-5 next=1 lu=4294967295 next=2 zu=123 next=3 jd=-7 td=-9 Lf=2.50 c=x end";
+  std::string actual = pack_and_format("ld=%ld next=%d lu=%lu next=%d zu=%zu next=%d jd=%jd td=%td Lf=%.2Lf c=%lc end",
+                                       -5L, 1, 4294967295UL, 2, static_cast<size_t>(123), 3,
+                                       static_cast<intmax_t>(-7), static_cast<ptrdiff_t>(-9), 2.5L,
+                                       static_cast<wint_t>('x'));
+  return actual == expected;
+}
+
+// log() の時点では整形されず、flush() で出力されるか
+inline bool test_async_deferred() {
+  CaptureLogger sink;
+  logger::AsyncLogger async(sink, 8);
+  char name[16];
+  strcpy(name, "first");
+  log_to(async, "%s %d", name, 1);
+  strcpy(name, "changed"); // 文字列はコピーされているはず
+  if (!sink.messages.empty()) return false;
+  async.flush();
+  return sink.messages.size() == 1 && sink.messages[0] == "first 1";
+}
+
+// リングが満杯になったら破棄してカウントするか
+inline bool test_async_drop_counter() {
+  CaptureLogger sink;
+  logger::AsyncLogger async(sink, 4);
+  for (int i = 0; i < 10; ++i) {
+    log_to(async, "n=%d", i);
+  }
+  bool ok = async.getCapacity() == 4 && async.getDroppedCount() == 6 && async.getQueuedCount() == 4;
+  async.flush();
+  return ok && sink.messages.size() == 4 && sink.messages[3] == "n=3";
+}
+
+// 複数スレッドから書き込み、ドレインスレッドで全件出力されるか
+inline bool test_async_drain_thread(int threads = 4, int per_thread = 500) {
+  CaptureLogger sink;
+  logger::AsyncLogger async(sink, 4096);
+  if (async.startDrainThread(100) != flexhal::base::status::ok) return false;
+  std::vector<std::thread> producers;
+  for (int t = 0; t < threads; ++t) {
+    producers.emplace_back([&async, t, per_thread]() {
+      for (int i = 0; i < per_thread; ++i) {
+        log_to(async, "t%d i%d", t, i);
+      }
+    });
+  }
+  for (auto& p : producers) p.join();
+  async.stopDrainThread();
+  return sink.messages.size() + async.getDroppedCount() == static_cast<size_t>(threads * per_thread) &&
+         async.getDroppedCount() == 0;
+}
+
+// Log.flush() がアクティブなロガーに届くか
+inline bool test_log_proxy_flush() {
+  CaptureLogger sink;
+  logger::AsyncLogger async(sink, 8);
+  logger::ILogger* previous = logger::_active_logger;
+  logger::setLogger(&async);
+  logger::Log.error("TEST", "value=%d", 5);
+  bool queued = sink.messages.empty();
+  logger::Log.flush();
+  logger::setLogger(previous);
+  return queued && sink.messages.size() == 1 && sink.messages[0] == "value=5";
+}
+
+// BinaryLogger の出力を保存する書き込みコールバック
+inline void capture_bytes(const uint8_t* data, size_t size, void* context) {
+  auto* out = static_cast<std::vector<uint8_t>*>(context);
+  out->insert(out->end(), data, data + size);
+}
+
+// 定義レコードは初回のみ、2回目以降はメッセージレコードのみになるか
+inline bool test_binary_records() {
+  static const char kFormat[] = "adc=%u temp=%.1f";
+  std::vector<uint8_t> out;
+  logger::BinaryLogger binary(capture_bytes, &out);
+
+  log_to(binary, kFormat, 512u, 21.5);
+  // 定義(7+16) + 定義 "TEST"(7+4) + ヘッダ16 + 引数(4+8)
+  if (out.size() != 23 + 11 + 16 + 12 || out[0] != logger::BinaryLogger::RECORD_DEFINITION) return false;
+
+  out.clear();
+  log_to(binary, kFormat, 1023u, -3.0);
+  if (out.size() != 16 + 12 || out[0] != logger::BinaryLogger::RECORD_MESSAGE) return false;
+
+  uint32_t format_id;
+  uint16_t arg_size;
+  memcpy(&format_id, &out[1], 4);
+  memcpy(&arg_size, &out[14], 2);
+  char text[64];
+  logger::args::format(text, sizeof(text), kFormat, &out[16], arg_size);
+  return format_id == FLEXHAL_LOG_ID("adc=%u temp=%.1f") &&
+         out[5] == static_cast<uint8_t>(logger::LogLevel::INFO) &&
+         strcmp(text, "adc=1023 temp=-3.0") == 0 &&
+         binary.getMessageCount() == 2;
+}
+
+// resendDefinitions() 後は定義が再送されるか
+inline bool test_binary_resend() {
+  static const char kFormat[] = "tick";
+  std::vector<uint8_t> out;
+  logger::BinaryLogger binary(capture_bytes, &out);
+  binary.registerString("TEST");
+  binary.registerString(kFormat);
+  out.clear();
+  log_to(binary, kFormat);
+  size_t hot = out.size();
+  binary.resendDefinitions();
+  out.clear();
+  log_to(binary, kFormat);
+  return hot == 16 && out.size() == (7 + 4) + (7 + 4) + 16;
+}
+
+// 同じバッファを使い回して作ったタグも、中身ごとに別の ID として定義されるか
+inline bool test_binary_runtime_tag() {
+  std::vector<uint8_t> out;
+  logger::BinaryLogger binary(capture_bytes, &out);
+  char tag[8];
+  uint32_t ids[2];
+  for (int i = 0; i < 2; ++i) {
+    snprintf(tag, sizeof(tag), "CH%d", i);
+    ids[i] = binary.registerString(tag);
+  }
+  const size_t defined = out.size();
+  strcpy(tag, "CH0");
+  return ids[0] == FLEXHAL_LOG_ID("CH0") && ids[1] == FLEXHAL_LOG_ID("CH1") && defined == 2 * (7 + 3) &&
+         binary.registerString(tag) == ids[0] && out.size() == defined;
+}
+
+// 表が埋まった後の文字列は毎回定義を送らず、数だけ数える
+inline bool test_binary_overflow() {
+  std::vector<uint8_t> out;
+  logger::BinaryLogger binary(capture_bytes, &out);
+  char text[16];
+  for (size_t i = 0; i < logger::BinaryLogger::TABLE_SIZE; ++i) {
+    snprintf(text, sizeof(text), "s%zu", i);
+    binary.registerString(text);
+  }
+  bool ok = binary.getOverflowCount() == 0;
+  out.clear();
+  ok = ok && binary.registerString("extra") == FLEXHAL_LOG_ID("extra") && binary.registerString("extra") != 0;
+  ok = ok && out.empty() && binary.getOverflowCount() == 2;
+  ok = ok && binary.registerString("s7") == FLEXHAL_LOG_ID("s7") && binary.getOverflowCount() == 2;
+
+  // 表が埋まっていてもメッセージはヘッダと引数だけ
+  log_to(binary, "extra");
+  return ok && out.size() == 16 && binary.getOverflowCount() == 4;
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+// tools/log_decode.py で BinaryLogger の出力を復号し、vsnprintf と同じ文字列になるか
+inline bool test_binary_host_decode() {
+  std::vector<uint8_t> out;
+  logger::BinaryLogger binary(capture_bytes, &out);
+  log_to(binary, "adc=%u temp=%.1f", 512u, 21.5);
+  log_to(binary, "lu=%lu next=%d zu=%zu next=%d", 4294967295UL, 1, static_cast<size_t>(123), 2);
+  log_to(binary, "ld=%ld s=[%s] x=%08llx c=%c", -5L, "abc", 0xBEEFULL, 'Z');
+
+  const std::string path = "/tmp/flexhal_binary_log_test.bin";
+  FILE* file = fopen(path.c_str(), "wb");
+  if (file == nullptr) return false;
+  fwrite(out.data(), 1, out.size(), file);
+  fclose(file);
+
+  // このファイルからの相対位置でリポジトリ直下の tools/ を探す
+  std::string root = __FILE__;
+  root.erase(root.size() - strlen("test/unit/test_utils/logger.cpp"));
+  const std::string command = "python3 " + root + "tools/log_decode.py " + path;
+  std::string decoded;
+  if (FILE* pipe = popen(command.c_str(), "r")) {
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+      std::string line = buffer;
+      decoded += line.substr(line.find("] ") + 2); // タイムスタンプは除く
+    }
+    pclose(pipe);
+  }
+  remove(path.c_str());
+  return decoded ==
+         "I TEST: adc=512 temp=21.5\n"
+         "I TEST: lu=4294967295 next=1 zu=123 next=2\n"
+         "I TEST: ld=-5 s=[abc] x=0000beef c=Z\n";
+}
+#endif
+
+// 評価された回数を数える引数
+inline int count_evaluation(int& counter) {
+  return ++counter;
+}
+
+// コンパイル時に除去されたレベル、実行時に無効なレベルでは引数が評価されないか
+inline bool test_level_stripping() {
+  CaptureLogger sink;
+  logger::ILogger* previous = logger::_active_logger;
+  logger::LogLevel previous_level = logger::getLogLevel();
+  logger::setLogger(&sink);
+  logger::setLogLevel(logger::LogLevel::WARN);
+
+  int evaluated = 0;
+  FLEXHAL_LOGV("TEST", "v=%d", count_evaluation(evaluated)); // コンパイル時に除去
+  FLEXHAL_LOGD("TEST", "d=%d", count_evaluation(evaluated)); // コンパイル時に除去
+  FLEXHAL_LOGI("TEST", "i=%d", count_evaluation(evaluated)); // 実行時に無効
+  FLEXHAL_LOGW("TEST", "w=%d", count_evaluation(evaluated));
+  FLEXHAL_LOGE("TEST", "no args");
+
+  logger::setLogger(previous);
+  logger::setLogLevel(previous_level);
+  return evaluated == 1 && sink.messages.size() == 2 && sink.messages[0] == "w=1" &&
+         sink.messages[1] == "no args";
+}
+
+// タグ単位のレベル上書きが内容一致で効き、解除で元に戻るか
+inline bool test_tag_levels() {
+  CaptureLogger sink;
+  logger::ILogger* previous = logger::_active_logger;
+  logger::LogLevel previous_level = logger::getLogLevel();
+  logger::setLogger(&sink);
+  logger::setLogLevel(logger::LogLevel::WARN);
+
+  char gpio_copy[] = "GPIO"; // リテラルとは別アドレスの同じ文字列
+  bool ok = logger::setTagLogLevel("GPIO", logger::LogLevel::DEBUG) == flexhal::base::status::ok &&
+            logger::setTagLogLevel("NOISY", logger::LogLevel::ERROR) == flexhal::base::status::ok;
+  logger::Log.debug("GPIO", "gpio debug");
+  logger::Log.debug(gpio_copy, "gpio copy debug");
+  logger::Log.debug("I2C", "i2c debug");     // 全体レベル WARN で抑制
+  logger::Log.warn("NOISY", "noisy warn");   // タグを ERROR に下げたので抑制
+  logger::Log.warn("I2C", "i2c warn");
+  ok = ok && sink.messages.size() == 3 && sink.messages[0] == "gpio debug" &&
+       sink.messages[1] == "gpio copy debug" && sink.messages[2] == "i2c warn" &&
+       logger::getTagLogLevel(gpio_copy) == logger::LogLevel::DEBUG;
+
+  logger::clearTagLogLevel("GPIO");
+  logger::Log.debug(gpio_copy, "after clear");
+  ok = ok && sink.messages.size() == 3 && logger::getTagLogLevel("GPIO") == logger::LogLevel::WARN;
+
+  logger::clearTagLogLevels();
+  logger::Log.warn("NOISY", "noisy again");
+  ok = ok && sink.messages.size() == 4 && logger::_tag_levels.empty();
+
+  logger::setLogger(previous);
+  logger::setLogLevel(previous_level);
+  return ok;
+}
+
+// 動的に作ったタグはスロットを消費せず、満杯なら no_memory、clear したスロットは再利用されるか
+inline bool test_tag_level_capacity() {
+  logger::TagLevelTable table;
+  char tag[16];
+  for (int i = 0; i < 500; ++i) {
+    snprintf(tag, sizeof(tag), "DYN%d", i); // 同じバッファに毎回別の文字列
+    table.lookup(tag, logger::LogLevel::INFO);
+  }
+  bool ok = table.empty();
+
+  size_t stored = 0;
+  for (size_t i = 0; i < logger::TagLevelTable::TABLE_SIZE; ++i) {
+    snprintf(tag, sizeof(tag), "T%u", static_cast<unsigned>(i));
+    stored += table.set(tag, logger::LogLevel::DEBUG) == flexhal::base::status::ok;
+  }
+  ok = ok && stored == logger::TagLevelTable::TABLE_SIZE;
+  ok = ok && table.set("ONE_MORE", logger::LogLevel::DEBUG) == flexhal::base::status::no_memory;
+  ok = ok && table.set("T5", logger::LogLevel::ERROR) == flexhal::base::status::ok; // 既存の上書きは可能
+  snprintf(tag, sizeof(tag), "T%d", 5);
+  ok = ok && table.lookup(tag, logger::LogLevel::INFO) == logger::LogLevel::ERROR;
+
+  table.clear("T7");
+  ok = ok && table.lookup("T7", logger::LogLevel::INFO) == logger::LogLevel::INFO;
+  ok = ok && table.set("ONE_MORE", logger::LogLevel::VERBOSE) == flexhal::base::status::ok;
+  ok = ok && table.lookup("ONE_MORE", logger::LogLevel::INFO) == logger::LogLevel::VERBOSE;
+  ok = ok && table.lookup("T63", logger::LogLevel::INFO) == logger::LogLevel::DEBUG;
+
+  table.clearAll();
+  return ok && table.empty() && table.lookup("T63", logger::LogLevel::INFO) == logger::LogLevel::INFO;
+}
+
+} // namespace flexhal_test
+
+TEST(LoggerTest, ArgsRoundTrip) {
+  EXPECT_TRUE(flexhal_test::test_args_round_trip());
+}
+
+TEST(LoggerTest, ArgsLengthModifiers) {
+  EXPECT_TRUE(flexhal_test::test_args_length_modifiers());
+}
+
+TEST(LoggerTest, AsyncDeferred) {
+  EXPECT_TRUE(flexhal_test::test_async_deferred());
+}
+
+TEST(LoggerTest, AsyncDropCounter) {
+  EXPECT_TRUE(flexhal_test::test_async_drop_counter());
+}
+
+TEST(LoggerTest, AsyncDrainThread) {
+  EXPECT_TRUE(flexhal_test::test_async_drain_thread());
+}
+
+TEST(LoggerTest, LogProxyFlush) {
+  EXPECT_TRUE(flexhal_test::test_log_proxy_flush());
+}
+
+TEST(LoggerTest, BinaryRecords) {
+  EXPECT_TRUE(flexhal_test::test_binary_records());
+}
+
+TEST(LoggerTest, BinaryResend) {
+  EXPECT_TRUE(flexhal_test::test_binary_resend());
+}
+
+TEST(LoggerTest, BinaryRuntimeTag) {
+  EXPECT_TRUE(flexhal_test::test_binary_runtime_tag());
+}
+
+TEST(LoggerTest, BinaryOverflow) {
+  EXPECT_TRUE(flexhal_test::test_binary_overflow());
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+TEST(LoggerTest, BinaryHostDecode) {
+  EXPECT_TRUE(flexhal_test::test_binary_host_decode());
+}
+#endif
+
+TEST(LoggerTest, LevelStripping) {
+  EXPECT_TRUE(flexhal_test::test_level_stripping());
+}
+
+TEST(LoggerTest, TagLevels) {
+  EXPECT_TRUE(flexhal_test::test_tag_levels());
+}
+
+TEST(LoggerTest, TagLevelCapacity) {
+  EXPECT_TRUE(flexhal_test::test_tag_level_capacity());
+}
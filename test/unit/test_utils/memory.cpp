@@ -0,0 +1,127 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flexhal_test {
+
+namespace memory = flexhal::utils::memory;
+namespace native_gpio = flexhal::internal::platform::native::hal::gpio;
+
+using flexhal::base::status;
+
+// 生存中のインスタンス数を数える
+struct Counted {
+  explicit Counted(int v) : value(v) {
+    ++alive;
+  }
+  ~Counted() {
+    --alive;
+  }
+
+  int value;
+  static int alive;
+};
+
+int Counted::alive = 0;
+
+// アラインメント、満杯時の失敗、high-water mark、reset
+inline bool test_memory_arena() {
+  memory::StaticArena<64> arena;
+  bool ok = arena.getCapacity() == 64 && arena.getUsed() == 0;
+
+  uint8_t* byte = arena.allocateArray<uint8_t>(1);
+  uint64_t* word = arena.allocateArray<uint64_t>(2); // 7 バイトのパディング
+  ok = ok && byte != nullptr && word != nullptr && reinterpret_cast<uintptr_t>(word) % alignof(uint64_t) == 0;
+  ok = ok && arena.getUsed() == 24 && arena.owns(word) && !arena.owns(&ok);
+
+  Counted* counted = arena.create<Counted>(7);
+  ok = ok && counted != nullptr && counted->value == 7 && Counted::alive == 1;
+  memory::Arena::destroy(counted);
+  ok = ok && Counted::alive == 0;
+
+  ok = ok && arena.allocate(64) == nullptr; // 入らない
+  const memory::MemoryStats stats = arena.getStats();
+  ok = ok && stats.capacity == 64 && stats.used == 28 && stats.allocations == 3 && stats.failed == 1;
+  ok = ok && stats.fragmentation > 0.24f && stats.fragmentation < 0.26f; // 7 / 28
+
+  arena.reset();
+  ok = ok && arena.getUsed() == 0 && arena.getHighWater() == 28 && arena.allocate(64) != nullptr;
+
+  memory::Arena empty(nullptr, 16);
+  return ok && empty.getCapacity() == 0 && empty.allocate(1) == nullptr;
+}
+
+// スロットの再利用、満杯時の失敗、断片化率
+inline bool test_memory_pool() {
+  memory::ObjectPool<Counted, 4> pool;
+  Counted* objects[4];
+  for (int i = 0; i < 4; ++i) objects[i] = pool.create(i);
+  bool ok = Counted::alive == 4 && pool.create(4) == nullptr && pool.getUsed() == 4;
+  ok = ok && pool.owns(objects[3]) && !pool.owns(reinterpret_cast<const Counted*>(&ok));
+  ok = ok && reinterpret_cast<uintptr_t>(objects[0]) < reinterpret_cast<uintptr_t>(objects[1]); // 先頭から順に
+
+  pool.destroy(objects[1]);
+  pool.destroy(objects[2]);
+  memory::MemoryStats stats = pool.getStats();
+  ok = ok && Counted::alive == 2 && stats.used == 2 && stats.high_water == 4 && stats.failed == 1;
+  ok = ok && stats.fragmentation == 0.5f; // 4 スロット中 2 つが穴
+
+  // 最後に解放したスロットから使う
+  Counted* reused = pool.create(9);
+  ok = ok && reused == objects[2] && reused->value == 9;
+  pool.destroy(objects[3]);
+  pool.destroy(reused);
+  stats = pool.getStats();
+  ok = ok && stats.used == 1 && stats.fragmentation == 0.0f && stats.allocations == 5;
+  pool.destroy(objects[0]);
+  return ok && Counted::alive == 0 && pool.getStats().fragmentation == 0.0f;
+}
+
+// getArenaSize() ぶんのアリーナに GPIO を構築できるか
+inline bool test_memory_gpio_arena() {
+  native_gpio::PinStateBlock& block = native_gpio::default_block();
+  const size_t size = native_gpio::NativeGpio::getArenaSize(block);
+  std::vector<std::max_align_t> storage((size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+  memory::Arena arena(storage.data(), size);
+
+  native_gpio::NativeGpio gpio(block, arena);
+  bool ok = arena.getUsed() > 0 && arena.getUsed() <= size && arena.getStats().failed == 0;
+  ok = ok && gpio.getNumberOfPorts() == block.getNumberOfPorts();
+  flexhal::hal::gpio::IPin& pin = gpio.getPort(0).getPin(5);
+  ok = ok && arena.owns(&pin) && arena.owns(&gpio.getPort(0));
+  ok = ok && pin.setMode(flexhal::hal::gpio::PinMode::Output) == status::ok;
+  ok = ok && pin.digitalWrite(true) == status::ok && pin.digitalRead() == 1 && (gpio.getPort(0).read() & (1u << 5));
+  return ok && pin.digitalWrite(false) == status::ok && pin.digitalRead() == 0;
+}
+
+// 小さすぎるアリーナに構築しようとすると、壊れた GPIO を返さずに停止する
+inline void build_gpio_in_small_arena() {
+  memory::StaticArena<64> small;
+  native_gpio::NativeGpio gpio(native_gpio::default_block(), small);
+}
+
+} // namespace flexhal_test
+
+TEST(MemoryTest, Arena) {
+  EXPECT_TRUE(flexhal_test::test_memory_arena());
+}
+
+TEST(MemoryTest, Pool) {
+  EXPECT_TRUE(flexhal_test::test_memory_pool());
+}
+
+TEST(MemoryTest, GpioArena) {
+  EXPECT_TRUE(flexhal_test::test_memory_gpio_arena());
+}
+
+TEST(MemoryTest, GpioArenaTooSmall) {
+  testing::GTEST_FLAG(death_test_style) = "threadsafe"; // 他のテストがスレッドを残していても安全に fork する
+  EXPECT_DEATH(flexhal_test::build_gpio_in_small_arena(), ""); // NDEBUG では assert の文言なしで abort()
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
@@ -0,0 +1,179 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_INTERNAL_TASK
+
+#include <chrono>
+#include <ctime>
+#include <vector>
+
+namespace flexhal_test {
+
+namespace task = flexhal::utils::task;
+namespace gpio = flexhal::hal::gpio;
+
+inline task::Task record_after(uint32_t us, int id, std::vector<int>* order) {
+  co_await task::sleep_for(us);
+  order->push_back(id);
+}
+
+// 期限の早い順にタスクが再開され、指定時間より早く起きないか
+inline bool test_task_sleep_order() {
+  task::Executor executor;
+  std::vector<int> order;
+  uint64_t start = flexhal::utils::time::micros64();
+  executor.spawn(record_after(3000, 3, &order));
+  executor.spawn(record_after(1000, 1, &order));
+  executor.spawn(record_after(2000, 2, &order));
+  executor.spawn(record_after(2000, 4, &order)); // 同じ期限は spawn 順
+  executor.run();
+  uint64_t elapsed = flexhal::utils::time::micros64() - start;
+  return order == std::vector<int>{1, 2, 4, 3} && elapsed >= 3000 && executor.getTaskCount() == 0;
+}
+
+inline task::Task add_twice(int* value) {
+  *value += 1;
+  co_await task::yield_now();
+  *value += 1;
+}
+
+inline task::Task run_children(int* value, flexhal::base::status* result) {
+  *result = co_await add_twice(value);
+  if (*result == flexhal::base::status::ok) {
+    *result = co_await add_twice(value);
+  }
+}
+
+// サブタスクを co_await すると完了後に呼び出し元が再開されるか
+inline bool test_task_subtask() {
+  task::Executor executor;
+  int value = 0;
+  flexhal::base::status result = flexhal::base::status::error;
+  size_t free_before = task::FramePool::instance().getFreeCount();
+  executor.spawn(run_children(&value, &result));
+  executor.run();
+  return value == 4 && result == flexhal::base::status::ok &&
+         task::FramePool::instance().getFreeCount() == free_before;
+}
+
+inline task::Task wait_forever(int* finished) {
+  co_await task::sleep_for(1000000000u);
+  ++*finished;
+}
+
+// フレームプールを使い切ると spawn が no_memory を返し、破棄でフレームが戻るか
+inline bool test_task_pool_exhaustion() {
+  task::FramePool& pool = task::FramePool::instance();
+  size_t free_before = pool.getFreeCount();
+  int finished = 0;
+  bool ok = true;
+  {
+    task::Executor executor;
+    for (size_t i = 0; i < free_before; ++i) {
+      ok = ok && executor.spawn(wait_forever(&finished)) == flexhal::base::status::ok;
+    }
+    ok = ok && pool.getFreeCount() == 0;
+    ok = ok && executor.spawn(wait_forever(&finished)) == flexhal::base::status::no_memory;
+    executor.runOnce();
+    ok = ok && executor.getTaskCount() == free_before && executor.getTimeUntilNext_us() > 0;
+  }
+  return ok && finished == 0 && pool.getFreeCount() == free_before;
+}
+
+inline task::Task sleep_once(uint32_t us) {
+  co_await task::sleep_for(us);
+}
+
+// 待ち時間中は CPU を使わずに休止しているか
+inline bool test_task_idle() {
+  task::Executor executor;
+  executor.spawn(sleep_once(50000));
+  std::clock_t cpu0 = std::clock();
+  auto t0 = std::chrono::steady_clock::now();
+  executor.run();
+  double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  double cpu_ms = 1000.0 * (std::clock() - cpu0) / CLOCKS_PER_SEC;
+  return wall_ms >= 50.0 && cpu_ms < wall_ms / 2;
+}
+
+inline task::Task ping(int rounds, uint64_t* switches) {
+  for (int i = 0; i < rounds; ++i) {
+    ++*switches;
+    co_await task::yield_now();
+  }
+}
+
+// 多数のタスクが yield_now() を繰り返しても、全員が最後まで回って終了するか
+inline bool test_task_yield(int tasks = 12, int rounds = 200) {
+  task::Executor executor;
+  uint64_t switches = 0;
+  for (int i = 0; i < tasks; ++i) {
+    if (executor.spawn(ping(rounds, &switches)) != flexhal::base::status::ok) return false;
+  }
+  executor.run();
+  return switches == static_cast<uint64_t>(tasks) * rounds && executor.getTaskCount() == 0;
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+inline task::Task wait_edge(gpio::IPin* pin, gpio::PinEdge edge, int* level, uint64_t* at_us) {
+  *level = co_await pin->edge(edge);
+  *at_us = flexhal::utils::time::micros64();
+}
+
+inline task::Task drive_pin(gpio::IPin* pin, uint64_t* at_us) {
+  co_await task::sleep_for(2000);
+  pin->digitalWrite(false); // 立ち上がり待ちは反応しない
+  co_await task::sleep_for(2000);
+  *at_us = flexhal::utils::time::micros64();
+  pin->digitalWrite(true);
+}
+
+// co_await pin.edge(Rising) がエッジ後に（ポーリング間隔以内で）再開されるか
+inline bool test_task_pin_edge() {
+  flexhal::internal::platform::native::hal::gpio::NativeGpio hal_gpio;
+  gpio::IPin& pin = hal_gpio.getPort(0).getPin(2);
+  pin.setMode(gpio::PinMode::Output);
+  pin.digitalWrite(false);
+
+  task::Executor executor;
+  executor.setPinPollInterval_us(50);
+  int level = -1;
+  uint64_t seen_us = 0, driven_us = 0;
+  executor.spawn(wait_edge(&pin, gpio::PinEdge::Rising, &level, &seen_us));
+  executor.spawn(drive_pin(&pin, &driven_us));
+  executor.run();
+  return level == 1 && seen_us >= driven_us && executor.getTaskCount() == 0;
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+} // namespace flexhal_test
+
+TEST(TaskTest, SleepOrder) {
+  EXPECT_TRUE(flexhal_test::test_task_sleep_order());
+}
+
+TEST(TaskTest, SubTask) {
+  EXPECT_TRUE(flexhal_test::test_task_subtask());
+}
+
+TEST(TaskTest, PoolExhaustion) {
+  EXPECT_TRUE(flexhal_test::test_task_pool_exhaustion());
+}
+
+TEST(TaskTest, IdleUntilDeadline) {
+  EXPECT_TRUE(flexhal_test::test_task_idle());
+}
+
+TEST(TaskTest, Yield) {
+  EXPECT_TRUE(flexhal_test::test_task_yield());
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+TEST(TaskTest, PinEdge) {
+  EXPECT_TRUE(flexhal_test::test_task_pin_edge());
+}
+#endif
+
+#endif // FLEXHAL_INTERNAL_TASK
@@ -11,7 +11,7 @@ inline bool test_delay_ms(uint32_t delay_time = 100, double tolerance = 0.1) {
   auto elapsed = flexhal::utils::time::millis() - start;
 
   // 遅延時間が期待範囲内かチェック
-  return (result == to_error(flexhal::base::status::ok)) &&
+  return (result == flexhal::base::status::ok) &&
          (elapsed >= delay_time) &&
          (elapsed <= delay_time * (1.0 + tolerance));
 }
@@ -24,7 +24,7 @@ inline bool test_delay_us(uint32_t delay_time = 1000) {
 
   // マイクロ秒レベルでは環境による誤差が大きいので、
   // おおよその範囲でチェック（0.5倍～1.5倍）
-  return (result == to_error(flexhal::base::status::ok)) &&
+  return (result == flexhal::base::status::ok) &&
          (elapsed >= delay_time) &&
          (elapsed <= delay_time * 1.5);
 }
@@ -64,6 +64,83 @@ inline bool test_millis_micros_consistency(uint32_t delay_time = 500, double tol
   return diff <= (elapsed_millis * tolerance);
 }
 
+// micros64()/nanos64() が単調増加し、互いに一致するか
+inline bool test_time64_monotonic(int iterations = 100000) {
+  uint64_t last_us = flexhal::utils::time::micros64();
+  uint64_t last_ns = flexhal::utils::time::nanos64();
+  for (int i = 0; i < iterations; ++i) {
+    uint64_t us = flexhal::utils::time::micros64();
+    uint64_t ns = flexhal::utils::time::nanos64();
+    if (us < last_us || ns < last_ns) return false;
+    last_us = us;
+    last_ns = ns;
+  }
+  // 同じ時計なので、ほぼ同時に読んだ値の差は小さいはず
+  uint64_t us = flexhal::utils::time::micros64();
+  uint64_t ns = flexhal::utils::time::nanos64();
+  return (ns / 1000 >= us) && (ns / 1000 - us < 1000);
+}
+
+// ticks() の差分を ticks_to_ns() で変換した値が nanos64() の経過時間と一致するか
+inline bool test_ticks_to_ns(uint32_t delay_time = 20, double tolerance = 0.01) {
+  uint64_t start_ticks = flexhal::utils::time::ticks();
+  uint64_t start_ns = flexhal::utils::time::nanos64();
+  flexhal::utils::time::delay_ms(delay_time);
+  uint64_t end_ticks = flexhal::utils::time::ticks();
+  uint64_t end_ns = flexhal::utils::time::nanos64();
+
+  double elapsed_ticks_ns = static_cast<double>(flexhal::utils::time::ticks_to_ns(end_ticks - start_ticks));
+  double elapsed_ns = static_cast<double>(end_ns - start_ns);
+  return elapsed_ns >= delay_time * 1000000.0 &&
+         std::abs(elapsed_ticks_ns - elapsed_ns) <= elapsed_ns * tolerance;
+}
+
+// cycles() の差分を cycles_to_ns() で変換すると nanos64() の経過時間と一致するか
+inline bool test_cycles_to_ns(uint32_t delay_time = 20, double tolerance = 0.01) {
+  uint32_t start_cycles = flexhal::utils::time::cycles();
+  uint64_t start_ns = flexhal::utils::time::nanos64();
+  flexhal::utils::time::delay_ms(delay_time);
+  uint32_t end_cycles = flexhal::utils::time::cycles();
+  uint64_t end_ns = flexhal::utils::time::nanos64();
+
+  double elapsed_cycles_ns = static_cast<double>(flexhal::utils::time::cycles_to_ns(end_cycles - start_cycles));
+  double elapsed_ns = static_cast<double>(end_ns - start_ns);
+  return std::abs(elapsed_cycles_ns - elapsed_ns) <= elapsed_ns * tolerance;
+}
+
+// micros() は micros64() の下位32ビットと一致するか
+inline bool test_micros_truncation() {
+  uint64_t wide = flexhal::utils::time::micros64();
+  uint32_t narrow = flexhal::utils::time::micros();
+  return static_cast<uint32_t>(narrow - static_cast<uint32_t>(wide)) < 1000;
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+// 校正でスピン閾値が妥当な範囲に設定されるか
+inline bool test_delay_calibration() {
+  uint32_t threshold = flexhal::utils::time::calibrate_delay();
+  bool ok = threshold >= 20 && threshold <= 2000 &&
+            flexhal::utils::time::get_delay_spin_threshold_us() == threshold;
+  flexhal::utils::time::set_delay_spin_threshold_us(150);
+  ok = ok && flexhal::utils::time::get_delay_spin_threshold_us() == 150;
+  flexhal::utils::time::calibrate_delay();
+  return ok;
+}
+
+// sleep + spin のハイブリッド delay_us が要求より早く戻らないか（超過時間の分布は test/bench で計測）
+inline bool test_delay_us_not_early(int repeat = 10) {
+  const uint32_t delays[] = {5, 20, 100, 500, 2000};
+  for (uint32_t delay_time : delays) {
+    for (int i = 0; i < repeat; ++i) {
+      uint64_t start = flexhal::utils::time::nanos64();
+      flexhal::utils::time::delay_us(delay_time);
+      if (flexhal::utils::time::nanos64() - start < delay_time * 1000ull) return false;
+    }
+  }
+  return true;
+}
+#endif
+
 } // namespace flexhal_test
 
 TEST(TimeTest, DelayMs) {
@@ -85,3 +162,29 @@ TEST(TimeTest, MicrosProgression) {
 TEST(TimeTest, MillisMicrosConsistency) {
   EXPECT_TRUE(flexhal_test::test_millis_micros_consistency());
 }
+
+TEST(TimeTest, Time64Monotonic) {
+  EXPECT_TRUE(flexhal_test::test_time64_monotonic());
+}
+
+TEST(TimeTest, TicksToNs) {
+  EXPECT_TRUE(flexhal_test::test_ticks_to_ns());
+}
+
+TEST(TimeTest, CyclesToNs) {
+  EXPECT_TRUE(flexhal_test::test_cycles_to_ns());
+}
+
+TEST(TimeTest, MicrosTruncation) {
+  EXPECT_TRUE(flexhal_test::test_micros_truncation());
+}
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+TEST(TimeTest, DelayCalibration) {
+  EXPECT_TRUE(flexhal_test::test_delay_calibration());
+}
+
+TEST(TimeTest, DelayUsNotEarly) {
+  EXPECT_TRUE(flexhal_test::test_delay_us_not_early());
+}
+#endif
@@ -0,0 +1,218 @@
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace flexhal_test {
+
+namespace timer = flexhal::utils::timer;
+
+inline void count_callback(void* context) {
+  ++*static_cast<int*>(context);
+}
+
+// ワンショットタイマーが指定tickちょうどで1回だけ発火するか
+inline bool test_timer_one_shot() {
+  timer::TimerWheel wheel(16, 1000);
+  int count = 0;
+  timer::TimerId id = wheel.start(5000, count_callback, &count);
+  bool ok = id.valid() && wheel.isActive(id) && wheel.advance(4) == 0 && count == 0;
+  ok = ok && wheel.advance(1) == 1 && count == 1 && !wheel.isActive(id);
+  ok = ok && wheel.advance(100) == 0 && count == 1 && wheel.getActiveCount() == 0;
+  return ok;
+}
+
+// 周期タイマーとキャンセル、古いハンドルの扱い
+inline bool test_timer_periodic_cancel() {
+  timer::TimerWheel wheel(4, 1000);
+  int count = 0;
+  timer::TimerId id = wheel.startPeriodic(3000, count_callback, &count);
+  bool ok = wheel.advance(10) == 3 && count == 3 && wheel.isActive(id);
+  ok = ok && wheel.cancel(id) == flexhal::base::status::ok;
+  ok = ok && wheel.cancel(id) == flexhal::base::status::not_found;
+  // 同じノードが再利用されても古いハンドルでは操作できない
+  int other = 0;
+  timer::TimerId reused = wheel.start(1000, count_callback, &other);
+  ok = ok && reused.index == id.index && !wheel.isActive(id) &&
+       wheel.cancel(id) == flexhal::base::status::not_found && wheel.isActive(reused);
+  ok = ok && wheel.advance(10) == 1 && count == 3 && other == 1;
+  return ok;
+}
+
+// ノードプールを使い切ったら無効なハンドルを返すか
+inline bool test_timer_pool_exhaustion() {
+  timer::TimerWheel wheel(2, 1000);
+  int count = 0;
+  bool ok = wheel.start(1000, count_callback, &count).valid() &&
+            wheel.start(1000, count_callback, &count).valid() &&
+            !wheel.start(1000, count_callback, &count).valid();
+  wheel.advance(1);
+  return ok && count == 2 && wheel.start(1000, count_callback, &count).valid();
+}
+
+struct FireRecord {
+  timer::TimerWheel* wheel;
+  uint64_t expected;
+  uint64_t fired_at;
+  int fired;
+};
+
+inline void record_callback(void* context) {
+  auto* record = static_cast<FireRecord*>(context);
+  record->fired_at = record->wheel->getCurrentTick();
+  ++record->fired;
+}
+
+// 上位レベルからのカスケードを含め、全タイマーが期限tickちょうどに発火するか
+inline bool test_timer_cascade_exact(size_t count = 2000) {
+  timer::TimerWheel wheel(static_cast<uint32_t>(count), 1);
+  std::mt19937 rng(1234);
+  std::vector<FireRecord> records(count);
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t delay = 1 + rng() % (1u << (6 * (1 + i % 4))); // 各レベルに分散
+    records[i] = FireRecord{&wheel, delay, 0, 0};
+    if (!wheel.start(delay, record_callback, &records[i]).valid()) return false;
+  }
+  uint64_t horizon = (1ull << 24) + 1;
+  while (wheel.getCurrentTick() < horizon && wheel.getActiveCount() > 0) {
+    wheel.advance(1 + rng() % 5000);
+  }
+  for (const auto& r : records) {
+    if (r.fired != 1 || r.fired_at != r.expected) return false;
+  }
+  return true;
+}
+
+// ホイールの範囲 (2^24 tick) を超えるタイマーも期限ちょうどに発火するか
+inline bool test_timer_beyond_range() {
+  timer::TimerWheel wheel(2, 1);
+  FireRecord record{&wheel, 50000000, 0, 0};
+  wheel.start(50000000, record_callback, &record);
+  bool ok = wheel.advance(49999999) == 0 && record.fired == 0;
+  return ok && wheel.advance(1) == 1 && record.fired_at == record.expected;
+}
+
+struct SelfCancel {
+  timer::TimerWheel* wheel;
+  timer::TimerId id;
+  int count;
+};
+
+inline void self_cancel_callback(void* context) {
+  auto* self = static_cast<SelfCancel*>(context);
+  if (++self->count == 2) {
+    self->wheel->cancel(self->id);
+  }
+}
+
+// コールバック内から自分自身をキャンセルできるか
+inline bool test_timer_cancel_from_callback() {
+  timer::TimerWheel wheel(4, 1000);
+  SelfCancel self{&wheel, {}, 0};
+  self.id = wheel.startPeriodic(1000, self_cancel_callback, &self);
+  wheel.advance(10);
+  return self.count == 2 && wheel.getActiveCount() == 0;
+}
+
+// 次の期限までの時間が下限として妥当か
+inline bool test_timer_time_until_next() {
+  timer::TimerWheel wheel(4, 1000);
+  int count = 0;
+  bool ok = wheel.getTimeUntilNext_us() == UINT64_MAX;
+  wheel.start(200000, count_callback, &count);
+  uint64_t until = wheel.getTimeUntilNext_us();
+  return ok && until <= 200000 && until > 0;
+}
+
+// 専用スレッドのドライバでタイマーが発火するか
+inline bool test_timer_thread() {
+  timer::TimerWheel wheel(8, 1000);
+  timer::TimerThread thread(wheel);
+  std::atomic<int> count(0);
+  if (thread.start() != flexhal::base::status::ok) return false;
+  wheel.start(5000, [](void* c) { static_cast<std::atomic<int>*>(c)->fetch_add(1); }, &count);
+  for (int i = 0; i < 200 && count.load() == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  thread.stop();
+  return count.load() == 1 && !thread.isRunning();
+}
+
+// タイマーが無い間はスレッドが tick ごとに起きず（poll されず）、stop() で抜けられるか
+inline bool test_timer_thread_idle() {
+  timer::TimerWheel wheel(8, 1000);
+  timer::TimerThread thread(wheel);
+  if (thread.start() != flexhal::base::status::ok) return false;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  thread.stop();
+  return wheel.getCurrentTick() == 0 && !thread.isRunning(); // 起動直後の 1 回の poll だけ
+}
+
+// 1万件以上のアクティブタイマーを混在させても、取り消していないものだけがちょうど 1 回ずつ発火するか
+inline bool test_timer_many(uint32_t count = 20000) {
+  timer::TimerWheel wheel(count, 1000);
+  std::mt19937 rng(42);
+  std::vector<timer::TimerId> ids(count);
+  int fired = 0;
+  bool ok = true;
+  for (uint32_t i = 0; i < count; ++i) {
+    const uint32_t delay = 1000 + (rng() % 60000) * 1000; // 1ms..60s
+    ids[i] = wheel.start(delay, count_callback, &fired);
+    ok = ok && ids[i].valid();
+  }
+  for (uint32_t i = 0; i < count; i += 2) {
+    wheel.cancel(ids[i]);
+  }
+  ok = ok && wheel.getActiveCount() == count / 2;
+  size_t total = 0;
+  while (wheel.getActiveCount() > 0) {
+    total += wheel.advance(100);
+  }
+  return ok && total == count / 2 && fired == static_cast<int>(count / 2);
+}
+
+} // namespace flexhal_test
+
+TEST(TimerTest, OneShot) {
+  EXPECT_TRUE(flexhal_test::test_timer_one_shot());
+}
+
+TEST(TimerTest, PeriodicCancel) {
+  EXPECT_TRUE(flexhal_test::test_timer_periodic_cancel());
+}
+
+TEST(TimerTest, PoolExhaustion) {
+  EXPECT_TRUE(flexhal_test::test_timer_pool_exhaustion());
+}
+
+TEST(TimerTest, CascadeExact) {
+  EXPECT_TRUE(flexhal_test::test_timer_cascade_exact());
+}
+
+TEST(TimerTest, BeyondRange) {
+  EXPECT_TRUE(flexhal_test::test_timer_beyond_range());
+}
+
+TEST(TimerTest, CancelFromCallback) {
+  EXPECT_TRUE(flexhal_test::test_timer_cancel_from_callback());
+}
+
+TEST(TimerTest, TimeUntilNext) {
+  EXPECT_TRUE(flexhal_test::test_timer_time_until_next());
+}
+
+TEST(TimerTest, ThreadDriver) {
+  EXPECT_TRUE(flexhal_test::test_timer_thread());
+}
+
+TEST(TimerTest, ThreadIdle) {
+  EXPECT_TRUE(flexhal_test::test_timer_thread_idle());
+}
+
+TEST(TimerTest, ManyTimers) {
+  EXPECT_TRUE(flexhal_test::test_timer_many());
+}
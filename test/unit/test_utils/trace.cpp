@@ -0,0 +1,207 @@
+// このファイルだけトレースを有効にする（ライブラリ本体は FLEXHAL_TRACE なしでビルドされる）
+#define FLEXHAL_TRACE 1
+
+#include <FlexHAL.h>
+#include <gtest/gtest.h>
+
+#if FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flexhal_test {
+
+namespace trace = flexhal::utils::trace;
+namespace logger = flexhal::utils::logger;
+
+// 名前でサイトの統計を探す
+inline bool find_site(const char* name, trace::SiteStats& stats) {
+  for (size_t i = 0; trace::get_site_stats(i, stats); ++i) {
+    if (strcmp(stats.name, name) == 0) return true;
+  }
+  return false;
+}
+
+inline void busy_wait_ns(uint64_t ns) {
+  const uint64_t end = flexhal::utils::time::nanos64() + ns;
+  while (flexhal::utils::time::nanos64() < end) {
+  }
+}
+
+inline void traced_work(uint64_t ns) {
+  FLEXHAL_TRACE_SCOPE("test.work");
+  busy_wait_ns(ns);
+}
+
+inline void traced_outer() {
+  FLEXHAL_TRACE_SCOPE("test.outer");
+  traced_work(2000);
+  traced_work(2000);
+}
+
+inline void append_text(const char* data, size_t size, void* context) {
+  static_cast<std::string*>(context)->append(data, size);
+}
+
+// 行を保存するだけのロガー
+class TraceCaptureLogger : public logger::ILogger {
+public:
+  void log(logger::LogLevel level, const char* tag, const char* format, std::va_list args) override {
+    char text[256];
+    vsnprintf(text, sizeof(text), format, args);
+    lines.push_back(std::string(tag) + " " + text);
+    (void)level;
+  }
+
+  std::vector<std::string> lines;
+};
+
+// サイトごとの回数・最小・最大・平均
+inline bool test_trace_site_stats() {
+  trace::reset();
+  traced_work(1000);
+  traced_work(20000);
+  for (int i = 0; i < 8; ++i) traced_work(0);
+
+  trace::SiteStats stats;
+  bool ok = find_site("test.work", stats) && stats.count == 10;
+  ok = ok && stats.max_ns >= 20000 && stats.min_ns < 1000 && stats.min_ns <= stats.mean_ns;
+  ok = ok && stats.mean_ns <= stats.max_ns && stats.total_ns >= 21000;
+
+  trace::reset();
+  ok = ok && find_site("test.work", stats) && stats.count == 0 && stats.max_ns == 0;
+  return ok && trace::get_site_count() >= 1;
+}
+
+// 入れ子のスコープはイベントとして順に残り、子は親の区間に収まるか
+inline bool test_trace_events() {
+  trace::reset();
+  traced_outer();
+  trace::TraceEvent events[8];
+  const size_t count = trace::get_events(events, 8);
+  // 終了した順に記録される: work, work, outer
+  bool ok = count == 3 && strcmp(events[0].name, "test.work") == 0 && strcmp(events[2].name, "test.outer") == 0;
+  ok = ok && events[0].start_ns >= events[2].start_ns && events[1].start_ns >= events[0].start_ns + events[0].duration_ns;
+  ok = ok && events[1].start_ns + events[1].duration_ns <= events[2].start_ns + events[2].duration_ns;
+  ok = ok && events[2].duration_ns >= 4000 && trace::get_events(events, 1) == 1;
+
+  // 古いイベントは上書きされ、最新の FLEXHAL_TRACE_EVENTS 件だけ残る
+  trace::reset();
+  for (int i = 0; i < FLEXHAL_TRACE_EVENTS + 10; ++i) traced_work(0);
+  std::vector<trace::TraceEvent> all(FLEXHAL_TRACE_EVENTS * 2);
+  ok = ok && trace::get_events(all.data(), all.size()) == FLEXHAL_TRACE_EVENTS;
+  trace::SiteStats stats;
+  return ok && find_site("test.work", stats) && stats.count == FLEXHAL_TRACE_EVENTS + 10;
+}
+
+// 同時に動くスレッドは別のバッファに記録されるか
+inline bool test_trace_threads() {
+  trace::reset();
+  std::atomic<int> traced{0};
+  auto work = [&traced] {
+    traced_work(100);
+    traced.fetch_add(1);
+    while (traced.load() < 2) std::this_thread::yield(); // 両方が記録し終えるまでバッファを持ち続ける
+  };
+  std::thread a(work);
+  std::thread b(work);
+  a.join();
+  b.join();
+  std::vector<trace::TraceEvent> events(FLEXHAL_TRACE_BUFFERS * FLEXHAL_TRACE_EVENTS);
+  const size_t count = trace::get_events(events.data(), events.size());
+  bool ok = count == 2 && events[0].thread != events[1].thread;
+  trace::SiteStats stats;
+  return ok && find_site("test.work", stats) && stats.count == 2;
+}
+
+// 終了したスレッドのバッファは次のスレッドが使い回す（バッファ数より多くても落ちない）
+inline bool test_trace_buffer_reuse() {
+  trace::reset();
+  for (int i = 0; i < FLEXHAL_TRACE_BUFFERS * 4; ++i) {
+    std::thread worker([] { traced_work(0); });
+    worker.join();
+  }
+  std::vector<trace::TraceEvent> events(FLEXHAL_TRACE_BUFFERS * FLEXHAL_TRACE_EVENTS);
+  const size_t count = trace::get_events(events.data(), events.size());
+  trace::SiteStats stats;
+  bool ok = trace::get_dropped_count() == 0 && count == FLEXHAL_TRACE_BUFFERS * 4;
+  return ok && find_site("test.work", stats) && stats.count == FLEXHAL_TRACE_BUFFERS * 4;
+}
+
+// Chrome trace JSON とロガーへの出力
+inline bool test_trace_export() {
+  trace::reset();
+  traced_outer();
+  std::string json;
+  trace::export_chrome_json(append_text, &json);
+  bool ok = json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[{\"name\":\"test.work\",\"ph\":\"X\"", 0) == 0;
+  ok = ok && json.find("\"name\":\"test.outer\"") != std::string::npos && json.find("},{") != std::string::npos;
+  ok = ok && json.size() > 3 && json.compare(json.size() - 3, 3, "]}\n") == 0;
+
+  const std::string path = "/tmp/flexhal_trace_test.json";
+  ok = ok && trace::save_chrome_json(path.c_str()) == flexhal::base::status::ok;
+  std::string saved;
+  if (FILE* file = fopen(path.c_str(), "r")) {
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) saved.append(buffer, n);
+    fclose(file);
+  }
+  remove(path.c_str());
+  ok = ok && saved == json && trace::save_chrome_json("/nonexistent/dir/trace.json") == flexhal::base::status::io;
+
+  TraceCaptureLogger sink;
+  logger::ILogger* previous = logger::_active_logger;
+  logger::setLogger(&sink);
+  trace::log_stats();
+  logger::setLogger(previous);
+  bool logged = false;
+  for (const std::string& line : sink.lines) {
+    logged = logged || line.rfind("TRACE test.work: n=2 min=", 0) == 0;
+  }
+  return ok && logged;
+}
+
+// FLEXHAL_TRACE なしでビルドされたライブラリのスコープは何も記録しない
+inline bool test_trace_disabled_in_library() {
+  flexhal::internal::platform::native::hal::gpio::NativeGpio gpio;
+  flexhal::hal::gpio::IPin& pin = gpio.getPort(0).getPin(0);
+  pin.digitalWrite(true);
+  pin.digitalRead();
+  pin.tryDigitalRead();
+  trace::SiteStats stats;
+  return !find_site("gpio.write", stats) && !find_site("gpio.read", stats) && !find_site("gpio.try_read", stats);
+}
+
+} // namespace flexhal_test
+
+TEST(TraceTest, SiteStats) {
+  EXPECT_TRUE(flexhal_test::test_trace_site_stats());
+}
+
+TEST(TraceTest, Events) {
+  EXPECT_TRUE(flexhal_test::test_trace_events());
+}
+
+TEST(TraceTest, Threads) {
+  EXPECT_TRUE(flexhal_test::test_trace_threads());
+}
+
+TEST(TraceTest, BufferReuse) {
+  EXPECT_TRUE(flexhal_test::test_trace_buffer_reuse());
+}
+
+TEST(TraceTest, Export) {
+  EXPECT_TRUE(flexhal_test::test_trace_export());
+}
+
+TEST(TraceTest, DisabledInLibrary) {
+  EXPECT_TRUE(flexhal_test::test_trace_disabled_in_library());
+}
+
+#endif // FLEXHAL_DETECT_INTERNAL_PLATFORM_NATIVE
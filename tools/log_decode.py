@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Decode a FlexHAL BinaryLogger stream into text.
+
+The stream format is documented in src/flexhal/utils/logger/BinaryLogger.hpp;
+the argument layout in src/flexhal/utils/logger/args.hpp.
+
+Usage:
+    log_decode.py [FILE]            # reads stdin when FILE is omitted or "-"
+    log_decode.py /dev/ttyUSB0      # a serial port opened as a file also works
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_DEFINITION = 0xD1
+RECORD_MESSAGE = 0xD2
+
+LEVELS = {1: "E", 2: "W", 3: "I", 4: "D", 5: "V"}
+
+# Same grammar as parse_spec() in args.hpp.
+SPEC_RE = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d*))?"
+    r"(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conv>[diouxXcfFeEgGaAspn%])"
+)
+
+
+def string_id(text):
+    """32-bit FNV-1a, identical to flexhal::utils::logger::string_id()."""
+    h = 2166136261
+    for b in text.encode("utf-8", "surrogateescape"):
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+class ArgReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.pos + size > len(self.data):
+            raise IndexError
+        (value,) = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += size
+        return value
+
+    def string(self):
+        end = self.data.find(b"\0", self.pos)
+        if end < 0:
+            raise IndexError
+        value = self.data[self.pos:end].decode("utf-8", "replace")
+        self.pos = end + 1
+        return value
+
+
+def format_packed(fmt, data):
+    """Render packed argument bytes with the format string they were packed with."""
+    reader = ArgReader(data)
+    out = []
+    last = 0
+    try:
+        for m in SPEC_RE.finditer(fmt):
+            out.append(fmt[last:m.start()])
+            last = m.end()
+            conv = m.group("conv")
+            if conv == "%":
+                out.append("%")
+                continue
+            width = m.group("width") or ""
+            prec = m.group("prec")
+            if width == "*":
+                width = str(reader.take("<i"))
+            if prec == "*":
+                prec = str(reader.take("<i"))
+            spec = "%" + m.group("flags") + width + ("." + prec if prec is not None else "")
+            wide = m.group("length") in ("l", "ll", "j", "z", "t")
+            if conv in "di":
+                out.append((spec + "d") % reader.take("<q" if wide else "<i"))
+            elif conv in "ouxX":
+                out.append((spec + conv) % reader.take("<Q" if wide else "<I"))
+            elif conv == "c":
+                out.append((spec + "c") % chr(reader.take("<i") & 0xFF))  # %lc is stored as 4 bytes too
+            elif conv in "fFeEgG":
+                out.append((spec + conv) % reader.take("<d"))
+            elif conv in "aA":
+                out.append(reader.take("<d").hex())
+            elif conv == "p":
+                out.append("0x%x" % reader.take("<Q"))
+            elif conv == "s":
+                out.append((spec + "s") % reader.string())
+            # %n stores nothing
+    except IndexError:
+        out.append("<truncated>")
+        return "".join(out)
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+def decode(stream, write):
+    strings = {}
+    buf = b""
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        pos = 0
+        while pos < len(buf):
+            kind = buf[pos]
+            if kind == RECORD_DEFINITION:
+                if pos + 7 > len(buf):
+                    break
+                sid, length = struct.unpack_from("<IH", buf, pos + 1)
+                if pos + 7 + length > len(buf):
+                    break
+                text = buf[pos + 7:pos + 7 + length].decode("utf-8", "surrogateescape")
+                if string_id(text) != sid:
+                    write("# warning: definition id mismatch for %r\n" % text)
+                strings[sid] = text
+                pos += 7 + length
+            elif kind == RECORD_MESSAGE:
+                if pos + 16 > len(buf):
+                    break
+                fmt_id, level, tag_id, ts, arg_len = struct.unpack_from("<IBIIH", buf, pos + 1)
+                if pos + 16 + arg_len > len(buf):
+                    break
+                args = buf[pos + 16:pos + 16 + arg_len]
+                fmt = strings.get(fmt_id)
+                tag = strings.get(tag_id, "#%08x" % tag_id)
+                if fmt is None:
+                    text = "<unknown format #%08x, %d arg bytes>" % (fmt_id, arg_len)
+                else:
+                    text = format_packed(fmt, args)
+                write("[%10.6f] %s %s: %s\n" % (ts / 1e6, LEVELS.get(level, "?"), tag, text))
+                pos += 16 + arg_len
+            else:
+                # Not aligned to a record (e.g. attached mid-stream); resync.
+                pos += 1
+        buf = buf[pos:]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", nargs="?", default="-")
+    opts = parser.parse_args()
+    stream = sys.stdin.buffer if opts.file == "-" else open(opts.file, "rb")
+    try:
+        decode(stream, sys.stdout.write)
+    finally:
+        if stream is not sys.stdin.buffer:
+            stream.close()
+
+
+if __name__ == "__main__":
+    main()